@@ -3,14 +3,103 @@
 
 #include "AsyncRequest/ModioAsyncRequest.h"
 #include "ModioSubsystem.h"
+#include "Schemas/ModioResponse.h"
+#include "Enums/ModioRequestPriority.h"
 
 FModioAsyncRequest::FModioAsyncRequest( FModioSubsystem *Modio ) :
-  ModioSubsystem( Modio )
+  ModioSubsystem( Modio ),
+  DestroyFunction( nullptr ),
+  bCancelled( false ),
+  bHoldsSlot( false ),
+  Priority( EModioRequestPriority::NORMAL ),
+  bAbandoned( false )
 {
   checkf(Modio, TEXT("Trying to pass a bad ModioSubsystem to a async request") );
 }
 
 void FModioAsyncRequest::Done()
 {
+  for( const FModioAsyncRequestHandle& FollowerHandle : Followers )
+  {
+    if( FModioAsyncRequest* Follower = ModioSubsystem->FindAsyncRequest( FollowerHandle ) )
+    {
+      ModioSubsystem->AsyncRequestDone( Follower );
+    }
+  }
+  Followers.Reset();
+
   ModioSubsystem->AsyncRequestDone( this );
-}
\ No newline at end of file
+}
+
+bool FModioAsyncRequest::FinishIfCancelled()
+{
+  if( !bCancelled )
+  {
+    return false;
+  }
+
+  for( const FModioAsyncRequestHandle& FollowerHandle : Followers )
+  {
+    FModioAsyncRequest* Follower = ModioSubsystem->FindAsyncRequest( FollowerHandle );
+    if( Follower && !Follower->bCancelled )
+    {
+      return false;
+    }
+  }
+
+  Done();
+  return true;
+}
+
+bool FModioAsyncRequest::FinishIfAbandoned()
+{
+  Timings.ResponseTime = FPlatformTime::Seconds();
+
+  if( !bAbandoned )
+  {
+    return false;
+  }
+
+  ModioSubsystem->DeliverResponse( this, TFunction<void()>() );
+  return true;
+}
+
+void FModioAsyncRequest::Deliver( const FModioResponse &Response, TFunction<void()> Dispatch )
+{
+  Timings.ConvertedTime = FPlatformTime::Seconds();
+  if( Timings.ResponseTime == 0.0 )
+  {
+    // Finished without the SDK answering it, like requests that had nothing to ask for
+    Timings.ResponseTime = Timings.ConvertedTime;
+  }
+  Timings.ResponseCode = Response.Code;
+  Timings.NumResults = Response.ResultCount;
+
+  ModioSubsystem->DeliverResponse( this, MoveTemp( Dispatch ) );
+}
+
+void FModioAsyncRequest::ConvertAfterSdkLock( TFunction<void()> Convert )
+{
+  ModioSubsystem->QueueConversion( MoveTemp( Convert ) );
+}
+
+void FModioAsyncRequest::TakeNetworkTimings( const FModioAsyncRequest& AnsweredBy )
+{
+  Timings.IssueTime = AnsweredBy.Timings.IssueTime;
+  Timings.ResponseTime = AnsweredBy.Timings.ResponseTime;
+}
+
+void FModioAsyncRequest::BeginDispatch( TArray<FModioAsyncRequest*, TInlineAllocator<8>> &OutLiveFollowers )
+{
+  // Delegates might issue the same read again, and that one should go to the backend
+  ModioSubsystem->StopCoalescing( this );
+
+  for( const FModioAsyncRequestHandle& FollowerHandle : Followers )
+  {
+    FModioAsyncRequest* Follower = ModioSubsystem->FindAsyncRequest( FollowerHandle );
+    if( Follower && !Follower->bCancelled )
+    {
+      OutLiveFollowers.Add( Follower );
+    }
+  }
+}
@@ -0,0 +1,42 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#include "AsyncRequest/ModioAsyncRequestPool.h"
+
+namespace
+{
+  struct FPoolList
+  {
+    FCriticalSection CriticalSection;
+    TArray<void (*)()> ReleaseFunctions;
+  };
+
+  FPoolList& GetPoolList()
+  {
+    // Leaked on purpose, like the pools themselves
+    static FPoolList* PoolList = new FPoolList();
+    return *PoolList;
+  }
+}
+
+void FModioAsyncRequestPools::Register( void (*Release)() )
+{
+  FPoolList& PoolList = GetPoolList();
+  FScopeLock Lock( &PoolList.CriticalSection );
+  PoolList.ReleaseFunctions.Add( Release );
+}
+
+void FModioAsyncRequestPools::ReleaseAll()
+{
+  TArray<void (*)()> ReleaseFunctions;
+  {
+    FPoolList& PoolList = GetPoolList();
+    FScopeLock Lock( &PoolList.CriticalSection );
+    ReleaseFunctions = PoolList.ReleaseFunctions;
+  }
+
+  for( void (*Release)() : ReleaseFunctions )
+  {
+    Release();
+  }
+}
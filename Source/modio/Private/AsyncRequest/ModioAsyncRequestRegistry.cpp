@@ -0,0 +1,80 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#include "AsyncRequest/ModioAsyncRequestRegistry.h"
+#include "AsyncRequest/ModioAsyncRequest.h"
+
+FModioAsyncRequestRegistry::FModioAsyncRequestRegistry() :
+  NumActive( 0 )
+{
+}
+
+FModioAsyncRequestRegistry::~FModioAsyncRequestRegistry()
+{
+  Reset();
+}
+
+FModioAsyncRequestHandle FModioAsyncRequestRegistry::Add( FModioAsyncRequest* Request, void (*DestroyFunction)(FModioAsyncRequest*) )
+{
+  checkf(Request, TEXT("Trying to register a invalid async request"));
+  checkf(DestroyFunction, TEXT("Async request registered without a way to destroy it"));
+  Request->DestroyFunction = DestroyFunction;
+
+  int32 Index;
+  if( FreeSlots.Num() )
+  {
+    Index = FreeSlots.Pop( false );
+  }
+  else
+  {
+    Index = Slots.AddUninitialized();
+    Slots[Index].Generation = 0;
+  }
+
+  FSlot& Slot = Slots[Index];
+  Slot.Request = Request;
+  NumActive++;
+
+  return FModioAsyncRequestHandle( Index, Slot.Generation );
+}
+
+FModioAsyncRequest* FModioAsyncRequestRegistry::Find( const FModioAsyncRequestHandle &Handle ) const
+{
+  if( !Slots.IsValidIndex( Handle.Index ) )
+  {
+    return nullptr;
+  }
+
+  const FSlot& Slot = Slots[Handle.Index];
+  return Slot.Generation == Handle.Generation ? Slot.Request : nullptr;
+}
+
+bool FModioAsyncRequestRegistry::Remove( const FModioAsyncRequestHandle &Handle )
+{
+  FModioAsyncRequest* Request = Find( Handle );
+  if( !Request )
+  {
+    return false;
+  }
+
+  FSlot& Slot = Slots[Handle.Index];
+  Slot.Request = nullptr;
+  // Bumping the generation invalidates all outstanding handles to this slot
+  Slot.Generation++;
+  FreeSlots.Push( Handle.Index );
+  NumActive--;
+
+  Request->DestroyFunction( Request );
+  return true;
+}
+
+void FModioAsyncRequestRegistry::Reset()
+{
+  for( int32 Index = 0; Index < Slots.Num(); Index++ )
+  {
+    if( Slots[Index].Request )
+    {
+      Remove( FModioAsyncRequestHandle( Index, Slots[Index].Generation ) );
+    }
+  }
+}
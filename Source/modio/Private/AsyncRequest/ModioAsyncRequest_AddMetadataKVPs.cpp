@@ -12,11 +12,17 @@ FModioAsyncRequest_AddMetadataKVP::FModioAsyncRequest_AddMetadataKVP( FModioSubs
 
 void FModioAsyncRequest_AddMetadataKVP::Response(void *Object, ModioResponse ModioResponse)
 {
+  FModioAsyncRequest_AddMetadataKVP* ThisPointer = (FModioAsyncRequest_AddMetadataKVP*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
-  FModioAsyncRequest_AddMetadataKVP* ThisPointer = (FModioAsyncRequest_AddMetadataKVP*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
+  });
 }
\ No newline at end of file
@@ -11,14 +11,20 @@ FModioAsyncRequest_AddMod::FModioAsyncRequest_AddMod( FModioSubsystem *Modio, FM
 
 void FModioAsyncRequest_AddMod::Response( void *Object, ModioResponse ModioResponse, ModioMod ModioMod )
 {
+  FModioAsyncRequest_AddMod* ThisPointer = (FModioAsyncRequest_AddMod*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
   FModioMod Mod;
   InitializeMod( Mod, ModioMod );
   
-  FModioAsyncRequest_AddMod* ThisPointer = (FModioAsyncRequest_AddMod*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response, Mod );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response, Mod = MoveTemp( Mod )]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response, Mod );
+  });
 }
\ No newline at end of file
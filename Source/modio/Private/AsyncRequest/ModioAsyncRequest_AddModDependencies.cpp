@@ -12,11 +12,17 @@ FModioAsyncRequest_AddModDependencies::FModioAsyncRequest_AddModDependencies( FM
 
 void FModioAsyncRequest_AddModDependencies::Response(void *Object, ModioResponse ModioResponse)
 {
+  FModioAsyncRequest_AddModDependencies* ThisPointer = (FModioAsyncRequest_AddModDependencies*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
-  FModioAsyncRequest_AddModDependencies* ThisPointer = (FModioAsyncRequest_AddModDependencies*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
+  });
 }
\ No newline at end of file
@@ -12,11 +12,17 @@ FModioAsyncRequest_AddModImages::FModioAsyncRequest_AddModImages( FModioSubsyste
 
 void FModioAsyncRequest_AddModImages::Response(void *Object, ModioResponse ModioResponse)
 {
+  FModioAsyncRequest_AddModImages* ThisPointer = (FModioAsyncRequest_AddModImages*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
-  FModioAsyncRequest_AddModImages* ThisPointer = (FModioAsyncRequest_AddModImages*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
+  });
 }
\ No newline at end of file
@@ -11,11 +11,17 @@ FModioAsyncRequest_AddModLogo::FModioAsyncRequest_AddModLogo( FModioSubsystem *M
 
 void FModioAsyncRequest_AddModLogo::Response( void *Object, ModioResponse ModioResponse )
 {
+  FModioAsyncRequest_AddModLogo* ThisPointer = (FModioAsyncRequest_AddModLogo*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
   
-  FModioAsyncRequest_AddModLogo* ThisPointer = (FModioAsyncRequest_AddModLogo*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
+  });
 }
\ No newline at end of file
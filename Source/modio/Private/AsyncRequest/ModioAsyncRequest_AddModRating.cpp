@@ -11,11 +11,17 @@ FModioAsyncRequest_AddModRating::FModioAsyncRequest_AddModRating( FModioSubsyste
 
 void FModioAsyncRequest_AddModRating::Response( void *Object, ModioResponse ModioResponse )
 {
+  FModioAsyncRequest_AddModRating* ThisPointer = (FModioAsyncRequest_AddModRating*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
-  FModioAsyncRequest_AddModRating* ThisPointer = (FModioAsyncRequest_AddModRating*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
+  });
 }
\ No newline at end of file
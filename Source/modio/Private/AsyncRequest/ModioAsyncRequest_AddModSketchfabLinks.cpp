@@ -12,11 +12,17 @@ FModioAsyncRequest_AddModSketchfabLinks::FModioAsyncRequest_AddModSketchfabLinks
 
 void FModioAsyncRequest_AddModSketchfabLinks::Response(void *Object, ModioResponse ModioResponse)
 {
+  FModioAsyncRequest_AddModSketchfabLinks* ThisPointer = (FModioAsyncRequest_AddModSketchfabLinks*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
-  FModioAsyncRequest_AddModSketchfabLinks* ThisPointer = (FModioAsyncRequest_AddModSketchfabLinks*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
+  });
 }
\ No newline at end of file
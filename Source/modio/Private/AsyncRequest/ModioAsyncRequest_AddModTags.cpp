@@ -12,11 +12,17 @@ FModioAsyncRequest_AddModTags::FModioAsyncRequest_AddModTags( FModioSubsystem *M
 
 void FModioAsyncRequest_AddModTags::Response(void *Object, ModioResponse ModioResponse)
 {
+  FModioAsyncRequest_AddModTags* ThisPointer = (FModioAsyncRequest_AddModTags*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
-  FModioAsyncRequest_AddModTags* ThisPointer = (FModioAsyncRequest_AddModTags*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
+  });
 }
\ No newline at end of file
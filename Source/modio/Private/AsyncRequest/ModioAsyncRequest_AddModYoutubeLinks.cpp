@@ -12,11 +12,17 @@ FModioAsyncRequest_AddModYoutubeLinks::FModioAsyncRequest_AddModYoutubeLinks( FM
 
 void FModioAsyncRequest_AddModYoutubeLinks::Response(void *Object, ModioResponse ModioResponse)
 {
+  FModioAsyncRequest_AddModYoutubeLinks* ThisPointer = (FModioAsyncRequest_AddModYoutubeLinks*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
-  FModioAsyncRequest_AddModYoutubeLinks* ThisPointer = (FModioAsyncRequest_AddModYoutubeLinks*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
+  });
 }
\ No newline at end of file
@@ -12,11 +12,17 @@ FModioAsyncRequest_DeleteMetadataKVP::FModioAsyncRequest_DeleteMetadataKVP( FMod
 
 void FModioAsyncRequest_DeleteMetadataKVP::Response(void *Object, ModioResponse ModioResponse)
 {
+  FModioAsyncRequest_DeleteMetadataKVP* ThisPointer = (FModioAsyncRequest_DeleteMetadataKVP*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
-  FModioAsyncRequest_DeleteMetadataKVP* ThisPointer = (FModioAsyncRequest_DeleteMetadataKVP*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
+  });
 }
\ No newline at end of file
@@ -12,11 +12,17 @@ FModioAsyncRequest_DeleteModDependencies::FModioAsyncRequest_DeleteModDependenci
 
 void FModioAsyncRequest_DeleteModDependencies::Response(void *Object, ModioResponse ModioResponse)
 {
+  FModioAsyncRequest_DeleteModDependencies* ThisPointer = (FModioAsyncRequest_DeleteModDependencies*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
-  FModioAsyncRequest_DeleteModDependencies* ThisPointer = (FModioAsyncRequest_DeleteModDependencies*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
+  });
 }
\ No newline at end of file
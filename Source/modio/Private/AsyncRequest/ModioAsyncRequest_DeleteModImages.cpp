@@ -12,11 +12,17 @@ FModioAsyncRequest_DeleteModImages::FModioAsyncRequest_DeleteModImages( FModioSu
 
 void FModioAsyncRequest_DeleteModImages::Response(void *Object, ModioResponse ModioResponse)
 {
+  FModioAsyncRequest_DeleteModImages* ThisPointer = (FModioAsyncRequest_DeleteModImages*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
-  FModioAsyncRequest_DeleteModImages* ThisPointer = (FModioAsyncRequest_DeleteModImages*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
+  });
 }
\ No newline at end of file
@@ -12,11 +12,17 @@ FModioAsyncRequest_DeleteModSketchfabLinks::FModioAsyncRequest_DeleteModSketchfa
 
 void FModioAsyncRequest_DeleteModSketchfabLinks::Response(void *Object, ModioResponse ModioResponse)
 {
+  FModioAsyncRequest_DeleteModSketchfabLinks* ThisPointer = (FModioAsyncRequest_DeleteModSketchfabLinks*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
-  FModioAsyncRequest_DeleteModSketchfabLinks* ThisPointer = (FModioAsyncRequest_DeleteModSketchfabLinks*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
+  });
 }
\ No newline at end of file
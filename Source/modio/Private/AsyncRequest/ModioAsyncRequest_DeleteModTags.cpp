@@ -12,11 +12,17 @@ FModioAsyncRequest_DeleteModTags::FModioAsyncRequest_DeleteModTags( FModioSubsys
 
 void FModioAsyncRequest_DeleteModTags::Response(void *Object, ModioResponse ModioResponse)
 {
+  FModioAsyncRequest_DeleteModTags* ThisPointer = (FModioAsyncRequest_DeleteModTags*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
-  FModioAsyncRequest_DeleteModTags* ThisPointer = (FModioAsyncRequest_DeleteModTags*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
+  });
 }
\ No newline at end of file
@@ -12,11 +12,17 @@ FModioAsyncRequest_DeleteModYoutubeLinks::FModioAsyncRequest_DeleteModYoutubeLin
 
 void FModioAsyncRequest_DeleteModYoutubeLinks::Response(void *Object, ModioResponse ModioResponse)
 {
+  FModioAsyncRequest_DeleteModYoutubeLinks* ThisPointer = (FModioAsyncRequest_DeleteModYoutubeLinks*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
-  FModioAsyncRequest_DeleteModYoutubeLinks* ThisPointer = (FModioAsyncRequest_DeleteModYoutubeLinks*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
+  });
 }
\ No newline at end of file
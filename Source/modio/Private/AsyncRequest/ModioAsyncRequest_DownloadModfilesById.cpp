@@ -12,11 +12,17 @@ FModioAsyncRequest_DownloadModfilesById::FModioAsyncRequest_DownloadModfilesById
 
 void FModioAsyncRequest_DownloadModfilesById::Response(void *Object, ModioResponse ModioResponse, bool ModsAreUpdated)
 {
+  FModioAsyncRequest_DownloadModfilesById* ThisPointer = (FModioAsyncRequest_DownloadModfilesById*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
-  FModioAsyncRequest_DownloadModfilesById* ThisPointer = (FModioAsyncRequest_DownloadModfilesById*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response, ModsAreUpdated );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response, ModsAreUpdated]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response, ModsAreUpdated );
+  });
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #include "AsyncRequest/ModioAsyncRequest_DownloadSubscribedModfiles.h"
 #include "ModioUE4Utility.h"
+#include "ModioSubsystem.h"
 
 FModioAsyncRequest_DownloadSubscribedModfiles::FModioAsyncRequest_DownloadSubscribedModfiles( FModioSubsystem *Modio, FModioBooleanDelegate Delegate ) :
   FModioAsyncRequest( Modio ),
@@ -12,11 +13,25 @@ FModioAsyncRequest_DownloadSubscribedModfiles::FModioAsyncRequest_DownloadSubscr
 
 void FModioAsyncRequest_DownloadSubscribedModfiles::Response(void *Object, ModioResponse ModioResponse, bool ModsAreUpdated)
 {
+  FModioAsyncRequest_DownloadSubscribedModfiles* ThisPointer = (FModioAsyncRequest_DownloadSubscribedModfiles*)Object;
+
+  // Unsubscribed mods might have been uninstalled, whether anybody still wants the response or not
+  FModioSubsystem* ModioSubsystem = ThisPointer->ModioSubsystem;
+  ModioSubsystem->RunOnGameThread( [ModioSubsystem]()
+  {
+    ModioSubsystem->RefreshInstalledMods();
+  });
+
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
-  FModioAsyncRequest_DownloadSubscribedModfiles* ThisPointer = (FModioAsyncRequest_DownloadSubscribedModfiles*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response, ModsAreUpdated );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response, ModsAreUpdated]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response, ModsAreUpdated );
+  });
 }
\ No newline at end of file
@@ -11,14 +11,20 @@ FModioAsyncRequest_EditMod::FModioAsyncRequest_EditMod( FModioSubsystem *Modio,
 
 void FModioAsyncRequest_EditMod::Response( void *Object, ModioResponse ModioResponse, ModioMod ModioMod )
 {
+  FModioAsyncRequest_EditMod* ThisPointer = (FModioAsyncRequest_EditMod*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
   FModioMod Mod;
   InitializeMod( Mod, ModioMod );
   
-  FModioAsyncRequest_EditMod* ThisPointer = (FModioAsyncRequest_EditMod*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response, Mod );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response, Mod = MoveTemp( Mod )]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response, Mod );
+  });
 }
\ No newline at end of file
@@ -11,11 +11,17 @@ FModioAsyncRequest_EmailRequest::FModioAsyncRequest_EmailRequest( FModioSubsyste
 
 void FModioAsyncRequest_EmailRequest::Response( void *Object, ModioResponse ModioResponse )
 {
+  FModioAsyncRequest_EmailRequest* ThisPointer = (FModioAsyncRequest_EmailRequest*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
   
-  FModioAsyncRequest_EmailRequest* ThisPointer = (FModioAsyncRequest_EmailRequest*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
+  });
 }
\ No newline at end of file
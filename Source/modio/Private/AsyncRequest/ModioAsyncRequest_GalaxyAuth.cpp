@@ -11,11 +11,17 @@ FModioAsyncRequest_GalaxyAuth::FModioAsyncRequest_GalaxyAuth( FModioSubsystem *M
 
 void FModioAsyncRequest_GalaxyAuth::Response( void *Object, ModioResponse ModioResponse )
 {
+  FModioAsyncRequest_GalaxyAuth* ThisPointer = (FModioAsyncRequest_GalaxyAuth*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
   
-  FModioAsyncRequest_GalaxyAuth* ThisPointer = (FModioAsyncRequest_GalaxyAuth*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
+  });
 }
\ No newline at end of file
@@ -12,11 +12,22 @@ FModioAsyncRequest_GetAllMetadataKVP::FModioAsyncRequest_GetAllMetadataKVP( FMod
 
 void FModioAsyncRequest_GetAllMetadataKVP::Response(void *Object, ModioResponse ModioResponse, ModioMetadataKVP *ModioMetadataKVP, u32 ModioMetadataKVPize)
 {
+  FModioAsyncRequest_GetAllMetadataKVP* ThisPointer = (FModioAsyncRequest_GetAllMetadataKVP*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
-  FModioAsyncRequest_GetAllMetadataKVP* ThisPointer = (FModioAsyncRequest_GetAllMetadataKVP*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response, ConvertToTArrayMetadataKVP(ModioMetadataKVP, ModioMetadataKVPize) );
-  
-  ThisPointer->Done();
+  TArray<FModioMetadataKVP> MetadataKVP = ConvertToTArrayMetadataKVP(ModioMetadataKVP, ModioMetadataKVPize);
+
+  ThisPointer->Deliver( Response, [ThisPointer, Response, MetadataKVP = MoveTemp( MetadataKVP )]()
+  {
+    ThisPointer->DispatchToAll<FModioAsyncRequest_GetAllMetadataKVP>( [&]( FModioAsyncRequest_GetAllMetadataKVP* Request )
+    {
+      Request->ResponseDelegate.ExecuteIfBound( Response, MetadataKVP );
+    });
+  });
 }
\ No newline at end of file
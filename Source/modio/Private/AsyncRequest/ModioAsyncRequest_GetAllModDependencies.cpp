@@ -3,6 +3,7 @@
 
 #include "AsyncRequest/ModioAsyncRequest_GetAllModDependencies.h"
 #include "ModioUE4Utility.h"
+#include "ModioSubsystem.h"
 
 FModioAsyncRequest_GetAllModDependencies::FModioAsyncRequest_GetAllModDependencies( FModioSubsystem *Modio, FModioModDependencyArrayDelegate Delegate ) :
   FModioAsyncRequest( Modio ),
@@ -12,11 +13,23 @@ FModioAsyncRequest_GetAllModDependencies::FModioAsyncRequest_GetAllModDependenci
 
 void FModioAsyncRequest_GetAllModDependencies::Response(void *Object, ModioResponse ModioResponse, ModioDependency *ModioDependencies, u32 ModioDependenciesSize)
 {
+  FModioAsyncRequest_GetAllModDependencies* ThisPointer = (FModioAsyncRequest_GetAllModDependencies*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
-  FModioAsyncRequest_GetAllModDependencies* ThisPointer = (FModioAsyncRequest_GetAllModDependencies*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response, ConvertToTArrayModDependencies(ModioDependencies, ModioDependenciesSize) );
-  
-  ThisPointer->Done();
+  TArray<FModioModDependency> ModDependencies = ConvertToTArrayModDependencies(ModioDependencies, ModioDependenciesSize);
+
+  ThisPointer->Deliver( Response, [ThisPointer, Response, ModDependencies = MoveTemp( ModDependencies )]() mutable
+  {
+    TSharedRef<const TArray<FModioModDependency>> Cached = ThisPointer->ModioSubsystem->CacheResponse( ThisPointer, Response, MoveTemp( ModDependencies ) );
+    ThisPointer->DispatchToAll<FModioAsyncRequest_GetAllModDependencies>( [&]( FModioAsyncRequest_GetAllModDependencies* Request )
+    {
+      Request->ResponseDelegate.ExecuteIfBound( Response, *Cached );
+    });
+  });
 }
\ No newline at end of file
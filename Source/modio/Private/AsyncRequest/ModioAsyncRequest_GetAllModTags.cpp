@@ -3,6 +3,7 @@
 
 #include "AsyncRequest/ModioAsyncRequest_GetAllModTags.h"
 #include "ModioUE4Utility.h"
+#include "ModioSubsystem.h"
 
 FModioAsyncRequest_GetAllModTags::FModioAsyncRequest_GetAllModTags( FModioSubsystem *Modio, FModioModTagArrayDelegate Delegate ) :
   FModioAsyncRequest( Modio ),
@@ -12,11 +13,23 @@ FModioAsyncRequest_GetAllModTags::FModioAsyncRequest_GetAllModTags( FModioSubsys
 
 void FModioAsyncRequest_GetAllModTags::Response(void *Object, ModioResponse ModioResponse, ModioTag *ModioTags, u32 ModioTagsSize)
 {
+  FModioAsyncRequest_GetAllModTags* ThisPointer = (FModioAsyncRequest_GetAllModTags*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
-  FModioAsyncRequest_GetAllModTags* ThisPointer = (FModioAsyncRequest_GetAllModTags*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response, ConvertToTArrayModTags(ModioTags, ModioTagsSize) );
-  
-  ThisPointer->Done();
+  TArray<FModioModTag> ModTags = ConvertToTArrayModTags(ModioTags, ModioTagsSize);
+
+  ThisPointer->Deliver( Response, [ThisPointer, Response, ModTags = MoveTemp( ModTags )]() mutable
+  {
+    TSharedRef<const TArray<FModioModTag>> Cached = ThisPointer->ModioSubsystem->CacheResponse( ThisPointer, Response, MoveTemp( ModTags ) );
+    ThisPointer->DispatchToAll<FModioAsyncRequest_GetAllModTags>( [&]( FModioAsyncRequest_GetAllModTags* Request )
+    {
+      Request->ResponseDelegate.ExecuteIfBound( Response, *Cached );
+    });
+  });
 }
\ No newline at end of file
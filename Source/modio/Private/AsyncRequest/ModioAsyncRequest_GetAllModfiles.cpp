@@ -3,6 +3,7 @@
 
 #include "AsyncRequest/ModioAsyncRequest_GetAllModfiles.h"
 #include "ModioUE4Utility.h"
+#include "ModioSubsystem.h"
 
 FModioAsyncRequest_GetAllModfiles::FModioAsyncRequest_GetAllModfiles(FModioSubsystem* Modio, FModioModfileArrayDelegate Delegate) :
   FModioAsyncRequest(Modio),
@@ -12,10 +13,22 @@ FModioAsyncRequest_GetAllModfiles::FModioAsyncRequest_GetAllModfiles(FModioSubsy
 
 void FModioAsyncRequest_GetAllModfiles::Response(void* Object, ModioResponse InResponse, ModioModfile* Modfiles, u32 ModfilesSize)
 {
+  FModioAsyncRequest_GetAllModfiles* ThisPointer = (FModioAsyncRequest_GetAllModfiles*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse(Response, InResponse);
-  FModioAsyncRequest_GetAllModfiles* ThisPointer = (FModioAsyncRequest_GetAllModfiles*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound(Response, ConvertToTArrayModfiles(Modfiles, ModfilesSize));
+  TArray<FModioModfile> ConvertedModfiles = ConvertToTArrayModfiles(Modfiles, ModfilesSize);
 
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response, ConvertedModfiles = MoveTemp( ConvertedModfiles )]() mutable
+  {
+    TSharedRef<const TArray<FModioModfile>> Cached = ThisPointer->ModioSubsystem->CacheResponse( ThisPointer, Response, MoveTemp( ConvertedModfiles ) );
+    ThisPointer->DispatchToAll<FModioAsyncRequest_GetAllModfiles>([&](FModioAsyncRequest_GetAllModfiles* Request)
+    {
+      Request->ResponseDelegate.ExecuteIfBound(Response, *Cached);
+    });
+  });
 }
\ No newline at end of file
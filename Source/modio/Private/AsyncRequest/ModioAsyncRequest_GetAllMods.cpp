@@ -3,20 +3,65 @@
 
 #include "AsyncRequest/ModioAsyncRequest_GetAllMods.h"
 #include "ModioUE4Utility.h"
+#include "ModioModArrayCopy.h"
+#include "ModioSubsystem.h"
 
 FModioAsyncRequest_GetAllMods::FModioAsyncRequest_GetAllMods( FModioSubsystem *Modio, FModioModArrayDelegate Delegate ) :
   FModioAsyncRequest( Modio ),
+  Fields( EModioModFields::All ),
   ResponseDelegate( Delegate )
 {
 }
 
+FModioAsyncRequest_GetAllMods::FModioAsyncRequest_GetAllMods( FModioSubsystem *Modio, FModioModViewArrayDelegate Delegate ) :
+  FModioAsyncRequest( Modio ),
+  Fields( EModioModFields::All ),
+  ViewDelegate( Delegate )
+{
+}
+
 void FModioAsyncRequest_GetAllMods::Response(void *Object, ModioResponse ModioResponse, ModioMod *ModioMods, u32 ModioModsSize)
 {
+  FModioAsyncRequest_GetAllMods* ThisPointer = (FModioAsyncRequest_GetAllMods*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
-  FModioAsyncRequest_GetAllMods* ThisPointer = (FModioAsyncRequest_GetAllMods*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response, ConvertToTArrayMods(ModioMods, ModioModsSize) );
-  
-  ThisPointer->Done();
+  if( ThisPointer->ViewDelegate.IsBound() )
+  {
+    TArray<FModioModView> Views = FModioModView::MakeViews( ModioMods, ModioModsSize );
+
+    ThisPointer->Deliver( Response, [ThisPointer, Response, Views = MoveTemp( Views )]()
+    {
+      ThisPointer->DispatchToAll<FModioAsyncRequest_GetAllMods>( [&]( FModioAsyncRequest_GetAllMods* Request )
+      {
+        Request->ViewDelegate.ExecuteIfBound( Response, Views );
+      });
+    });
+    return;
+  }
+
+  // Copied while the SDK lock is held and converted after, the game thread can call the SDK meanwhile
+  TSharedRef<FModioModArrayCopy, ESPMode::ThreadSafe> Copy = MakeShared<FModioModArrayCopy, ESPMode::ThreadSafe>( ModioMods, ModioModsSize );
+  ThisPointer->ConvertAfterSdkLock( [ThisPointer, Response, Copy]()
+  {
+    TArray<FModioMod> Mods = ConvertToTArrayMods( Copy->GetData(), Copy->Num(), ThisPointer->Fields );
+
+    ThisPointer->Deliver( Response, [ThisPointer, Response, Mods = MoveTemp( Mods )]() mutable
+    {
+      TSharedRef<const TArray<FModioMod>> Cached = ThisPointer->ModioSubsystem->CacheResponse( ThisPointer, Response, MoveTemp( Mods ) );
+      if( ThisPointer->Fields == EModioModFields::All )
+      {
+        ThisPointer->ModioSubsystem->NotifyModsReceived( *Cached );
+      }
+      ThisPointer->DispatchToAll<FModioAsyncRequest_GetAllMods>( [&]( FModioAsyncRequest_GetAllMods* Request )
+      {
+        Request->ResponseDelegate.ExecuteIfBound( Response, *Cached );
+      });
+    });
+  });
 }
\ No newline at end of file
@@ -12,14 +12,20 @@ FModioAsyncRequest_GetAuthenticatedUser::FModioAsyncRequest_GetAuthenticatedUser
 
 void FModioAsyncRequest_GetAuthenticatedUser::Response(void *Object, ModioResponse ModioResponse, ModioUser ModioUser)
 {
+  FModioAsyncRequest_GetAuthenticatedUser* ThisPointer = (FModioAsyncRequest_GetAuthenticatedUser*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
   FModioUser User;
   InitializeUser( User, ModioUser );
 
-  FModioAsyncRequest_GetAuthenticatedUser* ThisPointer = (FModioAsyncRequest_GetAuthenticatedUser*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response, User );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response, User = MoveTemp( User )]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response, User );
+  });
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 // Released under MIT.
 
 #include "AsyncRequest/ModioAsyncRequest_GetGame.h"
+#include "ModioSubsystem.h"
 
 FModioAsyncRequest_GetGame::FModioAsyncRequest_GetGame(FModioSubsystem* Modio, FModioGameDelegate Delegate) :
   FModioAsyncRequest(Modio),
@@ -11,14 +12,28 @@ FModioAsyncRequest_GetGame::FModioAsyncRequest_GetGame(FModioSubsystem* Modio, F
 
 void FModioAsyncRequest_GetGame::Response(void* Object, ModioResponse ModioResponse, ModioGame InModioGame)
 {
+  FModioAsyncRequest_GetGame* ThisPointer = (FModioAsyncRequest_GetGame*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse(Response, ModioResponse);
 
   FModioGame Game;
   InitializeGame(Game, InModioGame);
 
-  FModioAsyncRequest_GetGame* ThisPointer = (FModioAsyncRequest_GetGame*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound(Response, Game);
-
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response, Game = MoveTemp( Game )]() mutable
+  {
+    TSharedRef<const FModioGame> Cached = ThisPointer->ModioSubsystem->CacheResponse( ThisPointer, Response, MoveTemp( Game ) );
+    if( Response.Code >= 200 && Response.Code < 300 )
+    {
+      ThisPointer->ModioSubsystem->NotifyGameReceived( *Cached );
+    }
+    ThisPointer->DispatchToAll<FModioAsyncRequest_GetGame>([&](FModioAsyncRequest_GetGame* Request)
+    {
+      Request->ResponseDelegate.ExecuteIfBound(Response, *Cached);
+    });
+  });
 }
\ No newline at end of file
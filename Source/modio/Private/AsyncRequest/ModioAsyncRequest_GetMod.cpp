@@ -2,23 +2,50 @@
 // Released under MIT.
 
 #include "AsyncRequest/ModioAsyncRequest_GetMod.h"
+#include "ModioModArrayCopy.h"
+#include "ModioSubsystem.h"
 
 FModioAsyncRequest_GetMod::FModioAsyncRequest_GetMod( FModioSubsystem *Modio, FModioModDelegate Delegate ) :
   FModioAsyncRequest( Modio ),
+  ModId( 0 ),
+  Fields( EModioModFields::All ),
   ResponseDelegate( Delegate )
 {
 }
 
 void FModioAsyncRequest_GetMod::Response(void *Object, ModioResponse ModioResponse, ModioMod ModioMod )
 {
+  FModioAsyncRequest_GetMod* ThisPointer = (FModioAsyncRequest_GetMod*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
-  FModioMod Mod;
-  InitializeMod( Mod, ModioMod );
+  // Copied while the SDK lock is held and converted after, the game thread can call the SDK meanwhile
+  TSharedRef<FModioModArrayCopy, ESPMode::ThreadSafe> Copy = MakeShared<FModioModArrayCopy, ESPMode::ThreadSafe>( &ModioMod, 1 );
+  ThisPointer->ConvertAfterSdkLock( [ThisPointer, Response, Copy]()
+  {
+    FModioMod Mod;
+    InitializeMod( Mod, *Copy->GetData(), ThisPointer->Fields );
+    ThisPointer->DeliverResponse( Response, MoveTemp( Mod ) );
+  });
+}
 
-  FModioAsyncRequest_GetMod* ThisPointer = (FModioAsyncRequest_GetMod*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response, Mod );
-  
-  ThisPointer->Done();
-}
\ No newline at end of file
+void FModioAsyncRequest_GetMod::DeliverResponse( const FModioResponse &Response, FModioMod Mod )
+{
+  Deliver( Response, [this, Response, Mod = MoveTemp( Mod )]() mutable
+  {
+    TSharedRef<const FModioMod> Cached = ModioSubsystem->CacheResponse( this, Response, MoveTemp( Mod ) );
+    if( Fields == EModioModFields::All && Response.Code >= 200 && Response.Code < 300 )
+    {
+      ModioSubsystem->NotifyModsReceived( MakeArrayView( &Cached.Get(), 1 ) );
+    }
+    DispatchToAll<FModioAsyncRequest_GetMod>( [&]( FModioAsyncRequest_GetMod* Request )
+    {
+      Request->ResponseDelegate.ExecuteIfBound( Response, *Cached );
+    });
+  });
+}
@@ -0,0 +1,100 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#include "AsyncRequest/ModioAsyncRequest_GetModBatch.h"
+#include "AsyncRequest/ModioAsyncRequest_GetMod.h"
+#include "ModioModArrayCopy.h"
+#include "ModioSubsystem.h"
+
+FModioAsyncRequest_GetModBatch::FModioAsyncRequest_GetModBatch( FModioSubsystem *Modio, const TArray<FModioAsyncRequestHandle> &BatchedRequests, const TArray<uint32> &BatchedModIds, const TArray<EModioModFields> &BatchedFields ) :
+  FModioAsyncRequest( Modio ),
+  BatchedRequests( BatchedRequests ),
+  BatchedModIds( BatchedModIds ),
+  BatchedFields( BatchedFields )
+{
+  check( BatchedRequests.Num() == BatchedModIds.Num() && BatchedRequests.Num() == BatchedFields.Num() );
+}
+
+void FModioAsyncRequest_GetModBatch::Response(void *Object, ModioResponse ModioResponse, ModioMod *ModioMods, u32 ModioModsSize)
+{
+  FModioAsyncRequest_GetModBatch* ThisPointer = (FModioAsyncRequest_GetModBatch*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    // Batch handles aren't handed out and the GetMod calls in it are cancelled one by one, so nothing waits on an abandoned batch
+    return;
+  }
+
+  FModioResponse BatchResponse;
+  InitializeResponse( BatchResponse, ModioResponse );
+  bool bBatchSucceeded = BatchResponse.Code >= 200 && BatchResponse.Code < 300;
+
+  // Copied while the SDK lock is held and converted after, the game thread can call the SDK meanwhile
+  TSharedRef<FModioModArrayCopy, ESPMode::ThreadSafe> Copy = MakeShared<FModioModArrayCopy, ESPMode::ThreadSafe>( ModioMods, ModioModsSize );
+  ThisPointer->ConvertAfterSdkLock( [ThisPointer, BatchResponse, bBatchSucceeded, Copy]()
+  {
+    TMap<uint32, const ModioMod*> ModsById;
+    ModsById.Reserve( Copy->Num() );
+    for( u32 i = 0; i < Copy->Num(); i++ )
+    {
+      ModsById.Add( Copy->GetData()[i].id, &Copy->GetData()[i] );
+    }
+
+    TArray<FModioResponse> Responses;
+    TArray<FModioMod> Mods;
+    TBitArray<> Missing( false, ThisPointer->BatchedModIds.Num() );
+    Responses.Reserve( ThisPointer->BatchedModIds.Num() );
+    Mods.SetNum( ThisPointer->BatchedModIds.Num() );
+    for( int32 i = 0; i < ThisPointer->BatchedModIds.Num(); i++ )
+    {
+      uint32 ModId = ThisPointer->BatchedModIds[i];
+      FModioResponse& Response = Responses.Add_GetRef( BatchResponse );
+      if( !bBatchSucceeded )
+      {
+        // The whole batch failed, so every GetMod fails the same way
+        continue;
+      }
+
+      Response.ResultOffset = 0;
+      if( const ModioMod* const* FoundMod = ModsById.Find( ModId ) )
+      {
+        Response.ResultCount = 1;
+        Response.ResultTotal = 1;
+        Response.ResultLimit = 1;
+        InitializeMod( Mods[i], **FoundMod, ThisPointer->BatchedFields[i] );
+      }
+      else
+      {
+        // Queries leave out hidden and not yet live mods the single mod endpoint still returns to their owners
+        Missing[i] = true;
+      }
+    }
+
+    ThisPointer->Deliver( BatchResponse, [ThisPointer, Responses = MoveTemp( Responses ), Mods = MoveTemp( Mods ), Missing = MoveTemp( Missing )]() mutable
+    {
+      for( int32 i = 0; i < ThisPointer->BatchedRequests.Num(); i++ )
+      {
+        FModioAsyncRequest_GetMod* Request = static_cast<FModioAsyncRequest_GetMod*>( ThisPointer->ModioSubsystem->FindAsyncRequest( ThisPointer->BatchedRequests[i] ) );
+        if( !Request )
+        {
+          continue;
+        }
+
+        if( Missing[i] )
+        {
+          if( Request->FinishIfCancelled() )
+          {
+            continue;
+          }
+
+          // The single mod endpoint gives the real answer, a 404 for mods that are really gone
+          ThisPointer->ModioSubsystem->IssueGetMod( Request );
+        }
+        else
+        {
+          Request->TakeNetworkTimings( *ThisPointer );
+          Request->DeliverResponse( Responses[i], MoveTemp( Mods[i] ) );
+        }
+      }
+    });
+  });
+}
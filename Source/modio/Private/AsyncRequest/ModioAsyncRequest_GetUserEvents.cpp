@@ -12,11 +12,19 @@ FModioAsyncRequest_GetUserEvents::FModioAsyncRequest_GetUserEvents( FModioSubsys
 
 void FModioAsyncRequest_GetUserEvents::Response(void *Object, ModioResponse ModioResponse, ModioUserEvent *ModioUserEvents, u32 ModioUserEventsSize)
 {
+  FModioAsyncRequest_GetUserEvents* ThisPointer = (FModioAsyncRequest_GetUserEvents*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
-  FModioAsyncRequest_GetUserEvents* ThisPointer = (FModioAsyncRequest_GetUserEvents*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response, ConvertToTArrayUserEvents(ModioUserEvents, ModioUserEventsSize) );
-  
-  ThisPointer->Done();
+  TArray<FModioUserEvent> UserEvents = ConvertToTArrayUserEvents(ModioUserEvents, ModioUserEventsSize);
+
+  ThisPointer->Deliver( Response, [ThisPointer, Response, UserEvents = MoveTemp( UserEvents )]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response, UserEvents );
+  });
 }
\ No newline at end of file
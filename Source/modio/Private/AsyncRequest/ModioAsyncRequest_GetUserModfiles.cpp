@@ -12,11 +12,19 @@ FModioAsyncRequest_GetUserModfiles::FModioAsyncRequest_GetUserModfiles( FModioSu
 
 void FModioAsyncRequest_GetUserModfiles::Response(void *Object, ModioResponse ModioResponse, ModioModfile *ModioModfiles, u32 ModioModfilesSize)
 {
+  FModioAsyncRequest_GetUserModfiles* ThisPointer = (FModioAsyncRequest_GetUserModfiles*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
-  FModioAsyncRequest_GetUserModfiles* ThisPointer = (FModioAsyncRequest_GetUserModfiles*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response, ConvertToTArrayModfiles(ModioModfiles, ModioModfilesSize) );
-  
-  ThisPointer->Done();
+  TArray<FModioModfile> Modfiles = ConvertToTArrayModfiles(ModioModfiles, ModioModfilesSize);
+
+  ThisPointer->Deliver( Response, [ThisPointer, Response, Modfiles = MoveTemp( Modfiles )]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response, Modfiles );
+  });
 }
\ No newline at end of file
@@ -12,11 +12,19 @@ FModioAsyncRequest_GetUserRatings::FModioAsyncRequest_GetUserRatings( FModioSubs
 
 void FModioAsyncRequest_GetUserRatings::Response(void *Object, ModioResponse ModioResponse, ModioRating *ModioRatings, u32 ModioRatingsSize)
 {
+  FModioAsyncRequest_GetUserRatings* ThisPointer = (FModioAsyncRequest_GetUserRatings*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
-  FModioAsyncRequest_GetUserRatings* ThisPointer = (FModioAsyncRequest_GetUserRatings*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response, ConvertToTArrayRatings(ModioRatings, ModioRatingsSize) );
-  
-  ThisPointer->Done();
+  TArray<FModioRating> Ratings = ConvertToTArrayRatings(ModioRatings, ModioRatingsSize);
+
+  ThisPointer->Deliver( Response, [ThisPointer, Response, Ratings = MoveTemp( Ratings )]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response, Ratings );
+  });
 }
\ No newline at end of file
@@ -11,11 +11,17 @@ FModioAsyncRequest_OculusAuth::FModioAsyncRequest_OculusAuth( FModioSubsystem *M
 
 void FModioAsyncRequest_OculusAuth::Response( void *Object, ModioResponse ModioResponse )
 {
+  FModioAsyncRequest_OculusAuth* ThisPointer = (FModioAsyncRequest_OculusAuth*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
   
-  FModioAsyncRequest_OculusAuth* ThisPointer = (FModioAsyncRequest_OculusAuth*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
+  });
 }
\ No newline at end of file
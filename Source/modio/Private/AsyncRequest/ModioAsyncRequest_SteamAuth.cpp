@@ -11,11 +11,17 @@ FModioAsyncRequest_SteamAuth::FModioAsyncRequest_SteamAuth( FModioSubsystem *Mod
 
 void FModioAsyncRequest_SteamAuth::Response( void *Object, ModioResponse ModioResponse )
 {
+  FModioAsyncRequest_SteamAuth* ThisPointer = (FModioAsyncRequest_SteamAuth*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
   
-  FModioAsyncRequest_SteamAuth* ThisPointer = (FModioAsyncRequest_SteamAuth*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
+  });
 }
\ No newline at end of file
@@ -11,11 +11,17 @@ FModioAsyncRequest_SubmitReport::FModioAsyncRequest_SubmitReport( FModioSubsyste
 
 void FModioAsyncRequest_SubmitReport::Response( void *Object, ModioResponse ModioResponse )
 {
+  FModioAsyncRequest_SubmitReport* ThisPointer = (FModioAsyncRequest_SubmitReport*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
   
-  FModioAsyncRequest_SubmitReport* ThisPointer = (FModioAsyncRequest_SubmitReport*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
+  });
 }
\ No newline at end of file
@@ -11,14 +11,20 @@ FModioAsyncRequest_SubscribeToMod::FModioAsyncRequest_SubscribeToMod( FModioSubs
 
 void FModioAsyncRequest_SubscribeToMod::Response( void *Object, ModioResponse ModioResponse, ModioMod ModioMod )
 {
+  FModioAsyncRequest_SubscribeToMod* ThisPointer = (FModioAsyncRequest_SubscribeToMod*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
 
   FModioMod Mod;
   InitializeMod( Mod, ModioMod );
   
-  FModioAsyncRequest_SubscribeToMod* ThisPointer = (FModioAsyncRequest_SubscribeToMod*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response, Mod );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response, Mod = MoveTemp( Mod )]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response, Mod );
+  });
 }
\ No newline at end of file
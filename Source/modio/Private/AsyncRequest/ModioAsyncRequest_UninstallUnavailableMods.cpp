@@ -3,27 +3,25 @@
 
 #include "AsyncRequest/ModioAsyncRequest_UninstallUnavailableMods.h"
 #include "ModioUE4Utility.h"
+#include "ModioSubsystem.h"
 
 FModioAsyncRequest_UninstallUnavailableMods::FModioAsyncRequest_UninstallUnavailableMods( FModioSubsystem *Modio, FModioGenericDelegate Delegate, int32 PendingCalls ) :
   FModioAsyncRequest( Modio ),
+  bAnyCallFailed( false ),
   ResponseDelegate( Delegate )
 {
   this->PendingCalls = PendingCalls;
 }
 
-TArray<int32> getInstalledMods()
+void FModioAsyncRequest_UninstallUnavailableMods::FinishWithoutCalls()
 {
-  TArray<int32> InstalledMods;
-  u32 installed_mods_count = modioGetAllInstalledModsCount();
-  ModioInstalledMod *modio_installed_mods = (ModioInstalledMod *)malloc(installed_mods_count * sizeof(*modio_installed_mods));
-  modioGetAllInstalledMods(modio_installed_mods);
-  for (u32 i = 0; i < installed_mods_count; i++)
+  FModioResponse Response = FModioResponse();
+  Response.Code = 200;
+
+  Deliver( Response, [this, Response]()
   {
-    InstalledMods.Add(modio_installed_mods[i].mod.id);
-    modioFreeInstalledMod(&modio_installed_mods[i]);
-  }
-  free(modio_installed_mods);
-  return InstalledMods;
+    ResponseDelegate.ExecuteIfBound( Response );
+  });
 }
 
 void FModioAsyncRequest_UninstallUnavailableMods::Response(void *Object, ModioResponse ModioResponse, ModioMod *ModioMods, u32 ModioModsSize)
@@ -32,6 +30,7 @@ void FModioAsyncRequest_UninstallUnavailableMods::Response(void *Object, ModioRe
   FModioAsyncRequest_UninstallUnavailableMods* ThisPointer = (FModioAsyncRequest_UninstallUnavailableMods*)Object;
 
   ThisPointer->PendingCalls--;
+  ThisPointer->bAnyCallFailed |= ModioResponse.code < 200 || ModioResponse.code >= 300;
   for(int32 i=0; i<(int32)ModioModsSize; i++)
   {
     ThisPointer->AvailableMods.Push(ModioMods[i].id);
@@ -39,29 +38,42 @@ void FModioAsyncRequest_UninstallUnavailableMods::Response(void *Object, ModioRe
   
   if(ThisPointer->PendingCalls == 0)
   {
+    // Every chunk calls back into this request, so it can only finish with the last one
+    if( ThisPointer->FinishIfAbandoned() )
+    {
+      return;
+    }
+
     UE_LOG(LogTemp, Warning, TEXT("[mod.io] FModioAsyncRequest_UninstallUnavailableMods response returned"));
-    for(auto InstalledMod : getInstalledMods())
+    TArray<int32> UnavailableMods;
+    for(auto InstalledMod : ThisPointer->InstalledMods)
     {
-      bool IsAvailable = false;
-      for(auto AvailableMod : ThisPointer->AvailableMods)
-      {
-        if(InstalledMod == AvailableMod)
-          IsAvailable = true;
-      }
-      if(!IsAvailable)
+      if(!ThisPointer->AvailableMods.Contains(InstalledMod))
       {
         UE_LOG(LogTemp, Warning, TEXT("[mod.io] Mod %i is unavailable, will be uninstalled"), InstalledMod);
-        modioUninstallMod((u32)InstalledMod);
+        UnavailableMods.Add(InstalledMod);
       }else
       {
         UE_LOG(LogTemp, Warning, TEXT("[mod.io] Mod %i is available"), InstalledMod);
       }
     }
+
     FModioResponse Response;
     InitializeResponse( Response, ModioResponse );
 
-    ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
-    
-    ThisPointer->Done();
+    // Uninstalled on the game thread, where the installed mods index lives, and not at all if the request gets
+    // cancelled first. A failed call tells nothing about it's mods, so nothing is uninstalled then
+    bool bAnyCallFailed = ThisPointer->bAnyCallFailed;
+    ThisPointer->Deliver( Response, [ThisPointer, Response, UnavailableMods, bAnyCallFailed]()
+    {
+      if( !bAnyCallFailed )
+      {
+        for( int32 ModId : UnavailableMods )
+        {
+          ThisPointer->ModioSubsystem->UninstallMod( ModId );
+        }
+      }
+      ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
+    });
   }
 }
\ No newline at end of file
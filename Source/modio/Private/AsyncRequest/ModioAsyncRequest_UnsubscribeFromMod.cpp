@@ -11,11 +11,17 @@ FModioAsyncRequest_UnsubscribeFromMod::FModioAsyncRequest_UnsubscribeFromMod( FM
 
 void FModioAsyncRequest_UnsubscribeFromMod::Response( void *Object, ModioResponse ModioResponse )
 {
+  FModioAsyncRequest_UnsubscribeFromMod* ThisPointer = (FModioAsyncRequest_UnsubscribeFromMod*)Object;
+  if( ThisPointer->FinishIfAbandoned() )
+  {
+    return;
+  }
+
   FModioResponse Response;
   InitializeResponse( Response, ModioResponse );
   
-  FModioAsyncRequest_UnsubscribeFromMod* ThisPointer = (FModioAsyncRequest_UnsubscribeFromMod*)Object;
-  ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
-  
-  ThisPointer->Done();
+  ThisPointer->Deliver( Response, [ThisPointer, Response]()
+  {
+    ThisPointer->ResponseDelegate.ExecuteIfBound( Response );
+  });
 }
\ No newline at end of file
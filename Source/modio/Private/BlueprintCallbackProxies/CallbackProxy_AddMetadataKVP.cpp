@@ -26,7 +26,7 @@ void UCallbackProxy_AddMetadataKVP::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->AddMetadataKVP( ModId, MetadataKVP, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_AddMetadataKVP::OnAddMetadataKVPDelegate ) );
+    TrackRequest( Modio, Modio->AddMetadataKVP( ModId, MetadataKVP, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_AddMetadataKVP::OnAddMetadataKVPDelegate ) ) );
   }
   else
   {
@@ -26,7 +26,7 @@ void UCallbackProxy_AddMod::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->AddMod( this->ModCreator, FModioModDelegate::CreateUObject( this, &UCallbackProxy_AddMod::OnAddModDelegate ) );
+    TrackRequest( Modio, Modio->AddMod( this->ModCreator, FModioModDelegate::CreateUObject( this, &UCallbackProxy_AddMod::OnAddModDelegate ) ) );
   }
   else
   {
@@ -26,7 +26,7 @@ void UCallbackProxy_AddModDependencies::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->AddModDependencies( ModId, Dependencies, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_AddModDependencies::OnAddModDependenciesDelegate ) );
+    TrackRequest( Modio, Modio->AddModDependencies( ModId, Dependencies, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_AddModDependencies::OnAddModDependenciesDelegate ) ) );
   }
   else
   {
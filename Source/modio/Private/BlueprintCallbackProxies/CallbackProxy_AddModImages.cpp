@@ -26,7 +26,7 @@ void UCallbackProxy_AddModImages::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->AddModImages( this->ModId, this->ImagePaths, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_AddModImages::OnAddModImagesDelegate ) );
+    TrackRequest( Modio, Modio->AddModImages( this->ModId, this->ImagePaths, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_AddModImages::OnAddModImagesDelegate ) ) );
   }
   else
   {
@@ -26,7 +26,7 @@ void UCallbackProxy_AddModLogo::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->AddModLogo( ModId, LogoPath, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_AddModLogo::OnAddModLogoDelegate ) );
+    TrackRequest( Modio, Modio->AddModLogo( ModId, LogoPath, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_AddModLogo::OnAddModLogoDelegate ) ) );
   }
   else
   {
@@ -27,7 +27,7 @@ void UCallbackProxy_AddModRating::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->AddModRating( this->ModId, this->IsRatingPositive, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_AddModRating::OnAddModRatingDelegate ) );
+    TrackRequest( Modio, Modio->AddModRating( this->ModId, this->IsRatingPositive, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_AddModRating::OnAddModRatingDelegate ) ) );
   }
   else
   {
@@ -26,7 +26,7 @@ void UCallbackProxy_AddModSketchfabLinks::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->AddModSketchfabLinks( this->ModId, this->SketchfabLinks, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_AddModSketchfabLinks::OnAddModSketchfabLinksDelegate ) );
+    TrackRequest( Modio, Modio->AddModSketchfabLinks( this->ModId, this->SketchfabLinks, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_AddModSketchfabLinks::OnAddModSketchfabLinksDelegate ) ) );
   }
   else
   {
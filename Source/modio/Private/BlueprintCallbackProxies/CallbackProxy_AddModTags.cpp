@@ -26,7 +26,7 @@ void UCallbackProxy_AddModTags::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->AddModTags( ModId, Tags, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_AddModTags::OnAddModTagsDelegate ) );
+    TrackRequest( Modio, Modio->AddModTags( ModId, Tags, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_AddModTags::OnAddModTagsDelegate ) ) );
   }
   else
   {
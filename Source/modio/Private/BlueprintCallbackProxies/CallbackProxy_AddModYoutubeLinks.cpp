@@ -26,7 +26,7 @@ void UCallbackProxy_AddModYoutubeLinks::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->AddModYoutubeLinks( this->ModId, this->YoutubeLinks, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_AddModYoutubeLinks::OnAddModYoutubeLinksDelegate ) );
+    TrackRequest( Modio, Modio->AddModYoutubeLinks( this->ModId, this->YoutubeLinks, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_AddModYoutubeLinks::OnAddModYoutubeLinksDelegate ) ) );
   }
   else
   {
@@ -26,7 +26,7 @@ void UCallbackProxy_DeleteMetadataKVP::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->DeleteMetadataKVP( ModId, MetadataKVP, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_DeleteMetadataKVP::OnDeleteMetadataKVPDelegate ) );
+    TrackRequest( Modio, Modio->DeleteMetadataKVP( ModId, MetadataKVP, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_DeleteMetadataKVP::OnDeleteMetadataKVPDelegate ) ) );
   }
   else
   {
@@ -26,7 +26,7 @@ void UCallbackProxy_DeleteModDependencies::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->DeleteModDependencies( ModId, Dependencies, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_DeleteModDependencies::OnDeleteModDependenciesDelegate ) );
+    TrackRequest( Modio, Modio->DeleteModDependencies( ModId, Dependencies, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_DeleteModDependencies::OnDeleteModDependenciesDelegate ) ) );
   }
   else
   {
@@ -26,7 +26,7 @@ void UCallbackProxy_DeleteModImages::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->DeleteModImages( this->ModId, this->ImagePaths, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_DeleteModImages::OnDeleteModImagesDelegate ) );
+    TrackRequest( Modio, Modio->DeleteModImages( this->ModId, this->ImagePaths, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_DeleteModImages::OnDeleteModImagesDelegate ) ) );
   }
   else
   {
@@ -26,7 +26,7 @@ void UCallbackProxy_DeleteModSketchfabLinks::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->DeleteModSketchfabLinks( this->ModId, this->SketchfabLinks, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_DeleteModSketchfabLinks::OnDeleteModSketchfabLinksDelegate ) );
+    TrackRequest( Modio, Modio->DeleteModSketchfabLinks( this->ModId, this->SketchfabLinks, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_DeleteModSketchfabLinks::OnDeleteModSketchfabLinksDelegate ) ) );
   }
   else
   {
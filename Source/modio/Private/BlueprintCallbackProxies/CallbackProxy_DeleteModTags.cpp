@@ -26,7 +26,7 @@ void UCallbackProxy_DeleteModTags::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->DeleteModTags( ModId, Tags, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_DeleteModTags::OnDeleteModTagsDelegate ) );
+    TrackRequest( Modio, Modio->DeleteModTags( ModId, Tags, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_DeleteModTags::OnDeleteModTagsDelegate ) ) );
   }
   else
   {
@@ -26,7 +26,7 @@ void UCallbackProxy_DeleteModYoutubeLinks::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->DeleteModYoutubeLinks( this->ModId, this->YoutubeLinks, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_DeleteModYoutubeLinks::OnDeleteModYoutubeLinksDelegate ) );
+    TrackRequest( Modio, Modio->DeleteModYoutubeLinks( this->ModId, this->YoutubeLinks, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_DeleteModYoutubeLinks::OnDeleteModYoutubeLinksDelegate ) ) );
   }
   else
   {
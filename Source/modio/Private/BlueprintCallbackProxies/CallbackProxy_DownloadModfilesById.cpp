@@ -25,7 +25,7 @@ void UCallbackProxy_DownloadModfilesById::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->DownloadModfilesById( ModIds, FModioBooleanDelegate::CreateUObject( this, &UCallbackProxy_DownloadModfilesById::OnDownloadModfilesByIdDelegate ) );
+    TrackRequest( Modio, Modio->DownloadModfilesById( ModIds, FModioBooleanDelegate::CreateUObject( this, &UCallbackProxy_DownloadModfilesById::OnDownloadModfilesByIdDelegate ) ) );
   }
   else
   {
@@ -25,7 +25,7 @@ void UCallbackProxy_DownloadSubscribedModfiles::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->DownloadSubscribedModfiles( UninstallUnsubscribed, FModioBooleanDelegate::CreateUObject( this, &UCallbackProxy_DownloadSubscribedModfiles::OnDownloadSubscribedModfilesDelegate ) );
+    TrackRequest( Modio, Modio->DownloadSubscribedModfiles( UninstallUnsubscribed, FModioBooleanDelegate::CreateUObject( this, &UCallbackProxy_DownloadSubscribedModfiles::OnDownloadSubscribedModfilesDelegate ) ) );
   }
   else
   {
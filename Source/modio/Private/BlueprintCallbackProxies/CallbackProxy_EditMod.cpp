@@ -27,7 +27,7 @@ void UCallbackProxy_EditMod::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->EditMod( this->ModId, this->ModEditor, FModioModDelegate::CreateUObject( this, &UCallbackProxy_EditMod::OnEditModDelegate ) );
+    TrackRequest( Modio, Modio->EditMod( this->ModId, this->ModEditor, FModioModDelegate::CreateUObject( this, &UCallbackProxy_EditMod::OnEditModDelegate ) ) );
   }
   else
   {
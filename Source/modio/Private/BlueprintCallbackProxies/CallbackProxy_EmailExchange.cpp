@@ -25,7 +25,7 @@ void UCallbackProxy_EmailExchange::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->EmailExchange( SecurityCode, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_EmailExchange::OnEmailExchangeDelegate ) );
+    TrackRequest( Modio, Modio->EmailExchange( SecurityCode, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_EmailExchange::OnEmailExchangeDelegate ) ) );
   }
   else
   {
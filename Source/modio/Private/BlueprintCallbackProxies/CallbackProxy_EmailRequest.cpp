@@ -25,7 +25,7 @@ void UCallbackProxy_EmailRequest::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->EmailRequest( Email, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_EmailRequest::OnEmailRequestDelegate ) );
+    TrackRequest( Modio, Modio->EmailRequest( Email, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_EmailRequest::OnEmailRequestDelegate ) ) );
   }
   else
   {
@@ -25,7 +25,7 @@ void UCallbackProxy_GetAllMetadataKVP::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->GetAllMetadataKVP( ModId, FModioMetadataKVPArrayDelegate::CreateUObject( this, &UCallbackProxy_GetAllMetadataKVP::OnGetAllMetadataKVPDelegate ) );
+    TrackRequest( Modio, Modio->GetAllMetadataKVP( ModId, FModioMetadataKVPArrayDelegate::CreateUObject( this, &UCallbackProxy_GetAllMetadataKVP::OnGetAllMetadataKVPDelegate ) ) );
   }
   else
   {
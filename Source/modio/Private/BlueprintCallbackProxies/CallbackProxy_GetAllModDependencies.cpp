@@ -25,7 +25,7 @@ void UCallbackProxy_GetAllModDependencies::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->GetAllModDependencies( ModId, FModioModDependencyArrayDelegate::CreateUObject( this, &UCallbackProxy_GetAllModDependencies::OnGetAllModDependenciesDelegate ) );
+    TrackRequest( Modio, Modio->GetAllModDependencies( ModId, FModioModDependencyArrayDelegate::CreateUObject( this, &UCallbackProxy_GetAllModDependencies::OnGetAllModDependenciesDelegate ) ) );
   }
   else
   {
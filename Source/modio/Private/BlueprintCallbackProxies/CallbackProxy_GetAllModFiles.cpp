@@ -26,7 +26,7 @@ void UCallbackProxy_GetAllModfiles::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get(World);
   if (Modio.IsValid())
   {
-	Modio->GetAllModfiles(this->ModId, FModioModfileArrayDelegate::CreateUObject(this, &UCallbackProxy_GetAllModfiles::OnGetAllModfilesDelegate));
+	TrackRequest( Modio, Modio->GetAllModfiles(this->ModId, FModioModfileArrayDelegate::CreateUObject(this, &UCallbackProxy_GetAllModfiles::OnGetAllModfilesDelegate)) );
   }
   else
   {
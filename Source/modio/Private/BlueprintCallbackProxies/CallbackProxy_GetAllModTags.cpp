@@ -25,7 +25,7 @@ void UCallbackProxy_GetAllModTags::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->GetAllModTags( ModId, FModioModTagArrayDelegate::CreateUObject( this, &UCallbackProxy_GetAllModTags::OnGetAllModTagsDelegate ) );
+    TrackRequest( Modio, Modio->GetAllModTags( ModId, FModioModTagArrayDelegate::CreateUObject( this, &UCallbackProxy_GetAllModTags::OnGetAllModTagsDelegate ) ) );
   }
   else
   {
@@ -10,7 +10,7 @@ UCallbackProxy_GetAllMods::UCallbackProxy_GetAllMods(const FObjectInitializer &O
 {
 }
 
-UCallbackProxy_GetAllMods *UCallbackProxy_GetAllMods::GetAllMods(UObject *WorldContext, FModioFilterCreator Filter, TArray<FString> ModTags, int32 Limit, int32 Offset)
+UCallbackProxy_GetAllMods *UCallbackProxy_GetAllMods::GetAllMods(UObject *WorldContext, FModioFilterCreator Filter, TArray<FString> ModTags, int32 Limit, int32 Offset, FName QuerySlot, int32 Fields, TEnumAsByte<EModioRequestPriority> Priority)
 {
   UCallbackProxy_GetAllMods *Proxy = NewObject<UCallbackProxy_GetAllMods>();
   Proxy->SetFlags(RF_StrongRefOnFrame);
@@ -18,6 +18,9 @@ UCallbackProxy_GetAllMods *UCallbackProxy_GetAllMods::GetAllMods(UObject *WorldC
   Proxy->ModTags = ModTags;
   Proxy->Limit = Limit;
   Proxy->Offset = Offset;
+  Proxy->QuerySlot = QuerySlot;
+  Proxy->Fields = Fields;
+  Proxy->Priority = Priority;
   Proxy->WorldContextObject = WorldContext;
   return Proxy;
 }
@@ -28,7 +31,14 @@ void UCallbackProxy_GetAllMods::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->GetAllMods( this->Filter, this->ModTags, this->Limit, this->Offset, FModioModArrayDelegate::CreateUObject( this, &UCallbackProxy_GetAllMods::OnGetAllModsDelegate ) );
+    EModioModFields ModFields = Fields ? (EModioModFields)Fields : Modio->GetDefaultModFields();
+    FModioRequestPriorityScope PriorityScope( Modio.Get(), Priority );
+    FModioAsyncRequestHandle Handle = Modio->GetAllMods( this->Filter, this->ModTags, this->Limit, this->Offset, ModFields, FModioModArrayDelegate::CreateUObject( this, &UCallbackProxy_GetAllMods::OnGetAllModsDelegate ) );
+    if( !QuerySlot.IsNone() )
+    {
+      Modio->AssignQuerySlot( QuerySlot, Handle );
+    }
+    TrackRequest( Modio, Handle );
   }
   else
   {
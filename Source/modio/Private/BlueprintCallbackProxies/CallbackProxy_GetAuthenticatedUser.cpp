@@ -24,7 +24,7 @@ void UCallbackProxy_GetAuthenticatedUser::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->GetAuthenticatedUser( FModioUserDelegate::CreateUObject( this, &UCallbackProxy_GetAuthenticatedUser::OnGetAuthenticatedUserDelegate ) );
+    TrackRequest( Modio, Modio->GetAuthenticatedUser( FModioUserDelegate::CreateUObject( this, &UCallbackProxy_GetAuthenticatedUser::OnGetAuthenticatedUserDelegate ) ) );
   }
   else
   {
@@ -25,7 +25,7 @@ void UCallbackProxy_GetGame::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get(World);
   if (Modio.IsValid())
   {
-    Modio->GetGame(this->GameId, FModioGameDelegate::CreateUObject(this, &UCallbackProxy_GetGame::OnGetGameDelegate));
+    TrackRequest( Modio, Modio->GetGame(this->GameId, FModioGameDelegate::CreateUObject(this, &UCallbackProxy_GetGame::OnGetGameDelegate)) );
   }
   else
   {
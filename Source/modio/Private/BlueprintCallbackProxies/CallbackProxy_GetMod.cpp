@@ -10,11 +10,13 @@ UCallbackProxy_GetMod::UCallbackProxy_GetMod(const FObjectInitializer &ObjectIni
 {
 }
 
-UCallbackProxy_GetMod *UCallbackProxy_GetMod::GetMod(UObject *WorldContext, int32 ModId)
+UCallbackProxy_GetMod *UCallbackProxy_GetMod::GetMod(UObject *WorldContext, int32 ModId, int32 Fields, TEnumAsByte<EModioRequestPriority> Priority)
 {
 	UCallbackProxy_GetMod *Proxy = NewObject<UCallbackProxy_GetMod>();
   Proxy->SetFlags(RF_StrongRefOnFrame);
   Proxy->ModId = ModId;
+  Proxy->Fields = Fields;
+  Proxy->Priority = Priority;
   Proxy->WorldContextObject = WorldContext;
   return Proxy;
 }
@@ -25,7 +27,9 @@ void UCallbackProxy_GetMod::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->GetMod( this->ModId, FModioModDelegate::CreateUObject( this, &UCallbackProxy_GetMod::OnGetModDelegate ) );
+    EModioModFields ModFields = Fields ? (EModioModFields)Fields : Modio->GetDefaultModFields();
+    FModioRequestPriorityScope PriorityScope( Modio.Get(), Priority );
+    TrackRequest( Modio, Modio->GetMod( this->ModId, ModFields, FModioModDelegate::CreateUObject( this, &UCallbackProxy_GetMod::OnGetModDelegate ) ) );
   }
   else
   {
@@ -27,7 +27,7 @@ void UCallbackProxy_GetUserEvents::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->GetUserEvents( this->Limit, this->Offset, FModioUserEventArrayDelegate::CreateUObject( this, &UCallbackProxy_GetUserEvents::OnGetUserEventsDelegate ) );
+    TrackRequest( Modio, Modio->GetUserEvents( this->Limit, this->Offset, FModioUserEventArrayDelegate::CreateUObject( this, &UCallbackProxy_GetUserEvents::OnGetUserEventsDelegate ) ) );
   }
   else
   {
@@ -11,7 +11,7 @@ UCallbackProxy_GetUserMods::UCallbackProxy_GetUserMods(const FObjectInitializer
 {
 }
 
-UCallbackProxy_GetUserMods *UCallbackProxy_GetUserMods::GetUserMods(UObject *WorldContext, FModioFilterCreator FilterCreator, TArray<FString> ModTags, int32 Limit, int32 Offset)
+UCallbackProxy_GetUserMods *UCallbackProxy_GetUserMods::GetUserMods(UObject *WorldContext, FModioFilterCreator FilterCreator, TArray<FString> ModTags, int32 Limit, int32 Offset, int32 Fields, TEnumAsByte<EModioRequestPriority> Priority)
 {
   UCallbackProxy_GetUserMods *Proxy = NewObject<UCallbackProxy_GetUserMods>();
   Proxy->SetFlags(RF_StrongRefOnFrame);
@@ -19,6 +19,8 @@ UCallbackProxy_GetUserMods *UCallbackProxy_GetUserMods::GetUserMods(UObject *Wor
   Proxy->ModTags = ModTags;
   Proxy->Limit = Limit;
   Proxy->Offset = Offset;
+  Proxy->Fields = Fields;
+  Proxy->Priority = Priority;
   Proxy->WorldContextObject = WorldContext;
   return Proxy;
 }
@@ -29,7 +31,9 @@ void UCallbackProxy_GetUserMods::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->GetUserMods( this->FilterCreator, this->ModTags, this->Limit, this->Offset, FModioModArrayDelegate::CreateUObject( this, &UCallbackProxy_GetUserMods::OnGetUserModsDelegate ) );
+    EModioModFields ModFields = Fields ? (EModioModFields)Fields : Modio->GetDefaultModFields();
+    FModioRequestPriorityScope PriorityScope( Modio.Get(), Priority );
+    TrackRequest( Modio, Modio->GetUserMods( this->FilterCreator, this->ModTags, this->Limit, this->Offset, ModFields, FModioModArrayDelegate::CreateUObject( this, &UCallbackProxy_GetUserMods::OnGetUserModsDelegate ) ) );
   }
   else
   {
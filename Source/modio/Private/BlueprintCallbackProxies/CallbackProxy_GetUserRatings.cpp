@@ -27,7 +27,7 @@ void UCallbackProxy_GetUserRatings::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->GetUserRatings( this->Limit, this->Offset, FModioRatingArrayDelegate::CreateUObject( this, &UCallbackProxy_GetUserRatings::OnGetUserRatingsDelegate ) );
+    TrackRequest( Modio, Modio->GetUserRatings( this->Limit, this->Offset, FModioRatingArrayDelegate::CreateUObject( this, &UCallbackProxy_GetUserRatings::OnGetUserRatingsDelegate ) ) );
   }
   else
   {
@@ -11,7 +11,7 @@ UCallbackProxy_GetUserSubscriptions::UCallbackProxy_GetUserSubscriptions(const F
 {
 }
 
-UCallbackProxy_GetUserSubscriptions *UCallbackProxy_GetUserSubscriptions::GetUserSubscriptions(UObject *WorldContext, FModioFilterCreator FilterCreator, TArray<FString> ModTags, int32 Limit, int32 Offset)
+UCallbackProxy_GetUserSubscriptions *UCallbackProxy_GetUserSubscriptions::GetUserSubscriptions(UObject *WorldContext, FModioFilterCreator FilterCreator, TArray<FString> ModTags, int32 Limit, int32 Offset, int32 Fields, TEnumAsByte<EModioRequestPriority> Priority)
 {
   UCallbackProxy_GetUserSubscriptions *Proxy = NewObject<UCallbackProxy_GetUserSubscriptions>();
   Proxy->SetFlags(RF_StrongRefOnFrame);
@@ -19,6 +19,8 @@ UCallbackProxy_GetUserSubscriptions *UCallbackProxy_GetUserSubscriptions::GetUse
   Proxy->ModTags = ModTags;
   Proxy->Limit = Limit;
   Proxy->Offset = Offset;
+  Proxy->Fields = Fields;
+  Proxy->Priority = Priority;
   Proxy->WorldContextObject = WorldContext;
   return Proxy;
 }
@@ -29,7 +31,9 @@ void UCallbackProxy_GetUserSubscriptions::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->GetUserSubscriptions( this->FilterCreator, this->ModTags, this->Limit, this->Offset, FModioModArrayDelegate::CreateUObject( this, &UCallbackProxy_GetUserSubscriptions::OnGetUserSubscriptionsDelegate ) );
+    EModioModFields ModFields = Fields ? (EModioModFields)Fields : Modio->GetDefaultModFields();
+    FModioRequestPriorityScope PriorityScope( Modio.Get(), Priority );
+    TrackRequest( Modio, Modio->GetUserSubscriptions( this->FilterCreator, this->ModTags, this->Limit, this->Offset, ModFields, FModioModArrayDelegate::CreateUObject( this, &UCallbackProxy_GetUserSubscriptions::OnGetUserSubscriptionsDelegate ) ) );
   }
   else
   {
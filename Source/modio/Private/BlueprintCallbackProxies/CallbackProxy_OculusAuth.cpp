@@ -30,7 +30,7 @@ void UCallbackProxy_OculusAuth::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->OculusAuth( Nonce, OculusUserId, AccessToken, Email, Device, DateExpires, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_OculusAuth::OnOculusAuthDelegate ) );
+    TrackRequest( Modio, Modio->OculusAuth( Nonce, OculusUserId, AccessToken, Email, Device, DateExpires, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_OculusAuth::OnOculusAuthDelegate ) ) );
   }
   else
   {
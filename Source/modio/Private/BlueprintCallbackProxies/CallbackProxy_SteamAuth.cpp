@@ -25,7 +25,7 @@ void UCallbackProxy_SteamAuth::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->SteamAuth( Base64Ticket, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_SteamAuth::OnSteamAuthDelegate ) );
+    TrackRequest( Modio, Modio->SteamAuth( Base64Ticket, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_SteamAuth::OnSteamAuthDelegate ) ) );
   }
   else
   {
@@ -29,7 +29,7 @@ void UCallbackProxy_SubmitReport::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->SubmitReport( Resource, Id, Report, Name, Summary, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_SubmitReport::OnSubmitReportDelegate ) );
+    TrackRequest( Modio, Modio->SubmitReport( Resource, Id, Report, Name, Summary, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_SubmitReport::OnSubmitReportDelegate ) ) );
   }
   else
   {
@@ -26,7 +26,7 @@ void UCallbackProxy_SubscribeToMod::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->SubscribeToMod( this->ModId, FModioModDelegate::CreateUObject( this, &UCallbackProxy_SubscribeToMod::OnSubscribeToModDelegate ) );
+    TrackRequest( Modio, Modio->SubscribeToMod( this->ModId, FModioModDelegate::CreateUObject( this, &UCallbackProxy_SubscribeToMod::OnSubscribeToModDelegate ) ) );
   }
   else
   {
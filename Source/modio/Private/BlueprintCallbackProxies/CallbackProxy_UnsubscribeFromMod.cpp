@@ -25,7 +25,7 @@ void UCallbackProxy_UnsubscribeFromMod::Activate()
   FModioSubsystemPtr Modio = FModioSubsystem::Get( World );
   if( Modio.IsValid() )
   {
-    Modio->UnsubscribeFromMod( this->ModId, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_UnsubscribeFromMod::OnUnsubscribeFromModDelegate ) );
+    TrackRequest( Modio, Modio->UnsubscribeFromMod( this->ModId, FModioGenericDelegate::CreateUObject( this, &UCallbackProxy_UnsubscribeFromMod::OnUnsubscribeFromModDelegate ) ) );
   }
   else
   {
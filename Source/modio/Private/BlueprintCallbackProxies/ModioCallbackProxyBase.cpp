@@ -0,0 +1,39 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#include "BlueprintCallbackProxies/ModioCallbackProxyBase.h"
+#include "ModioSubsystem.h"
+
+UModioCallbackProxyBase::UModioCallbackProxyBase(const FObjectInitializer &ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+}
+
+void UModioCallbackProxyBase::Cancel()
+{
+  FModioSubsystemPtr Modio = ModioSubsystem.Pin();
+  if( Modio.IsValid() && RequestHandle.IsValid() )
+  {
+    Modio->CancelAsyncRequest( RequestHandle );
+  }
+  RequestHandle.Invalidate();
+}
+
+const FModioAsyncRequestHandle& UModioCallbackProxyBase::GetRequestHandle() const
+{
+  return RequestHandle;
+}
+
+void UModioCallbackProxyBase::BeginDestroy()
+{
+  // Nobody is around to receive the response, so don't bother converting it
+  Cancel();
+
+  Super::BeginDestroy();
+}
+
+void UModioCallbackProxyBase::TrackRequest( const FModioSubsystemPtr &Modio, const FModioAsyncRequestHandle &Handle )
+{
+  ModioSubsystem = Modio;
+  RequestHandle = Handle;
+}
@@ -0,0 +1,516 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#include "ModioBinaryStore.h"
+#include "ModioStringConversion.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFilemanager.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/DateTime.h"
+#include "Misc/Crc.h"
+
+using namespace ModioBinaryStore;
+
+/** Size of a record of each section, the strings are counted in bytes */
+static const SIZE_T RecordSizes[(int32)ESection::Count] =
+{
+  sizeof( FModRecord ),
+  sizeof( FModfileRecord ),
+  sizeof( FImageRecord ),
+  sizeof( FTagRecord ),
+  sizeof( FMetadataKVPRecord ),
+  sizeof( FTagOptionRecord ),
+  sizeof( uint32 ),
+  sizeof( FUserRecord ),
+  sizeof( ANSICHAR )
+};
+
+/** Sections start on this boundary, so their records can be read in place */
+static const int32 SectionAlignment = 8;
+
+/** Range is within a section of Num records */
+static bool IsValidRange( const FRange& Range, uint32 Num )
+{
+  return (uint64)Range.First + Range.Num <= Num;
+}
+
+FModioBinaryStoreWriter::FModioBinaryStoreWriter()
+{
+  // Offset 0 is the empty string
+  Strings.Add( '\0' );
+}
+
+uint32 FModioBinaryStoreWriter::AddString( const FString& String )
+{
+  if( String.IsEmpty() )
+  {
+    return 0;
+  }
+
+  if( const uint32* Offset = StringOffsets.Find( String ) )
+  {
+    return *Offset;
+  }
+
+  FTCHARToUTF8 Utf8( *String );
+  uint32 Offset = Strings.Num();
+  Strings.Append( Utf8.Get(), Utf8.Length() );
+  Strings.Add( '\0' );
+  StringOffsets.Add( String, Offset );
+  return Offset;
+}
+
+FRange FModioBinaryStoreWriter::AddStrings( const TArray<FString>& InStrings )
+{
+  FRange Range = { (uint32)StringLists.Num(), (uint32)InStrings.Num() };
+  for( const FString& String : InStrings )
+  {
+    StringLists.Add( AddString( String ) );
+  }
+  return Range;
+}
+
+FUserRecord FModioBinaryStoreWriter::MakeUserRecord( const FModioUser& User )
+{
+  FUserRecord Record;
+  Record.Id = User.Id;
+  Record.DateOnline = User.DateOnline;
+  Record.Username = AddString( User.Username );
+  Record.NameId = AddString( User.NameId );
+  Record.Timezone = AddString( User.Timezone );
+  Record.Language = AddString( User.Language );
+  Record.ProfileUrl = AddString( User.ProfileUrl );
+  Record.AvatarFilename = AddString( User.Avatar.Filename );
+  Record.AvatarOriginal = AddString( User.Avatar.Original );
+  Record.AvatarThumb50x50 = AddString( User.Avatar.Thumb50x50 );
+  Record.AvatarThumb100x100 = AddString( User.Avatar.Thumb100x100 );
+  return Record;
+}
+
+void FModioBinaryStoreWriter::AddMod( const FModioMod& Mod )
+{
+  const FModioModfile& Modfile = Mod.Modfile;
+  FModfileRecord& ModfileRecord = Modfiles.AddZeroed_GetRef();
+  ModfileRecord.Filesize = Modfile.Filesize;
+  ModfileRecord.Id = Modfile.Id;
+  ModfileRecord.ModId = Modfile.ModId;
+  ModfileRecord.VirusStats = Modfile.VirusStats;
+  ModfileRecord.VirusPositive = Modfile.VirusPositive;
+  ModfileRecord.DateAdded = Modfile.DateAdded;
+  ModfileRecord.DateScanned = Modfile.DateScanned;
+  ModfileRecord.DownloadDateExpires = Modfile.Download.DateExpires;
+  ModfileRecord.Filename = AddString( Modfile.Filename );
+  ModfileRecord.Version = AddString( Modfile.Version );
+  ModfileRecord.VirustotalHash = AddString( Modfile.VirustotalHash );
+  ModfileRecord.Changelog = AddString( Modfile.Changelog );
+  ModfileRecord.MetadataBlob = AddString( Modfile.MetadataBlob );
+  ModfileRecord.Md5 = AddString( Modfile.Filehash.Md5 );
+  ModfileRecord.BinaryUrl = AddString( Modfile.Download.BinaryUrl );
+
+  FModRecord& Record = Mods.AddZeroed_GetRef();
+  Record.Id = Mod.Id;
+  Record.GameId = Mod.GameId;
+  Record.Status = Mod.Status;
+  Record.Visible = Mod.Visible;
+  Record.MaturityOption = Mod.MaturityOption;
+  Record.DateAdded = Mod.DateAdded;
+  Record.DateUpdated = Mod.DateUpdated;
+  Record.DateLive = Mod.DateLive;
+  Record.HomepageUrl = AddString( Mod.HomepageUrl );
+  Record.Name = AddString( Mod.Name );
+  Record.NameId = AddString( Mod.NameId );
+  Record.Summary = AddString( Mod.Summary );
+  Record.Description = AddString( Mod.Description );
+  Record.DescriptionPlainText = AddString( Mod.DescriptionPlainText );
+  Record.MetadataBlob = AddString( Mod.MetadataBlob );
+  Record.ProfileUrl = AddString( Mod.ProfileUrl );
+  Record.LogoFilename = AddString( Mod.Logo.Filename );
+  Record.LogoOriginal = AddString( Mod.Logo.Original );
+  Record.LogoThumb320x180 = AddString( Mod.Logo.Thumb320x180 );
+  Record.LogoThumb640x360 = AddString( Mod.Logo.Thumb640x360 );
+  Record.LogoThumb1280x720 = AddString( Mod.Logo.Thumb1280x720 );
+  Record.SubmittedBy = MakeUserRecord( Mod.SubmittedBy );
+  Record.Modfile = Modfiles.Num() - 1;
+  Record.PopularityRankPosition = Mod.Stats.PopularityRankPosition;
+  Record.PopularityRankTotalMods = Mod.Stats.PopularityRankTotalMods;
+  Record.DownloadsTotal = Mod.Stats.DownloadsTotal;
+  Record.SubscribersTotal = Mod.Stats.SubscribersTotal;
+  Record.RatingsTotal = Mod.Stats.RatingsTotal;
+  Record.RatingsPositive = Mod.Stats.RatingsPositive;
+  Record.RatingsNegative = Mod.Stats.RatingsNegative;
+  Record.RatingsPercentagePositive = Mod.Stats.RatingsPercentagePositive;
+  Record.StatsDateExpires = Mod.Stats.DateExpires;
+  Record.RatingsWeightedAggregate = Mod.Stats.RatingsWeightedAggregate;
+  Record.RatingsDisplayText = AddString( Mod.Stats.RatingsDisplayText );
+  Record.Youtube = AddStrings( Mod.Media.Youtube );
+  Record.Sketchfab = AddStrings( Mod.Media.Sketchfab );
+
+  Record.Images = { (uint32)Images.Num(), (uint32)Mod.Media.Images.Num() };
+  for( const FModioImage& Image : Mod.Media.Images )
+  {
+    FImageRecord& ImageRecord = Images.AddZeroed_GetRef();
+    ImageRecord.Filename = AddString( Image.Filename );
+    ImageRecord.Original = AddString( Image.Original );
+    ImageRecord.Thumb320x180 = AddString( Image.Thumb320x180 );
+  }
+
+  Record.Tags = { (uint32)Tags.Num(), (uint32)Mod.Tags.Num() };
+  for( const FModioModTag& Tag : Mod.Tags )
+  {
+    FTagRecord& TagRecord = Tags.AddZeroed_GetRef();
+    TagRecord.DateAdded = Tag.DateAdded;
+    TagRecord.Name = AddString( Tag.Name );
+  }
+
+  Record.MetadataKVP = { (uint32)MetadataKVP.Num(), (uint32)Mod.MetadataKVP.Num() };
+  for( const FModioMetadataKVP& KVP : Mod.MetadataKVP )
+  {
+    FMetadataKVPRecord& KVPRecord = MetadataKVP.AddZeroed_GetRef();
+    KVPRecord.Metakey = AddString( KVP.Metakey );
+    KVPRecord.Metavalue = AddString( KVP.Metavalue );
+  }
+}
+
+void FModioBinaryStoreWriter::AddTagOptions( const TArray<FModioGameTagOption>& InTagOptions )
+{
+  for( const FModioGameTagOption& TagOption : InTagOptions )
+  {
+    FTagOptionRecord& Record = TagOptions.AddZeroed_GetRef();
+    Record.Name = AddString( TagOption.Name );
+    Record.Type = AddString( TagOption.Type );
+    Record.Hidden = TagOption.Hidden ? 1 : 0;
+    Record.Tags = AddStrings( TagOption.Tags );
+  }
+}
+
+void FModioBinaryStoreWriter::SetUser( const FModioUser& User )
+{
+  Users.Reset();
+  Users.Add( MakeUserRecord( User ) );
+}
+
+bool FModioBinaryStoreWriter::Save( const FString& Filename, uint32 GameId ) const
+{
+  TArray<uint8> Buffer;
+  Buffer.AddZeroed( sizeof( FHeader ) );
+
+  FHeader Header;
+  FMemory::Memzero( Header );
+  Header.Magic = Magic;
+  Header.Version = Version;
+  Header.GameId = GameId;
+  Header.SavedAt = FDateTime::UtcNow().ToUnixTimestamp();
+
+  auto AddSection = [&]( ESection Section, const void* Records, int32 Num )
+  {
+    Buffer.AddZeroed( Align( Buffer.Num(), SectionAlignment ) - Buffer.Num() );
+    Header.Sections[(int32)Section].Offset = Buffer.Num();
+    Header.Sections[(int32)Section].Num = Num;
+    Buffer.Append( (const uint8*)Records, Num * RecordSizes[(int32)Section] );
+  };
+  AddSection( ESection::Mods, Mods.GetData(), Mods.Num() );
+  AddSection( ESection::Modfiles, Modfiles.GetData(), Modfiles.Num() );
+  AddSection( ESection::Images, Images.GetData(), Images.Num() );
+  AddSection( ESection::Tags, Tags.GetData(), Tags.Num() );
+  AddSection( ESection::MetadataKVP, MetadataKVP.GetData(), MetadataKVP.Num() );
+  AddSection( ESection::TagOptions, TagOptions.GetData(), TagOptions.Num() );
+  AddSection( ESection::StringLists, StringLists.GetData(), StringLists.Num() );
+  AddSection( ESection::User, Users.GetData(), Users.Num() );
+  AddSection( ESection::Strings, Strings.GetData(), Strings.Num() );
+
+  Header.FileSize = Buffer.Num();
+  Header.Crc = FCrc::MemCrc32( Buffer.GetData() + sizeof( FHeader ), Buffer.Num() - sizeof( FHeader ) );
+  FMemory::Memcpy( Buffer.GetData(), &Header, sizeof( FHeader ) );
+
+  FString TempFilename = Filename + TEXT( ".tmp" );
+  if( !FFileHelper::SaveArrayToFile( Buffer, *TempFilename ) )
+  {
+    return false;
+  }
+  return IFileManager::Get().Move( *Filename, *TempFilename, true );
+}
+
+FModioBinaryStoreReader::FModioBinaryStoreReader() :
+  Data( nullptr ),
+  Size( 0 )
+{
+}
+
+FModioBinaryStoreReader::~FModioBinaryStoreReader()
+{
+  // The region has to go before the file it maps
+  MappedRegion.Reset();
+  MappedHandle.Reset();
+}
+
+TUniquePtr<FModioBinaryStoreReader> FModioBinaryStoreReader::Open( const FString& Filename, uint32 GameId )
+{
+  TUniquePtr<FModioBinaryStoreReader> Reader( new FModioBinaryStoreReader() );
+
+  IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+  if( !PlatformFile.FileExists( *Filename ) )
+  {
+    return nullptr;
+  }
+
+  Reader->MappedHandle.Reset( PlatformFile.OpenMapped( *Filename ) );
+  if( Reader->MappedHandle.IsValid() && Reader->MappedHandle->GetFileSize() > 0 )
+  {
+    Reader->MappedRegion.Reset( Reader->MappedHandle->MapRegion( 0, Reader->MappedHandle->GetFileSize() ) );
+  }
+
+  if( Reader->MappedRegion.IsValid() )
+  {
+    Reader->Data = Reader->MappedRegion->GetMappedPtr();
+    Reader->Size = Reader->MappedRegion->GetMappedSize();
+  }
+  else if( FFileHelper::LoadFileToArray( Reader->Loaded, *Filename, FILEREAD_Silent ) )
+  {
+    Reader->Data = Reader->Loaded.GetData();
+    Reader->Size = Reader->Loaded.Num();
+  }
+
+  if( !Reader->Data || !Reader->Validate( GameId ) )
+  {
+    return nullptr;
+  }
+  return Reader;
+}
+
+bool FModioBinaryStoreReader::Validate( uint32 GameId ) const
+{
+  if( Size < (int64)sizeof( FHeader ) || Size > MAX_uint32 )
+  {
+    return false;
+  }
+
+  const FHeader& Header = *(const FHeader*)Data;
+  if( Header.Magic != Magic || Header.Version != Version || Header.GameId != GameId || Header.FileSize != Size )
+  {
+    return false;
+  }
+
+  for( int32 Section = 0; Section < (int32)ESection::Count; Section++ )
+  {
+    uint64 Offset = Header.Sections[Section].Offset;
+    uint64 End = Offset + (uint64)Header.Sections[Section].Num * RecordSizes[Section];
+    if( Offset < sizeof( FHeader ) || Offset % SectionAlignment != 0 || End > (uint64)Size )
+    {
+      return false;
+    }
+  }
+
+  // Every string offset reads up to a terminator within the table
+  uint32 NumStringBytes = GetNum( ESection::Strings );
+  const ANSICHAR* StringTable = GetSection<ANSICHAR>( ESection::Strings );
+  if( NumStringBytes == 0 || StringTable[NumStringBytes - 1] != '\0' )
+  {
+    return false;
+  }
+
+  return Header.Crc == FCrc::MemCrc32( Data + sizeof( FHeader ), Size - sizeof( FHeader ) );
+}
+
+template<typename RecordType>
+const RecordType* FModioBinaryStoreReader::GetSection( ESection Section ) const
+{
+  return (const RecordType*)( Data + ( (const FHeader*)Data )->Sections[(int32)Section].Offset );
+}
+
+uint32 FModioBinaryStoreReader::GetNum( ESection Section ) const
+{
+  return ( (const FHeader*)Data )->Sections[(int32)Section].Num;
+}
+
+FString FModioBinaryStoreReader::GetString( uint32 Offset ) const
+{
+  FString String;
+  if( Offset > 0 && Offset < GetNum( ESection::Strings ) )
+  {
+    ModioUtf8ToString( String, GetSection<ANSICHAR>( ESection::Strings ) + Offset );
+  }
+  return String;
+}
+
+void FModioBinaryStoreReader::GetStrings( const FRange& Range, TArray<FString>& OutStrings ) const
+{
+  OutStrings.Reset();
+  if( !IsValidRange( Range, GetNum( ESection::StringLists ) ) )
+  {
+    return;
+  }
+
+  const uint32* Offsets = GetSection<uint32>( ESection::StringLists ) + Range.First;
+  OutStrings.Reserve( Range.Num );
+  for( uint32 i = 0; i < Range.Num; i++ )
+  {
+    OutStrings.Add( GetString( Offsets[i] ) );
+  }
+}
+
+int64 FModioBinaryStoreReader::GetSavedAt() const
+{
+  return ( (const FHeader*)Data )->SavedAt;
+}
+
+int32 FModioBinaryStoreReader::NumMods() const
+{
+  return GetNum( ESection::Mods );
+}
+
+int32 FModioBinaryStoreReader::GetModId( int32 Index ) const
+{
+  check( Index >= 0 && Index < NumMods() );
+  return GetSection<FModRecord>( ESection::Mods )[Index].Id;
+}
+
+void FModioBinaryStoreReader::ReadUserRecord( const FUserRecord& Record, FModioUser& OutUser ) const
+{
+  OutUser.Id = Record.Id;
+  OutUser.DateOnline = Record.DateOnline;
+  OutUser.Username = GetString( Record.Username );
+  OutUser.NameId = GetString( Record.NameId );
+  OutUser.Timezone = GetString( Record.Timezone );
+  OutUser.Language = GetString( Record.Language );
+  OutUser.ProfileUrl = GetString( Record.ProfileUrl );
+  OutUser.Avatar.Filename = GetString( Record.AvatarFilename );
+  OutUser.Avatar.Original = GetString( Record.AvatarOriginal );
+  OutUser.Avatar.Thumb50x50 = GetString( Record.AvatarThumb50x50 );
+  OutUser.Avatar.Thumb100x100 = GetString( Record.AvatarThumb100x100 );
+}
+
+void FModioBinaryStoreReader::ReadModfile( uint32 Index, FModioModfile& OutModfile ) const
+{
+  if( Index >= GetNum( ESection::Modfiles ) )
+  {
+    return;
+  }
+
+  const FModfileRecord& Record = GetSection<FModfileRecord>( ESection::Modfiles )[Index];
+  OutModfile.Id = Record.Id;
+  OutModfile.ModId = Record.ModId;
+  OutModfile.VirusStats = Record.VirusStats;
+  OutModfile.VirusPositive = Record.VirusPositive;
+  OutModfile.DateAdded = Record.DateAdded;
+  OutModfile.DateScanned = Record.DateScanned;
+  OutModfile.Filesize = Record.Filesize;
+  OutModfile.Filename = GetString( Record.Filename );
+  OutModfile.Version = GetString( Record.Version );
+  OutModfile.VirustotalHash = GetString( Record.VirustotalHash );
+  OutModfile.Changelog = GetString( Record.Changelog );
+  OutModfile.MetadataBlob = GetString( Record.MetadataBlob );
+  OutModfile.Filehash.Md5 = GetString( Record.Md5 );
+  OutModfile.Download.DateExpires = Record.DownloadDateExpires;
+  OutModfile.Download.BinaryUrl = GetString( Record.BinaryUrl );
+}
+
+void FModioBinaryStoreReader::ReadMod( int32 Index, FModioMod& OutMod ) const
+{
+  check( Index >= 0 && Index < NumMods() );
+  const FModRecord& Record = GetSection<FModRecord>( ESection::Mods )[Index];
+
+  OutMod.Id = Record.Id;
+  OutMod.GameId = Record.GameId;
+  OutMod.Status = Record.Status;
+  OutMod.Visible = Record.Visible;
+  OutMod.MaturityOption = Record.MaturityOption;
+  OutMod.DateAdded = Record.DateAdded;
+  OutMod.DateUpdated = Record.DateUpdated;
+  OutMod.DateLive = Record.DateLive;
+  OutMod.HomepageUrl = GetString( Record.HomepageUrl );
+  OutMod.Name = GetString( Record.Name );
+  OutMod.NameId = GetString( Record.NameId );
+  OutMod.Summary = GetString( Record.Summary );
+  OutMod.Description = GetString( Record.Description );
+  OutMod.DescriptionPlainText = GetString( Record.DescriptionPlainText );
+  OutMod.MetadataBlob = GetString( Record.MetadataBlob );
+  OutMod.ProfileUrl = GetString( Record.ProfileUrl );
+  OutMod.Logo.Filename = GetString( Record.LogoFilename );
+  OutMod.Logo.Original = GetString( Record.LogoOriginal );
+  OutMod.Logo.Thumb320x180 = GetString( Record.LogoThumb320x180 );
+  OutMod.Logo.Thumb640x360 = GetString( Record.LogoThumb640x360 );
+  OutMod.Logo.Thumb1280x720 = GetString( Record.LogoThumb1280x720 );
+  ReadUserRecord( Record.SubmittedBy, OutMod.SubmittedBy );
+  ReadModfile( Record.Modfile, OutMod.Modfile );
+
+  OutMod.Stats.ModId = Record.Id;
+  OutMod.Stats.PopularityRankPosition = Record.PopularityRankPosition;
+  OutMod.Stats.PopularityRankTotalMods = Record.PopularityRankTotalMods;
+  OutMod.Stats.DownloadsTotal = Record.DownloadsTotal;
+  OutMod.Stats.SubscribersTotal = Record.SubscribersTotal;
+  OutMod.Stats.RatingsTotal = Record.RatingsTotal;
+  OutMod.Stats.RatingsPositive = Record.RatingsPositive;
+  OutMod.Stats.RatingsNegative = Record.RatingsNegative;
+  OutMod.Stats.RatingsPercentagePositive = Record.RatingsPercentagePositive;
+  OutMod.Stats.DateExpires = Record.StatsDateExpires;
+  OutMod.Stats.RatingsWeightedAggregate = Record.RatingsWeightedAggregate;
+  OutMod.Stats.RatingsDisplayText = GetString( Record.RatingsDisplayText );
+
+  GetStrings( Record.Youtube, OutMod.Media.Youtube );
+  GetStrings( Record.Sketchfab, OutMod.Media.Sketchfab );
+
+  OutMod.Media.Images.Reset();
+  if( IsValidRange( Record.Images, GetNum( ESection::Images ) ) )
+  {
+    const FImageRecord* Images = GetSection<FImageRecord>( ESection::Images ) + Record.Images.First;
+    for( uint32 i = 0; i < Record.Images.Num; i++ )
+    {
+      FModioImage& Image = OutMod.Media.Images.AddDefaulted_GetRef();
+      Image.Filename = GetString( Images[i].Filename );
+      Image.Original = GetString( Images[i].Original );
+      Image.Thumb320x180 = GetString( Images[i].Thumb320x180 );
+    }
+  }
+
+  OutMod.Tags.Reset();
+  if( IsValidRange( Record.Tags, GetNum( ESection::Tags ) ) )
+  {
+    const FTagRecord* Tags = GetSection<FTagRecord>( ESection::Tags ) + Record.Tags.First;
+    for( uint32 i = 0; i < Record.Tags.Num; i++ )
+    {
+      FModioModTag& Tag = OutMod.Tags.AddDefaulted_GetRef();
+      Tag.DateAdded = Tags[i].DateAdded;
+      Tag.Name = GetString( Tags[i].Name );
+    }
+  }
+
+  OutMod.MetadataKVP.Reset();
+  if( IsValidRange( Record.MetadataKVP, GetNum( ESection::MetadataKVP ) ) )
+  {
+    const FMetadataKVPRecord* KVPs = GetSection<FMetadataKVPRecord>( ESection::MetadataKVP ) + Record.MetadataKVP.First;
+    for( uint32 i = 0; i < Record.MetadataKVP.Num; i++ )
+    {
+      FModioMetadataKVP& KVP = OutMod.MetadataKVP.AddDefaulted_GetRef();
+      KVP.Metakey = GetString( KVPs[i].Metakey );
+      KVP.Metavalue = GetString( KVPs[i].Metavalue );
+    }
+  }
+}
+
+void FModioBinaryStoreReader::ReadTagOptions( TArray<FModioGameTagOption>& OutTagOptions ) const
+{
+  const FTagOptionRecord* Records = GetSection<FTagOptionRecord>( ESection::TagOptions );
+  uint32 Num = GetNum( ESection::TagOptions );
+
+  OutTagOptions.Reset( Num );
+  for( uint32 i = 0; i < Num; i++ )
+  {
+    FModioGameTagOption& TagOption = OutTagOptions.AddDefaulted_GetRef();
+    TagOption.Name = GetString( Records[i].Name );
+    TagOption.Type = GetString( Records[i].Type );
+    TagOption.Hidden = Records[i].Hidden != 0;
+    GetStrings( Records[i].Tags, TagOption.Tags );
+  }
+}
+
+bool FModioBinaryStoreReader::ReadUser( FModioUser& OutUser ) const
+{
+  if( GetNum( ESection::User ) == 0 )
+  {
+    return false;
+  }
+
+  ReadUserRecord( GetSection<FUserRecord>( ESection::User )[0], OutUser );
+  return true;
+}
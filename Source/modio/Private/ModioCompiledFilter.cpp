@@ -0,0 +1,215 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#include "ModioCompiledFilter.h"
+#include "ModioUE4Utility.h"
+#include "Hash/CityHash.h"
+
+namespace
+{
+  struct FFieldEntry
+  {
+    FString Field;
+    EModioFieldFilterType Type;
+    TArray<FString> Values;
+  };
+
+  /** Suffix the backend expects after the field name for each filter type */
+  const ANSICHAR* GetFilterSuffix( EModioFieldFilterType Type )
+  {
+    switch( Type )
+    {
+    case EModioFieldFilterType::FIELD_FILTER_NOT_EQUAL:
+      return "-not";
+    case EModioFieldFilterType::FIELD_FILTER_LIKE:
+      return "-lk";
+    case EModioFieldFilterType::FIELD_FILTER_NOT_LIKE:
+      return "-not-lk";
+    case EModioFieldFilterType::FIELD_FILTER_IN:
+      return "-in";
+    case EModioFieldFilterType::FIELD_FILTER_NOT_IN:
+      return "-not-in";
+    case EModioFieldFilterType::FIELD_FILTER_MIN:
+      return "-min";
+    case EModioFieldFilterType::FIELD_FILTER_MAX:
+      return "-max";
+    case EModioFieldFilterType::FIELD_FILTER_SMALLER_THAN:
+      return "-st";
+    case EModioFieldFilterType::FIELD_FILTER_GREATER_THAN:
+      return "-gt";
+    default:
+      return "";
+    }
+  }
+
+  bool IsListType( EModioFieldFilterType Type )
+  {
+    return Type == EModioFieldFilterType::FIELD_FILTER_IN || Type == EModioFieldFilterType::FIELD_FILTER_NOT_IN;
+  }
+
+  void AppendAnsi( TArray<ANSICHAR>& Out, const ANSICHAR* String )
+  {
+    Out.Append( String, FCStringAnsi::Strlen( String ) );
+  }
+
+  /** Appends the UTF-8 of Value, percent encoding everything but the unreserved characters */
+  void AppendEscaped( TArray<ANSICHAR>& Out, const FString& Value )
+  {
+    static const ANSICHAR Hex[] = "0123456789ABCDEF";
+
+    FTCHARToUTF8 Utf8( *Value );
+    const uint8* Bytes = (const uint8*)Utf8.Get();
+    for( int32 i = 0; i < Utf8.Length(); i++ )
+    {
+      uint8 Byte = Bytes[i];
+      bool bUnreserved = ( Byte >= 'a' && Byte <= 'z' ) || ( Byte >= 'A' && Byte <= 'Z' ) || ( Byte >= '0' && Byte <= '9' ) ||
+        Byte == '-' || Byte == '_' || Byte == '.' || Byte == '~';
+      if( bUnreserved )
+      {
+        Out.Add( (ANSICHAR)Byte );
+      }
+      else
+      {
+        Out.Add( '%' );
+        Out.Add( Hex[Byte >> 4] );
+        Out.Add( Hex[Byte & 15] );
+      }
+    }
+  }
+
+  void AddFieldFilter( TArray<FFieldEntry>& Entries, const FString& Field, EModioFieldFilterType Type, const FString& Value )
+  {
+    if( Field.IsEmpty() )
+    {
+      return;
+    }
+
+    FFieldEntry* Entry = Entries.FindByPredicate( [&]( const FFieldEntry& Other )
+    {
+      return Other.Type == Type && Other.Field.Equals( Field, ESearchCase::CaseSensitive );
+    });
+    if( !Entry )
+    {
+      Entry = &Entries.AddDefaulted_GetRef();
+      Entry->Field = Field;
+      Entry->Type = Type;
+    }
+
+    if( !IsListType( Type ) )
+    {
+      Entry->Values.Reset();
+    }
+    Entry->Values.Add( Value );
+  }
+}
+
+FModioCompiledFilter::FModioCompiledFilter( TArray<ANSICHAR>&& InUtf8Query, uint32 InCacheMaxAgeSeconds ) :
+  Utf8Query( MoveTemp( InUtf8Query ) ),
+  Query( Utf8Query.Num(), Utf8Query.GetData() ),
+  Hash( CityHash64( Utf8Query.GetData(), Utf8Query.Num() ) ),
+  CacheMaxAgeSeconds( InCacheMaxAgeSeconds )
+{
+}
+
+FModioCompiledFilterRef FModioCompiledFilter::Compile( const FModioFilterCreator& FilterCreator, const TArray<FString>& ModTags )
+{
+  TArray<FFieldEntry> Entries;
+  for( const FString& ModTag : ModTags )
+  {
+    AddFieldFilter( Entries, TEXT( "tags" ), EModioFieldFilterType::FIELD_FILTER_IN, ModTag );
+  }
+  for( const FModioFieldFilterCreator& FieldFilter : FilterCreator.FieldFilters )
+  {
+    AddFieldFilter( Entries, FieldFilter.Field, FieldFilter.Type, FieldFilter.Value );
+  }
+
+  auto CaseSensitiveLess = []( const FString& A, const FString& B )
+  {
+    return A.Compare( B, ESearchCase::CaseSensitive ) < 0;
+  };
+  for( FFieldEntry& Entry : Entries )
+  {
+    if( IsListType( Entry.Type ) )
+    {
+      Entry.Values.Sort( CaseSensitiveLess );
+      for( int32 i = Entry.Values.Num() - 1; i > 0; i-- )
+      {
+        if( Entry.Values[i].Equals( Entry.Values[i - 1], ESearchCase::CaseSensitive ) )
+        {
+          Entry.Values.RemoveAt( i, 1, false );
+        }
+      }
+    }
+  }
+  Entries.Sort( [&]( const FFieldEntry& A, const FFieldEntry& B )
+  {
+    int32 Order = A.Field.Compare( B.Field, ESearchCase::CaseSensitive );
+    return Order != 0 ? Order < 0 : A.Type < B.Type;
+  });
+
+  TArray<ANSICHAR> Utf8Query;
+  auto BeginParameter = [&Utf8Query]()
+  {
+    if( Utf8Query.Num() )
+    {
+      Utf8Query.Add( '&' );
+    }
+  };
+
+  if( const char* SortField = GetModSortField( FilterCreator.Sort.ModSortType ) )
+  {
+    BeginParameter();
+    AppendAnsi( Utf8Query, FilterCreator.Sort.Ascending ? "_sort=" : "_sort=-" );
+    AppendAnsi( Utf8Query, SortField );
+  }
+
+  if( FilterCreator.FullTextSearch.Len() )
+  {
+    BeginParameter();
+    AppendAnsi( Utf8Query, "_q=" );
+    AppendEscaped( Utf8Query, FilterCreator.FullTextSearch );
+  }
+
+  for( const FFieldEntry& Entry : Entries )
+  {
+    BeginParameter();
+    AppendEscaped( Utf8Query, Entry.Field );
+    AppendAnsi( Utf8Query, GetFilterSuffix( Entry.Type ) );
+    Utf8Query.Add( '=' );
+    for( int32 i = 0; i < Entry.Values.Num(); i++ )
+    {
+      if( i > 0 )
+      {
+        Utf8Query.Add( ',' );
+      }
+      AppendEscaped( Utf8Query, Entry.Values[i] );
+    }
+  }
+
+  return MakeShareable( new FModioCompiledFilter( MoveTemp( Utf8Query ), (uint32)FMath::Max( FilterCreator.CacheMaxAgeSeconds, 0 ) ) );
+}
+
+FString FModioCompiledFilter::MakePageKey( int32 Limit, int32 Offset ) const
+{
+  // A call allowing an older SDK cached page must not answer one that asked for a fresher page
+  FString Key = FString::Printf( TEXT( "%d|%d|%u|" ), Limit, Offset, CacheMaxAgeSeconds );
+  Key += Query;
+  return Key;
+}
+
+TArray<ANSICHAR> FModioCompiledFilter::MakePageQuery( int32 Limit, int32 Offset ) const
+{
+  ANSICHAR Pagination[64];
+  int32 PaginationLength = FCStringAnsi::Sprintf( Pagination, "_limit=%d&_offset=%d", Limit, Offset );
+
+  TArray<ANSICHAR> PageQuery;
+  PageQuery.Reserve( PaginationLength + Utf8Query.Num() + 2 );
+  PageQuery.Append( Pagination, PaginationLength );
+  if( Utf8Query.Num() )
+  {
+    PageQuery.Add( '&' );
+    PageQuery.Append( Utf8Query );
+  }
+  PageQuery.Add( '\0' );
+  return PageQuery;
+}
@@ -0,0 +1,91 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#include "ModioDispatchScheduler.h"
+#include "ModioStats.h"
+
+DEFINE_STAT( STAT_ModioDispatch );
+DEFINE_STAT( STAT_ModioQueuedDispatches );
+DEFINE_STAT( STAT_ModioDeferredDispatches );
+
+FModioDispatchScheduler::FModioDispatchScheduler() :
+  BudgetInMicroseconds( 0 ),
+  NumDeferred( 0 ),
+  NumCountedDeferred( 0 )
+{
+}
+
+void FModioDispatchScheduler::SetBudget( int32 InBudgetInMicroseconds )
+{
+  BudgetInMicroseconds = FMath::Max( InBudgetInMicroseconds, 0 );
+}
+
+int32 FModioDispatchScheduler::GetBudget() const
+{
+  return BudgetInMicroseconds;
+}
+
+bool FModioDispatchScheduler::IsBudgeted() const
+{
+  return BudgetInMicroseconds > 0;
+}
+
+void FModioDispatchScheduler::Enqueue( TFunction<void()> Task )
+{
+  NumTasks.Increment();
+  Tasks.Enqueue( MoveTemp( Task ) );
+}
+
+void FModioDispatchScheduler::Dispatch()
+{
+  RunTasks( IsBudgeted() );
+}
+
+void FModioDispatchScheduler::DispatchAll()
+{
+  RunTasks( false );
+}
+
+int32 FModioDispatchScheduler::NumQueued() const
+{
+  return NumTasks.GetValue();
+}
+
+int32 FModioDispatchScheduler::GetNumDeferred() const
+{
+  return NumDeferred;
+}
+
+void FModioDispatchScheduler::RunTasks( bool bUseBudget )
+{
+  check( IsInGameThread() );
+  SCOPE_CYCLE_COUNTER( STAT_ModioDispatch );
+
+  double EndTime = FPlatformTime::Seconds() + BudgetInMicroseconds / 1000000.0;
+  TFunction<void()> Task;
+  while( Tasks.Dequeue( Task ) )
+  {
+    NumTasks.Decrement();
+    if( NumCountedDeferred > 0 )
+    {
+      NumCountedDeferred--;
+    }
+    Task();
+
+    if( bUseBudget && FPlatformTime::Seconds() >= EndTime )
+    {
+      break;
+    }
+  }
+
+  int32 Remaining = NumTasks.GetValue();
+  if( Remaining > NumCountedDeferred && bUseBudget )
+  {
+    // The queue is FIFO, so the ones counted on earlier calls are still the first ones in it
+    int32 NewlyDeferred = Remaining - NumCountedDeferred;
+    NumDeferred += NewlyDeferred;
+    NumCountedDeferred = Remaining;
+    INC_DWORD_STAT_BY( STAT_ModioDeferredDispatches, NewlyDeferred );
+  }
+  SET_DWORD_STAT( STAT_ModioQueuedDispatches, Remaining );
+}
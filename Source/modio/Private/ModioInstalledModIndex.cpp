@@ -0,0 +1,181 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#include "ModioInstalledModIndex.h"
+#include "ModioHWrapper.h"
+#include "ModioStringConversion.h"
+
+typedef TSharedRef<FModioInstalledModSnapshot, ESPMode::ThreadSafe> FMutableSnapshotRef;
+
+/** Only what tells a reinstall apart, the rest comes along with the modfile */
+static bool IsSameInstall( const FModioInstalledModSummary& A, const FModioInstalledModSummary& B )
+{
+  return A.ModfileId == B.ModfileId && A.DateUpdated == B.DateUpdated && A.Path.Equals( B.Path, ESearchCase::CaseSensitive );
+}
+
+bool InitializeInstalledModSummary( FModioInstalledModSummary& Out, const ModioInstalledMod& InstalledMod )
+{
+  Out.ModId = (int32)InstalledMod.mod_id;
+  Out.ModfileId = (int32)InstalledMod.modfile_id;
+  Out.DateUpdated = (int32)InstalledMod.date_updated;
+  ModioUtf8ToString( Out.Path, InstalledMod.path );
+  ModioUtf8ToString( Out.Name, InstalledMod.mod.name );
+  ModioUtf8ToString( Out.NameId, InstalledMod.mod.name_id );
+  ModioUtf8ToString( Out.Summary, InstalledMod.mod.summary );
+  ModioUtf8ToString( Out.LogoThumb320x180, InstalledMod.mod.logo.thumb_320x180 );
+  ModioUtf8ToString( Out.Version, InstalledMod.mod.modfile.version );
+  Out.Filesize = (int64)InstalledMod.mod.modfile.filesize;
+
+  // The SDK hands back an empty entry for mods it doesn't have installed
+  return Out.ModId != 0 && !Out.Path.IsEmpty();
+}
+
+FModioInstalledModIndex::FModioInstalledModIndex() :
+  Snapshot( MakeShared<const FModioInstalledModSnapshot, ESPMode::ThreadSafe>() )
+{
+}
+
+FModioInstalledModSnapshotRef FModioInstalledModIndex::GetSnapshot() const
+{
+  FScopeLock Lock( &SnapshotCriticalSection );
+  return Snapshot;
+}
+
+void FModioInstalledModIndex::Reset( TArray<FModioInstalledModSummary>&& Mods )
+{
+  check( IsInGameThread() );
+
+  FModioInstalledModSnapshotRef Previous = GetSnapshot();
+  FMutableSnapshotRef Next = MakeShared<FModioInstalledModSnapshot, ESPMode::ThreadSafe>();
+  Next->Mods = MoveTemp( Mods );
+  Publish( Next );
+
+  TArray<TPair<int32, EModioInstalledModChange>> Changes;
+  for( const FModioInstalledModSummary& Mod : Next->Mods )
+  {
+    const FModioInstalledModSummary* Old = Previous->Find( Mod.ModId );
+    if( !Old )
+    {
+      Changes.Emplace( Mod.ModId, EModioInstalledModChange::Installed );
+    }
+    else if( !IsSameInstall( *Old, Mod ) )
+    {
+      Changes.Emplace( Mod.ModId, EModioInstalledModChange::Updated );
+    }
+  }
+  for( const FModioInstalledModSummary& Mod : Previous->Mods )
+  {
+    if( !Next->IndexByModId.Contains( Mod.ModId ) )
+    {
+      Changes.Emplace( Mod.ModId, EModioInstalledModChange::Uninstalled );
+    }
+  }
+
+  for( const TPair<int32, EModioInstalledModChange>& Change : Changes )
+  {
+    Notify( Change.Key, Change.Value );
+  }
+}
+
+void FModioInstalledModIndex::Update( FModioInstalledModSummary&& Mod )
+{
+  check( IsInGameThread() );
+
+  FModioInstalledModSnapshotRef Previous = GetSnapshot();
+  const FModioInstalledModSummary* Old = Previous->Find( Mod.ModId );
+  if( Old && IsSameInstall( *Old, Mod ) )
+  {
+    return;
+  }
+
+  int32 ModId = Mod.ModId;
+  EModioInstalledModChange Change = Old ? EModioInstalledModChange::Updated : EModioInstalledModChange::Installed;
+
+  FMutableSnapshotRef Next = MakeShared<FModioInstalledModSnapshot, ESPMode::ThreadSafe>();
+  Next->Mods = Previous->Mods;
+  if( Old )
+  {
+    Next->Mods[Previous->IndexByModId.FindChecked( ModId )] = MoveTemp( Mod );
+  }
+  else
+  {
+    Next->Mods.Add( MoveTemp( Mod ) );
+  }
+  Publish( Next );
+
+  Notify( ModId, Change );
+}
+
+void FModioInstalledModIndex::Remove( int32 ModId )
+{
+  check( IsInGameThread() );
+
+  FModioInstalledModSnapshotRef Previous = GetSnapshot();
+  const int32* Index = Previous->IndexByModId.Find( ModId );
+  if( !Index )
+  {
+    return;
+  }
+
+  FMutableSnapshotRef Next = MakeShared<FModioInstalledModSnapshot, ESPMode::ThreadSafe>();
+  Next->Mods = Previous->Mods;
+  Next->Mods.RemoveAt( *Index );
+  Publish( Next );
+
+  Notify( ModId, EModioInstalledModChange::Uninstalled );
+}
+
+FDelegateHandle FModioInstalledModIndex::AddListener( int32 ModId, FModioInstalledModChangedDelegate Delegate )
+{
+  check( IsInGameThread() );
+  return ModListeners.FindOrAdd( ModId ).Add( Delegate );
+}
+
+FDelegateHandle FModioInstalledModIndex::AddListener( FModioInstalledModChangedDelegate Delegate )
+{
+  check( IsInGameThread() );
+  return AnyModListeners.Add( Delegate );
+}
+
+void FModioInstalledModIndex::RemoveListener( FDelegateHandle Handle )
+{
+  check( IsInGameThread() );
+
+  AnyModListeners.Remove( Handle );
+  for( auto It = ModListeners.CreateIterator(); It; ++It )
+  {
+    It->Value.Remove( Handle );
+    if( !It->Value.IsBound() )
+    {
+      It.RemoveCurrent();
+    }
+  }
+}
+
+void FModioInstalledModIndex::Publish( FMutableSnapshotRef Next )
+{
+  Next->Mods.Sort( []( const FModioInstalledModSummary& A, const FModioInstalledModSummary& B )
+  {
+    return A.ModId < B.ModId;
+  });
+  Next->IndexByModId.Reset();
+  Next->IndexByModId.Reserve( Next->Mods.Num() );
+  for( int32 i = 0; i < Next->Mods.Num(); i++ )
+  {
+    Next->IndexByModId.Add( Next->Mods[i].ModId, i );
+  }
+
+  FScopeLock Lock( &SnapshotCriticalSection );
+  Snapshot = Next;
+}
+
+void FModioInstalledModIndex::Notify( int32 ModId, EModioInstalledModChange Change )
+{
+  // Listeners can add others, which may move the events around in the map, so it's copied first
+  if( const FModioInstalledModChangedEvent* Listeners = ModListeners.Find( ModId ) )
+  {
+    FModioInstalledModChangedEvent Event = *Listeners;
+    Event.Broadcast( ModId, Change );
+  }
+  AnyModListeners.Broadcast( ModId, Change );
+}
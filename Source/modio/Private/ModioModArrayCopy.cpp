@@ -0,0 +1,132 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#include "ModioModArrayCopy.h"
+
+FModioModArrayCopy::FModioModArrayCopy( const ModioMod* ModioMods, u32 ModioModsSize ) :
+  BlockCursor( nullptr ),
+  BlockEnd( nullptr )
+{
+  Mods.Append( ModioMods, (int32)ModioModsSize );
+  for( ModioMod& Mod : Mods )
+  {
+    CopyMod( Mod );
+  }
+}
+
+void FModioModArrayCopy::CopyMod( ModioMod& Mod )
+{
+  CopyString( Mod.homepage_url );
+  CopyString( Mod.name );
+  CopyString( Mod.name_id );
+  CopyString( Mod.summary );
+  CopyString( Mod.description );
+  CopyString( Mod.description_plaintext );
+  CopyString( Mod.metadata_blob );
+  CopyString( Mod.profile_url );
+
+  CopyString( Mod.logo.filename );
+  CopyString( Mod.logo.original );
+  CopyString( Mod.logo.thumb_320x180 );
+  CopyString( Mod.logo.thumb_640x360 );
+  CopyString( Mod.logo.thumb_1280x720 );
+
+  ModioUser& User = Mod.submitted_by;
+  CopyString( User.username );
+  CopyString( User.name_id );
+  CopyString( User.timezone );
+  CopyString( User.language );
+  CopyString( User.profile_url );
+  CopyString( User.avatar.filename );
+  CopyString( User.avatar.original );
+  CopyString( User.avatar.thumb_50x50 );
+  CopyString( User.avatar.thumb_100x100 );
+
+  ModioModfile& Modfile = Mod.modfile;
+  CopyString( Modfile.filename );
+  CopyString( Modfile.version );
+  CopyString( Modfile.virustotal_hash );
+  CopyString( Modfile.changelog );
+  CopyString( Modfile.metadata_blob );
+  CopyString( Modfile.filehash.md5 );
+  CopyString( Modfile.download.binary_url );
+
+  ModioMedia& Media = Mod.media;
+  CopyStrings( Media.youtube_array, Media.youtube_size );
+  CopyStrings( Media.sketchfab_array, Media.sketchfab_size );
+  CopyArray( Media.images_array, Media.images_size );
+  for( u32 i = 0; Media.images_array && i < Media.images_size; i++ )
+  {
+    CopyString( Media.images_array[i].filename );
+    CopyString( Media.images_array[i].original );
+    CopyString( Media.images_array[i].thumb_320x180 );
+  }
+
+  CopyString( Mod.stats.ratings_display_text );
+
+  CopyArray( Mod.tags_array, Mod.tags_array_size );
+  for( u32 i = 0; Mod.tags_array && i < Mod.tags_array_size; i++ )
+  {
+    CopyString( Mod.tags_array[i].name );
+  }
+
+  CopyArray( Mod.metadata_kvp_array, Mod.metadata_kvp_array_size );
+  for( u32 i = 0; Mod.metadata_kvp_array && i < Mod.metadata_kvp_array_size; i++ )
+  {
+    CopyString( Mod.metadata_kvp_array[i].metakey );
+    CopyString( Mod.metadata_kvp_array[i].metavalue );
+  }
+}
+
+void FModioModArrayCopy::CopyString( char*& String )
+{
+  if( String )
+  {
+    SIZE_T Size = FCStringAnsi::Strlen( String ) + 1;
+    char* Copy = (char*)Allocate( Size, 1 );
+    FMemory::Memcpy( Copy, String, Size );
+    String = Copy;
+  }
+}
+
+void FModioModArrayCopy::CopyStrings( char**& Strings, u32 Size )
+{
+  CopyArray( Strings, Size );
+  for( u32 i = 0; Strings && i < Size; i++ )
+  {
+    CopyString( Strings[i] );
+  }
+}
+
+template<typename ElementType>
+void FModioModArrayCopy::CopyArray( ElementType*& Array, u32 Size )
+{
+  if( !Array || !Size )
+  {
+    // Nothing should point into the SDK's buffers once the response returns
+    Array = nullptr;
+  }
+  else
+  {
+    ElementType* Copy = (ElementType*)Allocate( Size * sizeof( ElementType ), alignof( ElementType ) );
+    FMemory::Memcpy( Copy, Array, Size * sizeof( ElementType ) );
+    Array = Copy;
+  }
+}
+
+void* FModioModArrayCopy::Allocate( SIZE_T Size, SIZE_T Alignment )
+{
+  uint8* Start = Align( BlockCursor, Alignment );
+  if( !BlockCursor || Start + Size > BlockEnd )
+  {
+    // Anything bigger than a block, like a long description, gets a block of it's own
+    SIZE_T NewBlockSize = FMath::Max( BlockSize, Size + Alignment );
+    Blocks.Emplace( new uint8[NewBlockSize] );
+    BlockCursor = Blocks.Last().Get();
+    BlockEnd = BlockCursor + NewBlockSize;
+    Start = Align( BlockCursor, Alignment );
+  }
+
+  BlockCursor = Start + Size;
+  return Start;
+}
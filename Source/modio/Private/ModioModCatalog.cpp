@@ -0,0 +1,315 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#include "ModioModCatalog.h"
+#include "Algo/Sort.h"
+
+/** Ands Keep with Min <= Column <= Max, written without branches so the compiler can vectorize it */
+static void KeepInRange( TArray<uint8>& Keep, const TArray<int32>& Column, int32 Min, int32 Max )
+{
+  if( Min == MIN_int32 && Max == MAX_int32 )
+  {
+    return;
+  }
+
+  uint8* KeepData = Keep.GetData();
+  const int32* Data = Column.GetData();
+  for( int32 i = 0, Count = Keep.Num(); i < Count; i++ )
+  {
+    KeepData[i] &= (uint8)( ( Data[i] >= Min ) & ( Data[i] <= Max ) );
+  }
+}
+
+/** Maps Value to a key that sorts as an unsigned integer in the same order */
+static uint32 MakeSortKey( int32 Value )
+{
+  return (uint32)Value ^ 0x80000000u;
+}
+
+static uint32 MakeSortKey( float Value )
+{
+  uint32 Bits;
+  FMemory::Memcpy( &Bits, &Value, sizeof( Bits ) );
+  return ( Bits & 0x80000000u ) ? ~Bits : Bits | 0x80000000u;
+}
+
+void FModioModCatalog::AddOrUpdate( const FModioMod& Mod )
+{
+  int32 Index = FindIndex( Mod.Id );
+  if( Index == INDEX_NONE )
+  {
+    Index = AllocateSlot();
+    IndexById.Add( Mod.Id, Index );
+  }
+
+  Records[Index] = Mod;
+  WriteColumns( Index, Mod );
+  TagIndex.SetSlotTags( Index, Mod.Tags );
+  SearchIndex.SetSlot( Index, Mod );
+  MetadataIndex.SetSlotMetadata( Index, Mod.MetadataKVP );
+}
+
+void FModioModCatalog::AddOrUpdate( TArrayView<const FModioMod> Mods )
+{
+  IndexById.Reserve( IndexById.Num() + Mods.Num() );
+  for( const FModioMod& Mod : Mods )
+  {
+    AddOrUpdate( Mod );
+  }
+}
+
+bool FModioModCatalog::Remove( int32 ModId )
+{
+  int32 Index;
+  if( !IndexById.RemoveAndCopyValue( ModId, Index ) )
+  {
+    return false;
+  }
+
+  // The slot stays in place so the other indices don't move, it's reused by the next added mod
+  Live[Index] = 0;
+  Ids[Index] = 0;
+  Records[Index] = FModioMod();
+  TagIndex.ClearSlot( Index );
+  SearchIndex.ClearSlot( Index );
+  MetadataIndex.ClearSlot( Index );
+  FreeSlots.Add( Index );
+  return true;
+}
+
+void FModioModCatalog::Reset()
+{
+  Ids.Reset();
+  GameIds.Reset();
+  DatesAdded.Reset();
+  DatesUpdated.Reset();
+  DatesLive.Reset();
+  Downloads.Reset();
+  Subscribers.Reset();
+  PopularityRanks.Reset();
+  Ratings.Reset();
+  MaturityOptions.Reset();
+  Visible.Reset();
+  Live.Reset();
+  Records.Reset();
+  TagIndex.Reset();
+  SearchIndex.Reset();
+  MetadataIndex.Reset();
+  IndexById.Reset();
+  FreeSlots.Reset();
+  bComplete = false;
+}
+
+int32 FModioModCatalog::Num() const
+{
+  return IndexById.Num();
+}
+
+int32 FModioModCatalog::FindIndex( int32 ModId ) const
+{
+  const int32* Index = IndexById.Find( ModId );
+  return Index ? *Index : INDEX_NONE;
+}
+
+bool FModioModCatalog::IsValidIndex( int32 Index ) const
+{
+  return Live.IsValidIndex( Index ) && Live[Index];
+}
+
+const FModioMod& FModioModCatalog::GetMod( int32 Index ) const
+{
+  check( IsValidIndex( Index ) );
+  return Records[Index];
+}
+
+void FModioModCatalog::GetAllIndices( TArray<int32>& OutIndices ) const
+{
+  Filter( FModioModCatalogFilter(), OutIndices );
+}
+
+void FModioModCatalog::Filter( const FModioModCatalogFilter& Filter, TArray<int32>& OutIndices ) const
+{
+  int32 Count = Live.Num();
+  TArray<uint8> Keep = Live;
+
+  // One pass per constraint over just the column it reads
+  if( Filter.GameId != 0 )
+  {
+    KeepInRange( Keep, GameIds, Filter.GameId, Filter.GameId );
+  }
+  KeepInRange( Keep, DatesAdded, Filter.MinDateAdded, Filter.MaxDateAdded );
+  KeepInRange( Keep, DatesUpdated, Filter.MinDateUpdated, Filter.MaxDateUpdated );
+  KeepInRange( Keep, DatesLive, Filter.MinDateLive, Filter.MaxDateLive );
+  KeepInRange( Keep, Downloads, Filter.MinDownloads > 0 ? Filter.MinDownloads : MIN_int32, MAX_int32 );
+  KeepInRange( Keep, Subscribers, Filter.MinSubscribers > 0 ? Filter.MinSubscribers : MIN_int32, MAX_int32 );
+
+  uint8* KeepData = Keep.GetData();
+  if( Filter.MinRating > 0.0f )
+  {
+    const float* RatingData = Ratings.GetData();
+    for( int32 i = 0; i < Count; i++ )
+    {
+      KeepData[i] &= (uint8)( RatingData[i] >= Filter.MinRating );
+    }
+  }
+  if( Filter.ExcludedMaturityOptions != 0 )
+  {
+    const int32* MaturityData = MaturityOptions.GetData();
+    for( int32 i = 0; i < Count; i++ )
+    {
+      KeepData[i] &= (uint8)( ( MaturityData[i] & Filter.ExcludedMaturityOptions ) == 0 );
+    }
+  }
+  if( Filter.bVisibleOnly )
+  {
+    const uint8* VisibleData = Visible.GetData();
+    for( int32 i = 0; i < Count; i++ )
+    {
+      KeepData[i] &= VisibleData[i];
+    }
+  }
+  if( !Filter.Tags.IsEmpty() )
+  {
+    // The tag query runs 64 slots at a time, then gets spread over Keep
+    TArray<uint64> TagWords;
+    TagIndex.Evaluate( Filter.Tags, Count, TagWords );
+    const uint64* TagData = TagWords.GetData();
+    for( int32 i = 0; i < Count; i++ )
+    {
+      KeepData[i] &= (uint8)( ( TagData[i >> 6] >> ( i & 63 ) ) & 1 );
+    }
+  }
+
+  OutIndices.Reset( Num() );
+  for( int32 i = 0; i < Count; i++ )
+  {
+    if( KeepData[i] )
+    {
+      OutIndices.Add( i );
+    }
+  }
+}
+
+void FModioModCatalog::Sort( TArray<int32>& Indices, EModioModSortType SortType, bool bAscending ) const
+{
+  if( SortType == EModioModSortType::SORT_BY_NAME )
+  {
+    // Names are only in the full records, this one can't be done on a column
+    Indices.StableSort( [this, bAscending]( int32 A, int32 B )
+    {
+      int32 Compare = Records[A].Name.Compare( Records[B].Name, ESearchCase::IgnoreCase );
+      return bAscending ? Compare < 0 : Compare > 0;
+    });
+    return;
+  }
+
+  // Sort the key of each mod with it's index in the low bits, so equal keys fall back to index order
+  TArray<uint64> Keys;
+  Keys.SetNumUninitialized( Indices.Num() );
+  for( int32 i = 0; i < Indices.Num(); i++ )
+  {
+    int32 Index = Indices[i];
+    uint32 Key;
+    switch( SortType )
+    {
+    case EModioModSortType::SORT_BY_DATE_ADDED:   Key = MakeSortKey( DatesAdded[Index] ); break;
+    case EModioModSortType::SORT_BY_DATE_UPDATED: Key = MakeSortKey( DatesUpdated[Index] ); break;
+    case EModioModSortType::SORT_BY_DATE_LIVE:    Key = MakeSortKey( DatesLive[Index] ); break;
+    case EModioModSortType::SORT_BY_DOWNLOADS:    Key = MakeSortKey( Downloads[Index] ); break;
+    case EModioModSortType::SORT_BY_POPULAR:      Key = MakeSortKey( PopularityRanks[Index] ); break;
+    case EModioModSortType::SORT_BY_RATING:       Key = MakeSortKey( Ratings[Index] ); break;
+    case EModioModSortType::SORT_BY_SUBSCRIBERS:  Key = MakeSortKey( Subscribers[Index] ); break;
+    default:                                      Key = MakeSortKey( Ids[Index] ); break;
+    }
+    Keys[i] = ( (uint64)( bAscending ? Key : ~Key ) << 32 ) | (uint32)Index;
+  }
+
+  Algo::Sort( Keys );
+
+  for( int32 i = 0; i < Keys.Num(); i++ )
+  {
+    Indices[i] = (int32)( Keys[i] & 0xFFFFFFFFu );
+  }
+}
+
+void FModioModCatalog::Search( const FString& Text, int32 MaxResults, TArray<int32>& OutIndices ) const
+{
+  TArray<FModioSearchHit> Hits;
+  SearchIndex.Search( Text, MaxResults, Hits );
+
+  OutIndices.Reset( Hits.Num() );
+  for( const FModioSearchHit& Hit : Hits )
+  {
+    OutIndices.Add( Hit.Slot );
+  }
+}
+
+void FModioModCatalog::FindByMetadata( const FString& Key, const FString& Value, TArray<int32>& OutIndices ) const
+{
+  MetadataIndex.Find( Key, Value, OutIndices );
+  OutIndices.Sort();
+}
+
+void FModioModCatalog::FindByMetadataRange( const FString& Key, double Min, double Max, TArray<int32>& OutIndices ) const
+{
+  MetadataIndex.FindInRange( Key, Min, Max, OutIndices );
+}
+
+SIZE_T FModioModCatalog::GetSearchIndexSize() const
+{
+  return SearchIndex.GetAllocatedSize();
+}
+
+void FModioModCatalog::RegisterTagOptions( const TArray<FModioGameTagOption>& TagOptions )
+{
+  TagIndex.RegisterTagOptions( TagOptions );
+}
+
+void FModioModCatalog::SetComplete( bool bInComplete )
+{
+  bComplete = bInComplete;
+}
+
+bool FModioModCatalog::IsComplete() const
+{
+  return bComplete;
+}
+
+int32 FModioModCatalog::AllocateSlot()
+{
+  if( FreeSlots.Num() )
+  {
+    int32 Index = FreeSlots.Pop( false );
+    Live[Index] = 1;
+    return Index;
+  }
+
+  Ids.AddZeroed();
+  GameIds.AddZeroed();
+  DatesAdded.AddZeroed();
+  DatesUpdated.AddZeroed();
+  DatesLive.AddZeroed();
+  Downloads.AddZeroed();
+  Subscribers.AddZeroed();
+  PopularityRanks.AddZeroed();
+  Ratings.AddZeroed();
+  MaturityOptions.AddZeroed();
+  Visible.AddZeroed();
+  Records.AddDefaulted();
+  return Live.Add( 1 );
+}
+
+void FModioModCatalog::WriteColumns( int32 Index, const FModioMod& Mod )
+{
+  Ids[Index] = Mod.Id;
+  GameIds[Index] = Mod.GameId;
+  DatesAdded[Index] = Mod.DateAdded;
+  DatesUpdated[Index] = Mod.DateUpdated;
+  DatesLive[Index] = Mod.DateLive;
+  Downloads[Index] = Mod.Stats.DownloadsTotal;
+  Subscribers[Index] = Mod.Stats.SubscribersTotal;
+  PopularityRanks[Index] = Mod.Stats.PopularityRankPosition;
+  Ratings[Index] = Mod.Stats.RatingsWeightedAggregate;
+  MaturityOptions[Index] = Mod.MaturityOption;
+  Visible[Index] = Mod.Visible != 0;
+}
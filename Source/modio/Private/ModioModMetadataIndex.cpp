@@ -0,0 +1,125 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#include "ModioModMetadataIndex.h"
+#include "Algo/BinarySearch.h"
+
+/** Parses Value if the whole of it is a number */
+static bool ParseNumericValue( const FString& Value, double& OutNumber )
+{
+  if( Value.IsEmpty() || !FCString::IsNumeric( *Value ) )
+  {
+    return false;
+  }
+  OutNumber = FCString::Atod( *Value );
+  return true;
+}
+
+void FModioModMetadataIndex::SetSlotMetadata( int32 Slot, const TArray<FModioMetadataKVP>& MetadataKVP )
+{
+  ClearSlot( Slot );
+
+  if( SlotMetadata.Num() <= Slot )
+  {
+    SlotMetadata.SetNum( Slot + 1 );
+  }
+
+  for( const FModioMetadataKVP& KVP : MetadataKVP )
+  {
+    FKeyEntry& Entry = Keys.FindOrAdd( KVP.Metakey );
+    TArray<int32>& Slots = Entry.SlotsByValue.FindOrAdd( KVP.Metavalue );
+    if( Slots.Contains( Slot ) )
+    {
+      continue;
+    }
+    Slots.Add( Slot );
+
+    double Number;
+    if( ParseNumericValue( KVP.Metavalue, Number ) )
+    {
+      Entry.NumericValues.Emplace( Number, Slot );
+      Entry.bNumericValuesDirty = true;
+    }
+    SlotMetadata[Slot].Add( KVP );
+  }
+}
+
+void FModioModMetadataIndex::ClearSlot( int32 Slot )
+{
+  if( !SlotMetadata.IsValidIndex( Slot ) )
+  {
+    return;
+  }
+
+  for( const FModioMetadataKVP& KVP : SlotMetadata[Slot] )
+  {
+    FKeyEntry* Entry = Keys.Find( KVP.Metakey );
+    if( !Entry )
+    {
+      continue;
+    }
+
+    if( TArray<int32>* Slots = Entry->SlotsByValue.Find( KVP.Metavalue ) )
+    {
+      Slots->RemoveSingleSwap( Slot, false );
+      if( !Slots->Num() )
+      {
+        Entry->SlotsByValue.Remove( KVP.Metavalue );
+      }
+    }
+
+    double Number;
+    if( ParseNumericValue( KVP.Metavalue, Number ) )
+    {
+      // Removing keeps the order, the array stays sorted if it was
+      Entry->NumericValues.RemoveSingle( TPair<double, int32>( Number, Slot ) );
+    }
+
+    if( !Entry->SlotsByValue.Num() )
+    {
+      Keys.Remove( KVP.Metakey );
+    }
+  }
+  SlotMetadata[Slot].Reset();
+}
+
+void FModioModMetadataIndex::Reset()
+{
+  Keys.Reset();
+  SlotMetadata.Reset();
+}
+
+void FModioModMetadataIndex::Find( const FString& Key, const FString& Value, TArray<int32>& OutSlots ) const
+{
+  OutSlots.Reset();
+
+  const FKeyEntry* Entry = Keys.Find( Key );
+  if( const TArray<int32>* Slots = Entry ? Entry->SlotsByValue.Find( Value ) : nullptr )
+  {
+    OutSlots = *Slots;
+  }
+}
+
+void FModioModMetadataIndex::FindInRange( const FString& Key, double Min, double Max, TArray<int32>& OutSlots ) const
+{
+  OutSlots.Reset();
+
+  const FKeyEntry* Entry = Keys.Find( Key );
+  if( !Entry || Min > Max )
+  {
+    return;
+  }
+
+  if( Entry->bNumericValuesDirty )
+  {
+    Entry->NumericValues.Sort();
+    Entry->bNumericValuesDirty = false;
+  }
+
+  const TArray<TPair<double, int32>>& Values = Entry->NumericValues;
+  int32 First = Algo::LowerBoundBy( Values, Min, []( const TPair<double, int32>& Pair ) { return Pair.Key; } );
+  for( int32 i = First; i < Values.Num() && Values[i].Key <= Max; i++ )
+  {
+    OutSlots.Add( Values[i].Value );
+  }
+}
@@ -0,0 +1,231 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#include "ModioModSearchIndex.h"
+#include "Algo/BinarySearch.h"
+
+/** Weight of a word by the field it came from */
+static const int32 NameWeight = 8;
+static const int32 TagWeight = 4;
+static const int32 NameIdWeight = 4;
+static const int32 SubmitterWeight = 2;
+static const int32 SummaryWeight = 1;
+
+/** Longer words are cut, nobody types that far before the results settle */
+static const int32 MaxWordLength = 32;
+
+void FModioModSearchIndex::SetSlot( int32 Slot, const FModioMod& Mod )
+{
+  ClearSlot( Slot );
+
+  if( SlotWordIds.Num() <= Slot )
+  {
+    SlotWordIds.SetNum( Slot + 1 );
+  }
+
+  AddWords( Slot, Mod.Name, NameWeight );
+  AddWords( Slot, Mod.NameId, NameIdWeight );
+  AddWords( Slot, Mod.SubmittedBy.Username, SubmitterWeight );
+  AddWords( Slot, Mod.Summary, SummaryWeight );
+  for( const FModioModTag& Tag : Mod.Tags )
+  {
+    AddWords( Slot, Tag.Name, TagWeight );
+  }
+}
+
+void FModioModSearchIndex::ClearSlot( int32 Slot )
+{
+  if( !SlotWordIds.IsValidIndex( Slot ) )
+  {
+    return;
+  }
+
+  for( int32 Id : SlotWordIds[Slot] )
+  {
+    TArray<FPosting>& WordPostings = Postings[Id];
+    int32 Index = WordPostings.IndexOfByPredicate( [Slot]( const FPosting& Posting ) { return Posting.Slot == Slot; } );
+    if( Index != INDEX_NONE )
+    {
+      WordPostings.RemoveAtSwap( Index, 1, false );
+    }
+  }
+  SlotWordIds[Slot].Reset();
+}
+
+void FModioModSearchIndex::Reset()
+{
+  Words.Reset();
+  IdsByWord.Reset();
+  Postings.Reset();
+  SlotWordIds.Reset();
+  SortedWordIds.Reset();
+  bSortedWordsDirty = false;
+}
+
+void FModioModSearchIndex::Search( const FString& Text, int32 MaxResults, TArray<FModioSearchHit>& OutHits ) const
+{
+  OutHits.Reset();
+
+  TArray<FString> QueryWords;
+  Tokenize( Text, QueryWords );
+  if( !QueryWords.Num() )
+  {
+    return;
+  }
+
+  SortWords();
+
+  int32 NumSlots = SlotWordIds.Num();
+  TArray<int32> Scores;
+  TArray<int32> NumMatched;
+  Scores.AddZeroed( NumSlots );
+  NumMatched.AddZeroed( NumSlots );
+
+  TMap<int32, int32> WordScores;
+  for( int32 q = 0; q < QueryWords.Num(); q++ )
+  {
+    const FString& Prefix = QueryWords[q];
+
+    // Best score of the slot over the words starting with this query word
+    WordScores.Reset();
+    int32 First = Algo::LowerBoundBy( SortedWordIds, Prefix, [this]( int32 Id ) -> const FString& { return Words[Id]; },
+      []( const FString& A, const FString& B ) { return A.Compare( B, ESearchCase::CaseSensitive ) < 0; } );
+    for( int32 i = First; i < SortedWordIds.Num(); i++ )
+    {
+      int32 Id = SortedWordIds[i];
+      const FString& Word = Words[Id];
+      if( !Word.StartsWith( Prefix, ESearchCase::CaseSensitive ) )
+      {
+        break;
+      }
+
+      int32 Multiplier = Word.Len() == Prefix.Len() ? 2 : 1;
+      for( const FPosting& Posting : Postings[Id] )
+      {
+        int32& Best = WordScores.FindOrAdd( Posting.Slot );
+        Best = FMath::Max( Best, Posting.Weight * Multiplier );
+      }
+    }
+
+    // Slots have to match every query word before this one to stay in
+    for( const TPair<int32, int32>& WordScore : WordScores )
+    {
+      if( NumMatched[WordScore.Key] == q )
+      {
+        NumMatched[WordScore.Key]++;
+        Scores[WordScore.Key] += WordScore.Value;
+      }
+    }
+  }
+
+  for( int32 Slot = 0; Slot < NumSlots; Slot++ )
+  {
+    if( NumMatched[Slot] == QueryWords.Num() )
+    {
+      OutHits.Add( { Slot, Scores[Slot] } );
+    }
+  }
+
+  OutHits.Sort( []( const FModioSearchHit& A, const FModioSearchHit& B )
+  {
+    return A.Score != B.Score ? A.Score > B.Score : A.Slot < B.Slot;
+  });
+
+  if( MaxResults > 0 && OutHits.Num() > MaxResults )
+  {
+    OutHits.SetNum( MaxResults, false );
+  }
+}
+
+SIZE_T FModioModSearchIndex::GetAllocatedSize() const
+{
+  SIZE_T Size = Words.GetAllocatedSize() + IdsByWord.GetAllocatedSize() + Postings.GetAllocatedSize() +
+    SlotWordIds.GetAllocatedSize() + SortedWordIds.GetAllocatedSize();
+  for( const FString& Word : Words )
+  {
+    // Once for Words and once for the key of IdsByWord
+    Size += Word.GetAllocatedSize() * 2;
+  }
+  for( const TArray<FPosting>& WordPostings : Postings )
+  {
+    Size += WordPostings.GetAllocatedSize();
+  }
+  for( const TArray<int32>& WordIds : SlotWordIds )
+  {
+    Size += WordIds.GetAllocatedSize();
+  }
+  return Size;
+}
+
+void FModioModSearchIndex::Tokenize( const FString& Text, TArray<FString>& OutWords )
+{
+  OutWords.Reset();
+
+  const TCHAR* Chars = *Text;
+  int32 Length = Text.Len();
+  int32 Start = INDEX_NONE;
+  for( int32 i = 0; i <= Length; i++ )
+  {
+    bool bWordChar = i < Length && FChar::IsAlnum( Chars[i] );
+    if( bWordChar && Start == INDEX_NONE )
+    {
+      Start = i;
+    }
+    else if( !bWordChar && Start != INDEX_NONE )
+    {
+      OutWords.Add( Text.Mid( Start, FMath::Min( i - Start, MaxWordLength ) ).ToLower() );
+      Start = INDEX_NONE;
+    }
+  }
+}
+
+void FModioModSearchIndex::AddWords( int32 Slot, const FString& Text, int32 Weight )
+{
+  TArray<FString> TextWords;
+  Tokenize( Text, TextWords );
+  for( const FString& Word : TextWords )
+  {
+    int32 Id = FindOrAddWordId( Word );
+    TArray<FPosting>& WordPostings = Postings[Id];
+
+    // A word found in several fields keeps the best weight
+    if( SlotWordIds[Slot].Contains( Id ) )
+    {
+      FPosting* Posting = WordPostings.FindByPredicate( [Slot]( const FPosting& Posting ) { return Posting.Slot == Slot; } );
+      Posting->Weight = FMath::Max( Posting->Weight, Weight );
+      continue;
+    }
+
+    WordPostings.Add( { Slot, Weight } );
+    SlotWordIds[Slot].Add( Id );
+  }
+}
+
+int32 FModioModSearchIndex::FindOrAddWordId( const FString& Word )
+{
+  if( const int32* Id = IdsByWord.Find( Word ) )
+  {
+    return *Id;
+  }
+
+  int32 Id = Words.Add( Word );
+  Postings.AddDefaulted();
+  IdsByWord.Add( Word, Id );
+  SortedWordIds.Add( Id );
+  bSortedWordsDirty = true;
+  return Id;
+}
+
+void FModioModSearchIndex::SortWords() const
+{
+  if( !bSortedWordsDirty )
+  {
+    return;
+  }
+
+  SortedWordIds.Sort( [this]( int32 A, int32 B )
+  {
+    return Words[A].Compare( Words[B], ESearchCase::CaseSensitive ) < 0;
+  });
+  bSortedWordsDirty = false;
+}
@@ -0,0 +1,153 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#include "ModioModTagIndex.h"
+
+void FModioModTagIndex::RegisterTagOptions( const TArray<FModioGameTagOption>& TagOptions )
+{
+  for( const FModioGameTagOption& TagOption : TagOptions )
+  {
+    for( const FString& Tag : TagOption.Tags )
+    {
+      FindOrAddTagId( Tag );
+    }
+  }
+}
+
+int32 FModioModTagIndex::FindTagId( const FString& Tag ) const
+{
+  const int32* Id = IdsByTag.Find( Tag );
+  return Id ? *Id : INDEX_NONE;
+}
+
+void FModioModTagIndex::SetSlotTags( int32 Slot, const TArray<FModioModTag>& Tags )
+{
+  ClearSlot( Slot );
+
+  if( SlotTagIds.Num() <= Slot )
+  {
+    SlotTagIds.SetNum( Slot + 1 );
+  }
+
+  int32 Word = Slot >> 6;
+  uint64 Bit = 1ull << ( Slot & 63 );
+  for( const FModioModTag& Tag : Tags )
+  {
+    int32 Id = FindOrAddTagId( Tag.Name );
+    TArray<uint64>& Bitmap = Bitmaps[Id];
+    if( Bitmap.Num() <= Word )
+    {
+      Bitmap.AddZeroed( Word + 1 - Bitmap.Num() );
+    }
+    Bitmap[Word] |= Bit;
+    SlotTagIds[Slot].AddUnique( Id );
+  }
+}
+
+void FModioModTagIndex::ClearSlot( int32 Slot )
+{
+  if( !SlotTagIds.IsValidIndex( Slot ) )
+  {
+    return;
+  }
+
+  int32 Word = Slot >> 6;
+  uint64 Bit = 1ull << ( Slot & 63 );
+  for( int32 Id : SlotTagIds[Slot] )
+  {
+    Bitmaps[Id][Word] &= ~Bit;
+  }
+  SlotTagIds[Slot].Reset();
+}
+
+void FModioModTagIndex::Reset()
+{
+  Bitmaps.Reset();
+  IdsByTag.Reset();
+  SlotTagIds.Reset();
+}
+
+void FModioModTagIndex::Evaluate( const FModioTagQuery& Query, int32 NumSlots, TArray<uint64>& OutWords ) const
+{
+  int32 NumWords = ( NumSlots + 63 ) >> 6;
+  OutWords.Reset( NumWords );
+  OutWords.AddUninitialized( NumWords );
+  for( int32 w = 0; w < NumWords; w++ )
+  {
+    OutWords[w] = ~0ull;
+  }
+  // Keep the bits past NumSlots clear
+  if( NumSlots & 63 )
+  {
+    OutWords[NumWords - 1] = ( 1ull << ( NumSlots & 63 ) ) - 1;
+  }
+
+  // Bitmaps are only as long as their highest slot, words past the end are all zeros
+  auto BitmapWord = []( const TArray<uint64>& Bitmap, int32 w )
+  {
+    return w < Bitmap.Num() ? Bitmap[w] : 0ull;
+  };
+
+  for( const FString& Tag : Query.AllOf )
+  {
+    int32 Id = FindTagId( Tag );
+    if( Id == INDEX_NONE )
+    {
+      // No mod has the tag, so none can have all of them
+      FMemory::Memzero( OutWords.GetData(), NumWords * sizeof( uint64 ) );
+      return;
+    }
+    const TArray<uint64>& Bitmap = Bitmaps[Id];
+    for( int32 w = 0; w < NumWords; w++ )
+    {
+      OutWords[w] &= BitmapWord( Bitmap, w );
+    }
+  }
+
+  if( Query.AnyOf.Num() )
+  {
+    TArray<uint64> AnyWords;
+    AnyWords.AddZeroed( NumWords );
+    for( const FString& Tag : Query.AnyOf )
+    {
+      int32 Id = FindTagId( Tag );
+      if( Id != INDEX_NONE )
+      {
+        const TArray<uint64>& Bitmap = Bitmaps[Id];
+        for( int32 w = 0, Count = FMath::Min( NumWords, Bitmap.Num() ); w < Count; w++ )
+        {
+          AnyWords[w] |= Bitmap[w];
+        }
+      }
+    }
+    for( int32 w = 0; w < NumWords; w++ )
+    {
+      OutWords[w] &= AnyWords[w];
+    }
+  }
+
+  for( const FString& Tag : Query.NoneOf )
+  {
+    int32 Id = FindTagId( Tag );
+    if( Id != INDEX_NONE )
+    {
+      const TArray<uint64>& Bitmap = Bitmaps[Id];
+      for( int32 w = 0, Count = FMath::Min( NumWords, Bitmap.Num() ); w < Count; w++ )
+      {
+        OutWords[w] &= ~Bitmap[w];
+      }
+    }
+  }
+}
+
+int32 FModioModTagIndex::FindOrAddTagId( const FString& Tag )
+{
+  if( const int32* Id = IdsByTag.Find( Tag ) )
+  {
+    return *Id;
+  }
+
+  int32 Id = Bitmaps.AddDefaulted();
+  IdsByTag.Add( Tag, Id );
+  return Id;
+}
@@ -90,6 +90,28 @@ void FModioModule::StartupModule()
   
   const UModioSettings *Settings = GetDefault<UModioSettings>();
   ModioImp = FModioSubsystem::Create(Settings->RootDirectory, Settings->bRootDirectoryIsInUserSettingsDirectory, Settings->GameId, Settings->ApiKey, Settings->bIsLiveEnvironment, Settings->bInstallOnModDownload, Settings->bRetrieveModsFromOtherGames, Settings->bEnablePolling);
+  if (ModioImp.IsValid())
+  {
+    ModioImp->SetGetModBatching(Settings->bBatchGetModCalls, Settings->GetModBatchWindow);
+    ModioImp->SetBackgroundProcessing(Settings->bProcessInBackground);
+    ModioImp->SetDispatchBudget(Settings->DispatchBudgetMicroseconds);
+    ModioImp->SetRequestLimit(EModioRequestPriority::INTERACTIVE, Settings->InteractiveRequestLimit);
+    ModioImp->SetRequestLimit(EModioRequestPriority::NORMAL, Settings->NormalRequestLimit);
+    ModioImp->SetRequestLimit(EModioRequestPriority::BACKGROUND, Settings->BackgroundRequestLimit);
+    ModioImp->SetDefaultModFields((EModioModFields)Settings->DefaultModFields);
+    ModioImp->SetModCatalogEnabled(Settings->bKeepModCatalog);
+    ModioImp->SetModCatalogStoreEnabled(Settings->bStoreModCatalog);
+    ModioImp->SetSearchDebounce(Settings->SearchDebounceSeconds);
+    ModioImp->SetResponseCacheBudget((int64)Settings->ResponseCacheBudgetKB * 1024);
+    ModioImp->SetResponseCacheTimeToLive(TEXT("GetMod"), Settings->ModResponseTimeToLive);
+    ModioImp->SetResponseCacheTimeToLive(TEXT("GetAllMods"), Settings->ModResponseTimeToLive);
+    ModioImp->SetResponseCacheStaleTime(TEXT("GetMod"), Settings->ModResponseStaleTime);
+    ModioImp->SetResponseCacheStaleTime(TEXT("GetAllMods"), Settings->ModResponseStaleTime);
+    ModioImp->SetResponseCacheTimeToLive(TEXT("GetGame"), Settings->GameResponseTimeToLive);
+    ModioImp->SetResponseCacheTimeToLive(TEXT("GetAllModTags"), Settings->ModDetailsResponseTimeToLive);
+    ModioImp->SetResponseCacheTimeToLive(TEXT("GetAllModfiles"), Settings->ModDetailsResponseTimeToLive);
+    ModioImp->SetResponseCacheTimeToLive(TEXT("GetAllModDependencies"), Settings->ModDetailsResponseTimeToLive);
+  }
 
   // Need GIsEdtor check as this might run when running the game but not with the editor
   if (GIsEditor)
@@ -146,6 +168,28 @@ bool FModioModule::HandleSettingsSaved()
 
   UE_LOG(LogTemp, Log, TEXT("Settings->bIsLiveEnvironment = %s"), Settings->bIsLiveEnvironment ? TEXT("TRUE") : TEXT("FALSE") );
   ModioImp = FModioSubsystem::Create(Settings->RootDirectory, Settings->bRootDirectoryIsInUserSettingsDirectory, Settings->GameId, Settings->ApiKey, Settings->bIsLiveEnvironment, Settings->bInstallOnModDownload, Settings->bRetrieveModsFromOtherGames, Settings->bEnablePolling);
+  if (ModioImp.IsValid())
+  {
+    ModioImp->SetGetModBatching(Settings->bBatchGetModCalls, Settings->GetModBatchWindow);
+    ModioImp->SetBackgroundProcessing(Settings->bProcessInBackground);
+    ModioImp->SetDispatchBudget(Settings->DispatchBudgetMicroseconds);
+    ModioImp->SetRequestLimit(EModioRequestPriority::INTERACTIVE, Settings->InteractiveRequestLimit);
+    ModioImp->SetRequestLimit(EModioRequestPriority::NORMAL, Settings->NormalRequestLimit);
+    ModioImp->SetRequestLimit(EModioRequestPriority::BACKGROUND, Settings->BackgroundRequestLimit);
+    ModioImp->SetDefaultModFields((EModioModFields)Settings->DefaultModFields);
+    ModioImp->SetModCatalogEnabled(Settings->bKeepModCatalog);
+    ModioImp->SetModCatalogStoreEnabled(Settings->bStoreModCatalog);
+    ModioImp->SetSearchDebounce(Settings->SearchDebounceSeconds);
+    ModioImp->SetResponseCacheBudget((int64)Settings->ResponseCacheBudgetKB * 1024);
+    ModioImp->SetResponseCacheTimeToLive(TEXT("GetMod"), Settings->ModResponseTimeToLive);
+    ModioImp->SetResponseCacheTimeToLive(TEXT("GetAllMods"), Settings->ModResponseTimeToLive);
+    ModioImp->SetResponseCacheStaleTime(TEXT("GetMod"), Settings->ModResponseStaleTime);
+    ModioImp->SetResponseCacheStaleTime(TEXT("GetAllMods"), Settings->ModResponseStaleTime);
+    ModioImp->SetResponseCacheTimeToLive(TEXT("GetGame"), Settings->GameResponseTimeToLive);
+    ModioImp->SetResponseCacheTimeToLive(TEXT("GetAllModTags"), Settings->ModDetailsResponseTimeToLive);
+    ModioImp->SetResponseCacheTimeToLive(TEXT("GetAllModfiles"), Settings->ModDetailsResponseTimeToLive);
+    ModioImp->SetResponseCacheTimeToLive(TEXT("GetAllModDependencies"), Settings->ModDetailsResponseTimeToLive);
+  }
 
   return true;
 }
@@ -0,0 +1,40 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#include "ModioProcessWorker.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/PlatformProcess.h"
+
+const float FModioProcessWorker::ProcessInterval = 0.005f;
+
+FModioProcessWorker::FModioProcessWorker( TFunction<void()> InProcess ) :
+  Process( MoveTemp( InProcess ) ),
+  Thread( nullptr )
+{
+  Thread = FRunnableThread::Create( this, TEXT( "ModioProcessWorker" ), 0, TPri_BelowNormal );
+}
+
+FModioProcessWorker::~FModioProcessWorker()
+{
+  if( Thread )
+  {
+    Thread->Kill( true );
+    delete Thread;
+    Thread = nullptr;
+  }
+}
+
+uint32 FModioProcessWorker::Run()
+{
+  while( StopRequested.GetValue() == 0 )
+  {
+    Process();
+    FPlatformProcess::Sleep( ProcessInterval );
+  }
+  return 0;
+}
+
+void FModioProcessWorker::Stop()
+{
+  StopRequested.Increment();
+}
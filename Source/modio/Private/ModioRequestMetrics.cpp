@@ -0,0 +1,121 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#include "ModioRequestMetrics.h"
+#include "ModioStats.h"
+
+DEFINE_STAT( STAT_ModioRequestsFinished );
+DEFINE_STAT( STAT_ModioResultsReceived );
+DEFINE_STAT( STAT_ModioWaitTime );
+DEFINE_STAT( STAT_ModioNetworkTime );
+DEFINE_STAT( STAT_ModioConversionTime );
+DEFINE_STAT( STAT_ModioQueueTime );
+
+/** Time between two timestamps, 0 if any of them wasn't reached */
+static double Elapsed( double Start, double End )
+{
+  return Start > 0.0 && End >= Start ? End - Start : 0.0;
+}
+
+FModioRequestMetrics::FHistogram::FHistogram() :
+  NumSamples( 0 ),
+  MaxSeconds( 0.0 )
+{
+  FMemory::Memzero( Buckets );
+}
+
+void FModioRequestMetrics::FHistogram::Add( double Seconds )
+{
+  double Microseconds = Seconds * 1000000.0;
+  int32 Bucket = Microseconds > 1.0 ? FMath::FloorToInt( FMath::Log2( Microseconds ) * 4.0 ) : 0;
+  Buckets[FMath::Clamp( Bucket, 0, NumBuckets - 1 )]++;
+  NumSamples++;
+  MaxSeconds = FMath::Max( MaxSeconds, Seconds );
+}
+
+FModioLatencyPercentiles FModioRequestMetrics::FHistogram::GetPercentiles() const
+{
+  FModioLatencyPercentiles Percentiles;
+  if( NumSamples == 0 )
+  {
+    return Percentiles;
+  }
+
+  float MaxMs = MaxSeconds * 1000.0;
+  auto Percentile = [this, MaxMs]( float Fraction )
+  {
+    int32 Rank = FMath::CeilToInt( Fraction * NumSamples );
+    int32 Seen = 0;
+    for( int32 i = 0; i < NumBuckets; i++ )
+    {
+      Seen += Buckets[i];
+      if( Seen >= Rank )
+      {
+        // Upper bound of the bucket, the max is exact so there is no point going over it
+        return FMath::Min( FMath::Pow( 2.0f, ( i + 1 ) / 4.0f ) / 1000.0f, MaxMs );
+      }
+    }
+    return MaxMs;
+  };
+
+  Percentiles.P50 = Percentile( 0.50f );
+  Percentiles.P95 = Percentile( 0.95f );
+  Percentiles.P99 = Percentile( 0.99f );
+  Percentiles.Max = MaxMs;
+  return Percentiles;
+}
+
+void FModioRequestMetrics::Record( const FModioRequestTimings &Timings, double DispatchStart, double DispatchEnd )
+{
+  // Requests answered from the cache or without calling the SDK were never issued
+  double IssueTime = Timings.IssueTime > 0.0 ? Timings.IssueTime : Timings.CreateTime;
+  double WaitTime = Elapsed( Timings.CreateTime, IssueTime );
+  double NetworkTime = Elapsed( IssueTime, Timings.ResponseTime );
+  double ConversionTime = Elapsed( Timings.ResponseTime, Timings.ConvertedTime );
+  double QueueTime = Elapsed( Timings.ConvertedTime, DispatchStart );
+
+  FEndpoint& Endpoint = Endpoints.FindOrAdd( FName( Timings.Endpoint ) );
+  Endpoint.NumRequests++;
+  Endpoint.NumResults += Timings.NumResults;
+  if( Timings.ResponseCode < 200 || Timings.ResponseCode >= 300 )
+  {
+    Endpoint.NumFailed++;
+  }
+  Endpoint.Wait.Add( WaitTime );
+  Endpoint.Network.Add( NetworkTime );
+  Endpoint.Conversion.Add( ConversionTime );
+  Endpoint.Queue.Add( QueueTime );
+  Endpoint.Dispatch.Add( Elapsed( DispatchStart, DispatchEnd ) );
+
+  INC_DWORD_STAT( STAT_ModioRequestsFinished );
+  INC_DWORD_STAT_BY( STAT_ModioResultsReceived, Timings.NumResults );
+  INC_FLOAT_STAT_BY( STAT_ModioWaitTime, WaitTime * 1000.0 );
+  INC_FLOAT_STAT_BY( STAT_ModioNetworkTime, NetworkTime * 1000.0 );
+  INC_FLOAT_STAT_BY( STAT_ModioConversionTime, ConversionTime * 1000.0 );
+  INC_FLOAT_STAT_BY( STAT_ModioQueueTime, QueueTime * 1000.0 );
+}
+
+TArray<FModioEndpointMetrics> FModioRequestMetrics::GetMetrics() const
+{
+  TArray<FModioEndpointMetrics> Metrics;
+  Metrics.Reserve( Endpoints.Num() );
+  for( const TPair<FName, FEndpoint>& Endpoint : Endpoints )
+  {
+    FModioEndpointMetrics& EndpointMetrics = Metrics.AddDefaulted_GetRef();
+    EndpointMetrics.Endpoint = Endpoint.Key;
+    EndpointMetrics.NumRequests = Endpoint.Value.NumRequests;
+    EndpointMetrics.NumFailed = Endpoint.Value.NumFailed;
+    EndpointMetrics.NumResults = Endpoint.Value.NumResults;
+    EndpointMetrics.Wait = Endpoint.Value.Wait.GetPercentiles();
+    EndpointMetrics.Network = Endpoint.Value.Network.GetPercentiles();
+    EndpointMetrics.Conversion = Endpoint.Value.Conversion.GetPercentiles();
+    EndpointMetrics.Queue = Endpoint.Value.Queue.GetPercentiles();
+    EndpointMetrics.Dispatch = Endpoint.Value.Dispatch.GetPercentiles();
+  }
+  return Metrics;
+}
+
+void FModioRequestMetrics::Reset()
+{
+  Endpoints.Reset();
+}
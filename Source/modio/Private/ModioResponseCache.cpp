@@ -0,0 +1,303 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#include "ModioResponseCache.h"
+#include "ModioStats.h"
+#include "Schemas/ModioMod.h"
+#include "Schemas/ModioGame.h"
+#include "Schemas/ModioModfile.h"
+#include "Schemas/ModioModTag.h"
+#include "Schemas/ModioModDependency.h"
+#include "Hash/CityHash.h"
+
+DEFINE_STAT( STAT_ModioResponseCacheHits );
+DEFINE_STAT( STAT_ModioResponseCacheMisses );
+DEFINE_STAT( STAT_ModioResponseCacheMemory );
+
+// Only what the structs allocate, their own size is counted by whoever holds them
+
+static SIZE_T AllocatedSize( const FString& String )
+{
+  return String.GetAllocatedSize();
+}
+
+static SIZE_T AllocatedSize( const TArray<FString>& Strings )
+{
+  SIZE_T Size = Strings.GetAllocatedSize();
+  for( const FString& String : Strings )
+  {
+    Size += String.GetAllocatedSize();
+  }
+  return Size;
+}
+
+static SIZE_T AllocatedSize( const FModioLogo& Logo )
+{
+  return AllocatedSize( Logo.Filename ) + AllocatedSize( Logo.Original ) + AllocatedSize( Logo.Thumb320x180 ) +
+    AllocatedSize( Logo.Thumb640x360 ) + AllocatedSize( Logo.Thumb1280x720 );
+}
+
+static SIZE_T AllocatedSize( const FModioUser& User )
+{
+  return AllocatedSize( User.Username ) + AllocatedSize( User.NameId ) + AllocatedSize( User.Timezone ) +
+    AllocatedSize( User.Language ) + AllocatedSize( User.ProfileUrl ) + AllocatedSize( User.Avatar.Filename ) +
+    AllocatedSize( User.Avatar.Original ) + AllocatedSize( User.Avatar.Thumb50x50 ) + AllocatedSize( User.Avatar.Thumb100x100 );
+}
+
+static SIZE_T AllocatedSize( const FModioModfile& Modfile )
+{
+  return AllocatedSize( Modfile.Filename ) + AllocatedSize( Modfile.Version ) + AllocatedSize( Modfile.VirustotalHash ) +
+    AllocatedSize( Modfile.Changelog ) + AllocatedSize( Modfile.MetadataBlob ) + AllocatedSize( Modfile.Filehash.Md5 ) +
+    AllocatedSize( Modfile.Download.BinaryUrl );
+}
+
+SIZE_T ModioCacheSize( const FModioMod& Mod )
+{
+  SIZE_T Size = sizeof( Mod );
+  Size += AllocatedSize( Mod.HomepageUrl ) + AllocatedSize( Mod.Name ) + AllocatedSize( Mod.NameId ) + AllocatedSize( Mod.Summary );
+  Size += AllocatedSize( Mod.Description ) + AllocatedSize( Mod.DescriptionPlainText ) + AllocatedSize( Mod.MetadataBlob );
+  Size += AllocatedSize( Mod.ProfileUrl ) + AllocatedSize( Mod.Logo ) + AllocatedSize( Mod.SubmittedBy );
+  Size += AllocatedSize( Mod.Modfile ) + AllocatedSize( Mod.Stats.RatingsDisplayText );
+  Size += AllocatedSize( Mod.Media.Youtube ) + AllocatedSize( Mod.Media.Sketchfab ) + Mod.Media.Images.GetAllocatedSize();
+  for( const FModioImage& Image : Mod.Media.Images )
+  {
+    Size += AllocatedSize( Image.Filename ) + AllocatedSize( Image.Original ) + AllocatedSize( Image.Thumb320x180 );
+  }
+  Size += Mod.Tags.GetAllocatedSize() + Mod.MetadataKVP.GetAllocatedSize();
+  for( const FModioMetadataKVP& KVP : Mod.MetadataKVP )
+  {
+    Size += AllocatedSize( KVP.Metakey ) + AllocatedSize( KVP.Metavalue );
+  }
+  return Size;
+}
+
+SIZE_T ModioCacheSize( const FModioGame& Game )
+{
+  SIZE_T Size = sizeof( Game );
+  Size += AllocatedSize( Game.UGCName ) + AllocatedSize( Game.Name ) + AllocatedSize( Game.NameId ) + AllocatedSize( Game.Summary );
+  Size += AllocatedSize( Game.Instructions ) + AllocatedSize( Game.InstructionsUrl ) + AllocatedSize( Game.ProfileUrl );
+  Size += AllocatedSize( Game.SubmittedBy ) + AllocatedSize( Game.Logo );
+  Size += AllocatedSize( Game.Icon.Filename ) + AllocatedSize( Game.Icon.Original ) + AllocatedSize( Game.Icon.Thumb64x64 );
+  Size += AllocatedSize( Game.Icon.Thumb128x128 ) + AllocatedSize( Game.Icon.Thumb256x256 );
+  Size += AllocatedSize( Game.Header.Filename ) + AllocatedSize( Game.Header.Original );
+  Size += Game.TagOptions.GetAllocatedSize();
+  for( const FModioGameTagOption& TagOption : Game.TagOptions )
+  {
+    Size += AllocatedSize( TagOption.Name ) + AllocatedSize( TagOption.Type ) + AllocatedSize( TagOption.Tags );
+  }
+  return Size;
+}
+
+SIZE_T ModioCacheSize( const FModioModfile& Modfile )
+{
+  return sizeof( Modfile ) + AllocatedSize( Modfile );
+}
+
+SIZE_T ModioCacheSize( const FModioModTag& ModTag )
+{
+  return sizeof( ModTag ) + AllocatedSize( ModTag.Name );
+}
+
+SIZE_T ModioCacheSize( const FModioModDependency& ModDependency )
+{
+  return sizeof( ModDependency );
+}
+
+FModioResponseCache::FModioResponseCache() :
+  Budget( 0 )
+{
+}
+
+void FModioResponseCache::SetBudget( int64 Bytes )
+{
+  Budget = FMath::Max<int64>( Bytes, 0 );
+  if( Budget == 0 )
+  {
+    Reset();
+  }
+  else
+  {
+    EvictOverBudget();
+  }
+}
+
+void FModioResponseCache::SetTimeToLive( FName Endpoint, double Seconds )
+{
+  if( Seconds > 0.0 )
+  {
+    TimesToLive.Add( Endpoint, Seconds );
+    return;
+  }
+
+  TimesToLive.Remove( Endpoint );
+  TArray<uint64> Dropped;
+  for( const TPair<uint64, FEntry>& Entry : Entries )
+  {
+    if( Entry.Value.Endpoint == Endpoint )
+    {
+      Dropped.Add( Entry.Key );
+    }
+  }
+  for( uint64 Hash : Dropped )
+  {
+    RemoveEntry( Hash );
+  }
+  UpdateStats();
+}
+
+void FModioResponseCache::SetStaleTime( FName Endpoint, double Seconds )
+{
+  if( Seconds > 0.0 )
+  {
+    StaleTimes.Add( Endpoint, Seconds );
+  }
+  else
+  {
+    StaleTimes.Remove( Endpoint );
+  }
+}
+
+bool FModioResponseCache::IsEnabled( FName Endpoint ) const
+{
+  return Budget > 0 && TimesToLive.Contains( Endpoint );
+}
+
+void FModioResponseCache::Remove( const FString& Key )
+{
+  uint64 Hash = HashKey( Key );
+  const FEntry* Entry = Entries.Find( Hash );
+  if( Entry && Entry->Key.Equals( Key, ESearchCase::CaseSensitive ) )
+  {
+    RemoveEntry( Hash );
+    UpdateStats();
+  }
+}
+
+void FModioResponseCache::RemoveByPrefix( const FString& Prefix )
+{
+  TArray<uint64> Dropped;
+  for( const TPair<uint64, FEntry>& Entry : Entries )
+  {
+    if( Entry.Value.Key.StartsWith( Prefix, ESearchCase::CaseSensitive ) )
+    {
+      Dropped.Add( Entry.Key );
+    }
+  }
+  for( uint64 Hash : Dropped )
+  {
+    RemoveEntry( Hash );
+  }
+  UpdateStats();
+}
+
+void FModioResponseCache::Reset()
+{
+  Entries.Empty();
+  Lru.Empty();
+  Stats.Bytes = 0;
+  UpdateStats();
+}
+
+uint64 FModioResponseCache::HashKey( const FString& Key )
+{
+  return CityHash64( (const char*)*Key, Key.Len() * sizeof( TCHAR ) );
+}
+
+const FModioResponseCache::FEntry* FModioResponseCache::FindEntry( FName Endpoint, const FString& Key, const void* TypeId, bool bAllowStale, bool& bOutStale )
+{
+  if( !IsEnabled( Endpoint ) )
+  {
+    return nullptr;
+  }
+
+  uint64 Hash = HashKey( Key );
+  FEntry* Entry = Entries.Find( Hash );
+  bOutStale = false;
+  if( Entry )
+  {
+    double Now = FPlatformTime::Seconds();
+    const double* StaleTime = StaleTimes.Find( Endpoint );
+    if( Entry->ExpireTime + ( StaleTime ? *StaleTime : 0.0 ) <= Now )
+    {
+      RemoveEntry( Hash );
+      UpdateStats();
+      Entry = nullptr;
+    }
+    else
+    {
+      bOutStale = Entry->ExpireTime <= Now;
+    }
+  }
+
+  if( !Entry || ( bOutStale && !bAllowStale ) || Entry->TypeId != TypeId || !Entry->Key.Equals( Key, ESearchCase::CaseSensitive ) )
+  {
+    Stats.Misses++;
+    INC_DWORD_STAT( STAT_ModioResponseCacheMisses );
+    return nullptr;
+  }
+
+  Lru.RemoveNode( Entry->LruNode, false );
+  Lru.AddHead( Entry->LruNode );
+
+  Stats.Hits++;
+  Stats.StaleHits += bOutStale ? 1 : 0;
+  INC_DWORD_STAT( STAT_ModioResponseCacheHits );
+  return Entry;
+}
+
+void FModioResponseCache::AddEntry( FName Endpoint, const FString& Key, const FModioResponse& Response, TSharedPtr<const void> Value, const void* TypeId, int64 ValueBytes )
+{
+  uint64 Hash = HashKey( Key );
+  if( Entries.Contains( Hash ) )
+  {
+    RemoveEntry( Hash );
+  }
+
+  int64 Bytes = ValueBytes + sizeof( FEntry ) + Key.GetAllocatedSize() + Response.Error.Message.GetAllocatedSize();
+  if( Bytes > Budget )
+  {
+    // Would push everything else out and still not fit
+    UpdateStats();
+    return;
+  }
+
+  FEntry& Entry = Entries.Add( Hash );
+  Entry.Key = Key;
+  Entry.Endpoint = Endpoint;
+  Entry.Response = Response;
+  Entry.Value = MoveTemp( Value );
+  Entry.TypeId = TypeId;
+  Entry.ExpireTime = FPlatformTime::Seconds() + TimesToLive.FindChecked( Endpoint );
+  Entry.Bytes = Bytes;
+  Lru.AddHead( Hash );
+  Entry.LruNode = Lru.GetHead();
+  Stats.Bytes += Bytes;
+
+  EvictOverBudget();
+  UpdateStats();
+}
+
+void FModioResponseCache::RemoveEntry( uint64 Hash )
+{
+  FEntry Entry;
+  if( Entries.RemoveAndCopyValue( Hash, Entry ) )
+  {
+    Lru.RemoveNode( Entry.LruNode );
+    Stats.Bytes -= Entry.Bytes;
+  }
+}
+
+void FModioResponseCache::EvictOverBudget()
+{
+  while( Stats.Bytes > Budget && Lru.GetTail() )
+  {
+    RemoveEntry( Lru.GetTail()->GetValue() );
+    Stats.Evictions++;
+  }
+}
+
+void FModioResponseCache::UpdateStats()
+{
+  Stats.NumEntries = Entries.Num();
+  SET_MEMORY_STAT( STAT_ModioResponseCacheMemory, Stats.Bytes );
+}
@@ -5,7 +5,23 @@
 
 UModioSettings::UModioSettings(const FObjectInitializer& ObjectInitializer) :
   Super(ObjectInitializer),
-  bRunOnDedicatedServer( false )
+  bRunOnDedicatedServer( false ),
+  bBatchGetModCalls( false ),
+  GetModBatchWindow( 0.0f ),
+  bProcessInBackground( false ),
+  DispatchBudgetMicroseconds( 0 ),
+  InteractiveRequestLimit( 0 ),
+  NormalRequestLimit( 0 ),
+  BackgroundRequestLimit( 2 ),
+  DefaultModFields( (int32)EModioModFields::All ),
+  bKeepModCatalog( false ),
+  bStoreModCatalog( false ),
+  SearchDebounceSeconds( 0.3f ),
+  ResponseCacheBudgetKB( 0 ),
+  ModResponseTimeToLive( 60.0f ),
+  ModResponseStaleTime( 240.0f ),
+  GameResponseTimeToLive( 600.0f ),
+  ModDetailsResponseTimeToLive( 120.0f )
 {
 
 }
\ No newline at end of file
@@ -0,0 +1,187 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#include "ModioStringConversion.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON && ( defined( __aarch64__ ) || defined( _M_ARM64 ) )
+  #define MODIO_UTF8_NEON 1
+  #include <arm_neon.h>
+#elif PLATFORM_ENABLE_VECTORINTRINSICS && PLATFORM_CPU_X86_FAMILY
+  #define MODIO_UTF8_SSE2 1
+  #include <emmintrin.h>
+#endif
+
+#ifndef MODIO_UTF8_NEON
+  #define MODIO_UTF8_NEON 0
+#endif
+#ifndef MODIO_UTF8_SSE2
+  #define MODIO_UTF8_SSE2 0
+#endif
+
+static_assert( sizeof( TCHAR ) == 2 || sizeof( TCHAR ) == 4, "TCHAR is expected to be UTF-16 or UTF-32" );
+
+static const uint32 ReplacementCharacter = 0xFFFD;
+
+/** Widens the ASCII bytes at the start of In, stops at the first byte that isn't ASCII. Returns the bytes widened */
+static int32 WidenAscii( TCHAR* Out, const uint8* In, int32 Length )
+{
+  int32 i = 0;
+
+#if MODIO_UTF8_SSE2
+  const __m128i Zero = _mm_setzero_si128();
+  for( ; i + 16 <= Length; i += 16 )
+  {
+    __m128i Bytes = _mm_loadu_si128( (const __m128i*)( In + i ) );
+    if( _mm_movemask_epi8( Bytes ) != 0 )
+    {
+      break;
+    }
+
+    __m128i Low = _mm_unpacklo_epi8( Bytes, Zero );
+    __m128i High = _mm_unpackhi_epi8( Bytes, Zero );
+    if( sizeof( TCHAR ) == 2 )
+    {
+      _mm_storeu_si128( (__m128i*)( Out + i ), Low );
+      _mm_storeu_si128( (__m128i*)( Out + i + 8 ), High );
+    }
+    else
+    {
+      _mm_storeu_si128( (__m128i*)( Out + i ), _mm_unpacklo_epi16( Low, Zero ) );
+      _mm_storeu_si128( (__m128i*)( Out + i + 4 ), _mm_unpackhi_epi16( Low, Zero ) );
+      _mm_storeu_si128( (__m128i*)( Out + i + 8 ), _mm_unpacklo_epi16( High, Zero ) );
+      _mm_storeu_si128( (__m128i*)( Out + i + 12 ), _mm_unpackhi_epi16( High, Zero ) );
+    }
+  }
+#elif MODIO_UTF8_NEON
+  for( ; i + 16 <= Length; i += 16 )
+  {
+    uint8x16_t Bytes = vld1q_u8( In + i );
+    if( vmaxvq_u8( Bytes ) >= 0x80 )
+    {
+      break;
+    }
+
+    uint16x8_t Low = vmovl_u8( vget_low_u8( Bytes ) );
+    uint16x8_t High = vmovl_u8( vget_high_u8( Bytes ) );
+    if( sizeof( TCHAR ) == 2 )
+    {
+      vst1q_u16( (uint16*)( Out + i ), Low );
+      vst1q_u16( (uint16*)( Out + i + 8 ), High );
+    }
+    else
+    {
+      vst1q_u32( (uint32*)( Out + i ), vmovl_u16( vget_low_u16( Low ) ) );
+      vst1q_u32( (uint32*)( Out + i + 4 ), vmovl_u16( vget_high_u16( Low ) ) );
+      vst1q_u32( (uint32*)( Out + i + 8 ), vmovl_u16( vget_low_u16( High ) ) );
+      vst1q_u32( (uint32*)( Out + i + 12 ), vmovl_u16( vget_high_u16( High ) ) );
+    }
+  }
+#endif
+
+  for( ; i < Length && In[i] < 0x80; i++ )
+  {
+    Out[i] = (TCHAR)In[i];
+  }
+  return i;
+}
+
+/** Decodes the multibyte sequence at In[Index] and moves Index past it. A malformed sequence only consumes it's lead byte */
+static uint32 DecodeCodePoint( const uint8* In, int32 Length, int32& Index )
+{
+  uint8 Lead = In[Index++];
+  int32 NumContinuations;
+  uint32 CodePoint;
+  uint32 MinCodePoint;
+  if( ( Lead & 0xE0 ) == 0xC0 )
+  {
+    NumContinuations = 1;
+    CodePoint = Lead & 0x1F;
+    MinCodePoint = 0x80;
+  }
+  else if( ( Lead & 0xF0 ) == 0xE0 )
+  {
+    NumContinuations = 2;
+    CodePoint = Lead & 0x0F;
+    MinCodePoint = 0x800;
+  }
+  else if( ( Lead & 0xF8 ) == 0xF0 )
+  {
+    NumContinuations = 3;
+    CodePoint = Lead & 0x07;
+    MinCodePoint = 0x10000;
+  }
+  else
+  {
+    return ReplacementCharacter;
+  }
+
+  int32 Start = Index;
+  for( int32 i = 0; i < NumContinuations; i++ )
+  {
+    if( Start + i >= Length || ( In[Start + i] & 0xC0 ) != 0x80 )
+    {
+      return ReplacementCharacter;
+    }
+    CodePoint = ( CodePoint << 6 ) | ( In[Start + i] & 0x3F );
+  }
+
+  // Overlong encodings, surrogates and code points past the unicode range are all invalid
+  if( CodePoint < MinCodePoint || CodePoint > 0x10FFFF || ( CodePoint >= 0xD800 && CodePoint <= 0xDFFF ) )
+  {
+    return ReplacementCharacter;
+  }
+
+  Index += NumContinuations;
+  return CodePoint;
+}
+
+/** Writes CodePoint to Out, as a surrogate pair if it doesn't fit a UTF-16 TCHAR. Returns the TCHARs written */
+static int32 EncodeCodePoint( TCHAR* Out, uint32 CodePoint )
+{
+  if( sizeof( TCHAR ) == 2 && CodePoint > 0xFFFF )
+  {
+    CodePoint -= 0x10000;
+    Out[0] = (TCHAR)( 0xD800 + ( CodePoint >> 10 ) );
+    Out[1] = (TCHAR)( 0xDC00 + ( CodePoint & 0x3FF ) );
+    return 2;
+  }
+
+  Out[0] = (TCHAR)CodePoint;
+  return 1;
+}
+
+void ModioUtf8ToString( FString& Out, const char* String )
+{
+  ModioUtf8ToString( Out, String, String ? FCStringAnsi::Strlen( String ) : 0 );
+}
+
+void ModioUtf8ToString( FString& Out, const char* String, int32 Length )
+{
+  TArray<TCHAR>& Chars = Out.GetCharArray();
+  if( !String || Length <= 0 )
+  {
+    Chars.Reset();
+    return;
+  }
+
+  // A UTF-8 sequence is never shorter than the UTF-16 or UTF-32 it decodes to, so Length is always enough
+  Chars.SetNumUninitialized( Length + 1, false );
+  TCHAR* Dest = Chars.GetData();
+  const uint8* In = (const uint8*)String;
+
+  int32 Read = 0;
+  int32 Written = 0;
+  while( Read < Length )
+  {
+    int32 NumAscii = WidenAscii( Dest + Written, In + Read, Length - Read );
+    Read += NumAscii;
+    Written += NumAscii;
+    if( Read < Length )
+    {
+      Written += EncodeCodePoint( Dest + Written, DecodeCodePoint( In, Length, Read ) );
+    }
+  }
+
+  Dest[Written] = TEXT( '\0' );
+  Chars.SetNum( Written + 1, false );
+}
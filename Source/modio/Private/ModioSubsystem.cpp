@@ -7,12 +7,18 @@
 #include "ModioSettings.h"
 #include "ModioModule.h"
 #include "ModioUE4Utility.h"
+#include "ModioStats.h"
+#include "ModioBinaryStore.h"
 #include "Schemas/ModioResponse.h"
 #include "Engine/Engine.h"
 #include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
 #include <sstream>
 #include <iostream>
 
+DEFINE_STAT( STAT_ModioCancelledRequests );
+DEFINE_STAT( STAT_ModioSearchIndexMemory );
+
 FModioListenerDelegate FModioSubsystem::ModioOnModDownloadDelegate;
 FModioListenerDelegate FModioSubsystem::ModioOnModUploadDelegate;
 FModioModEventArrayDelegate FModioSubsystem::ModioOnModEventDelegate;
@@ -28,9 +34,33 @@ protected:
 
 LStream UE4Stream;
 
+/** Most ids the backend accepts for a single id-in query */
+static const int32 GetModBatchLimit = 100;
+
+/** Subsystem the SDK listeners report to, the SDK only supports one instance at a time */
+static FModioSubsystem* ListenerSubsystem = nullptr;
+
 FModioSubsystem::FModioSubsystem() :
+  PriorityOverride(EModioRequestPriority::PRIORITY_MAX),
+  bProcessInBackground(false),
+  bAdmittingRequests(false),
+  NumCancelledRequests(0),
+  PendingGetModBatchStartTime(0.0),
+  GetModBatchWindow(0.0f),
+  StoreGameId(0),
+  SearchDebounce(0.3f),
+  DefaultModFields(EModioModFields::All),
+  bBatchGetModCalls(false),
+  bKeepModCatalog(false),
+  bStoreModCatalog(false),
+  bModCatalogStoreLoaded(false),
   bInitialized(false)
 {
+  for( int32 i = 0; i < EModioRequestPriority::PRIORITY_MAX; i++ )
+  {
+    NumRequestsInFlight[i] = 0;
+    RequestLimits[i] = 0;
+  }
 }
 
 FModioSubsystem::~FModioSubsystem()
@@ -74,825 +104,2507 @@ FModioSubsystemPtr FModioSubsystem::Create( const FString& RootDirectory, bool b
   return Modio;
 }
 
-void FModioSubsystem::AddMod(const FModioModCreator& ModCreator, FModioModDelegate AddModDelegate)
+FModioAsyncRequestHandle FModioSubsystem::AddMod(const FModioModCreator& ModCreator, FModioModDelegate AddModDelegate)
 {
-  FModioAsyncRequest_AddMod *Request = CreateAsyncRequest<FModioAsyncRequest_AddMod>( this, AddModDelegate );
-  ModioModCreator mod_creator;
-  modioInitModCreator(&mod_creator);
-  SetupModioModCreator(ModCreator, mod_creator);
-  modioAddMod(Request, mod_creator, FModioAsyncRequest_AddMod::Response);
-  modioFreeModCreator(&mod_creator);
-}
+  FScopeLock SdkLock( &SdkCriticalSection );
 
-void FModioSubsystem::EditMod(uint32 ModId, const FModioModEditor &ModEditor, FModioModDelegate EditModDelegate)
-{
-  FModioAsyncRequest_EditMod *Request = CreateAsyncRequest<FModioAsyncRequest_EditMod>( this, EditModDelegate );
-  ModioModEditor mod_editor;
-  modioInitModEditor(&mod_editor);
-  SetupModioModEditor(ModEditor, mod_editor);
-  modioEditMod(Request , (u32)ModId, mod_editor, FModioAsyncRequest_EditMod::Response);
-  modioFreeModEditor(&mod_editor);
-}
+  FModioAsyncRequest_AddMod *Request = CreateAsyncRequest<FModioAsyncRequest_AddMod>( this, TEXT( "AddMod" ), AddModDelegate );
 
-void FModioSubsystem::EmailExchange( const FString &SecurityCode, FModioGenericDelegate EmailExchangeDelegate )
-{
-  FModioAsyncRequest_EmailExchange *Request = CreateAsyncRequest<FModioAsyncRequest_EmailExchange>( this, EmailExchangeDelegate );
-  modioEmailExchange( Request, TCHAR_TO_UTF8(*SecurityCode), FModioAsyncRequest_EmailExchange::Response );
-}
+  IssueRequest( Request, [=]()
+  {
+    ModioModCreator mod_creator;
+    modioInitModCreator(&mod_creator);
+    SetupModioModCreator(ModCreator, mod_creator);
+    modioAddMod(Request, mod_creator, FModioAsyncRequest_AddMod::Response);
+    modioFreeModCreator(&mod_creator);
+  });
 
-void FModioSubsystem::EmailRequest( const FString &Email, FModioGenericDelegate EmailRequestDelegate )
-{
-  FModioAsyncRequest_EmailRequest *Request = CreateAsyncRequest<FModioAsyncRequest_EmailRequest>( this, EmailRequestDelegate );
-  modioEmailRequest( Request, TCHAR_TO_UTF8(*Email), FModioAsyncRequest_EmailRequest::Response );
+  return Request->GetHandle();
 }
 
-void FModioSubsystem::GetAllMods(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, FModioModArrayDelegate GetAllModsDelegate)
+FModioAsyncRequestHandle FModioSubsystem::EditMod(uint32 ModId, const FModioModEditor &ModEditor, FModioModDelegate EditModDelegate)
 {
-  FModioAsyncRequest_GetAllMods *Request = CreateAsyncRequest<FModioAsyncRequest_GetAllMods>( this, GetAllModsDelegate );
+  FScopeLock SdkLock( &SdkCriticalSection );
 
-  ModioFilterCreator modio_filter_creator;
-  modioInitFilter(&modio_filter_creator);
-  SetupModioModFilterCreator(FilterCreator, ModTags, Limit, Offset, modio_filter_creator);
+  InvalidateCachedResponses( ModId );
 
-  modioGetAllMods(Request, modio_filter_creator, FModioAsyncRequest_GetAllMods::Response);
-  modioFreeFilter(&modio_filter_creator);
-}
+  FModioAsyncRequest_EditMod *Request = CreateAsyncRequest<FModioAsyncRequest_EditMod>( this, TEXT( "EditMod" ), EditModDelegate );
 
-void FModioSubsystem::GetMod(uint32 ModId, const FModioModDelegate ModDelegate)
-{
-	FModioAsyncRequest_GetMod *Request = CreateAsyncRequest<FModioAsyncRequest_GetMod>( this, ModDelegate );
-	modioGetMod(Request, (u32)ModId, FModioAsyncRequest_GetMod::Response);
-}
+  IssueRequest( Request, [=]()
+  {
+    ModioModEditor mod_editor;
+    modioInitModEditor(&mod_editor);
+    SetupModioModEditor(ModEditor, mod_editor);
+    modioEditMod(Request , (u32)ModId, mod_editor, FModioAsyncRequest_EditMod::Response);
+    modioFreeModEditor(&mod_editor);
+  });
 
-void FModioSubsystem::GetAuthenticatedUser(FModioUserDelegate GetAuthenticatedUserDelegate)
-{
-  FModioAsyncRequest_GetAuthenticatedUser *Request = CreateAsyncRequest<FModioAsyncRequest_GetAuthenticatedUser>( this, GetAuthenticatedUserDelegate );
-  modioGetAuthenticatedUser(Request, FModioAsyncRequest_GetAuthenticatedUser::Response);
+  return Request->GetHandle();
 }
 
-void FModioSubsystem::GetUserEvents(int32 Limit, int32 Offset, FModioUserEventArrayDelegate GetUserEventsDelegate)
+FModioAsyncRequestHandle FModioSubsystem::EmailExchange( const FString &SecurityCode, FModioGenericDelegate EmailExchangeDelegate )
 {
-  FModioAsyncRequest_GetUserEvents *Request = CreateAsyncRequest<FModioAsyncRequest_GetUserEvents>( this, GetUserEventsDelegate );
-  ModioFilterCreator modio_filter_creator;
-  modioInitFilter(&modio_filter_creator);
-  SetupModioFilterPagination(Limit, Offset, modio_filter_creator);
-  modioGetUserEvents(Request, modio_filter_creator, FModioAsyncRequest_GetUserEvents::Response);
-  modioFreeFilter(&modio_filter_creator);
-}
+  FScopeLock SdkLock( &SdkCriticalSection );
 
-void FModioSubsystem::GetUserRatings(int32 Limit, int32 Offset, FModioRatingArrayDelegate GetUserRatingsDelegate)
-{
-  FModioAsyncRequest_GetUserRatings *Request = CreateAsyncRequest<FModioAsyncRequest_GetUserRatings>( this, GetUserRatingsDelegate );
-  ModioFilterCreator modio_filter_creator;
-  modioInitFilter(&modio_filter_creator);
-  SetupModioFilterPagination(Limit, Offset, modio_filter_creator);
-  modioGetUserRatings(Request, modio_filter_creator, FModioAsyncRequest_GetUserRatings::Response);
-  modioFreeFilter(&modio_filter_creator);
-}
+  FModioAsyncRequest_EmailExchange *Request = CreateAsyncRequest<FModioAsyncRequest_EmailExchange>( this, TEXT( "EmailExchange" ), EmailExchangeDelegate );
 
-void FModioSubsystem::GetUserSubscriptions(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, FModioModArrayDelegate GetUserSubscriptionsDelegate)
-{
-  FModioAsyncRequest_GetUserSubscriptions *Request = CreateAsyncRequest<FModioAsyncRequest_GetUserSubscriptions>( this, GetUserSubscriptionsDelegate );
-  ModioFilterCreator modio_filter_creator;
-  modioInitFilter(&modio_filter_creator);
-  SetupModioModFilterCreator(FilterCreator, ModTags, Limit, Offset, modio_filter_creator);
-  modioGetUserSubscriptions(Request, modio_filter_creator, FModioAsyncRequest_GetUserSubscriptions::Response);
-  modioFreeFilter(&modio_filter_creator);
-}
+  IssueRequest( Request, [=]()
+  {
+    modioEmailExchange( Request, TCHAR_TO_UTF8(*SecurityCode), FModioAsyncRequest_EmailExchange::Response );
+  });
 
-void FModioSubsystem::GetUserMods(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, FModioModArrayDelegate GetUserModsDelegate)
-{
-  FModioAsyncRequest_GetUserMods *Request = CreateAsyncRequest<FModioAsyncRequest_GetUserMods>( this, GetUserModsDelegate );
-  ModioFilterCreator modio_filter_creator;
-  modioInitFilter(&modio_filter_creator);
-  SetupModioModFilterCreator(FilterCreator, ModTags, Limit, Offset, modio_filter_creator);
-  modioGetUserMods(Request, modio_filter_creator, FModioAsyncRequest_GetUserMods::Response);
-  modioFreeFilter(&modio_filter_creator);
+  return Request->GetHandle();
 }
 
-void FModioSubsystem::GetUserModfiles(int32 Limit, int32 Offset, FModioModfileArrayDelegate GetUserModfilesDelegate)
+FModioAsyncRequestHandle FModioSubsystem::EmailRequest( const FString &Email, FModioGenericDelegate EmailRequestDelegate )
 {
-  FModioAsyncRequest_GetUserModfiles *Request = CreateAsyncRequest<FModioAsyncRequest_GetUserModfiles>( this, GetUserModfilesDelegate );
-  ModioFilterCreator modio_filter_creator;
-  modioInitFilter(&modio_filter_creator);
-  SetupModioFilterPagination(Limit, Offset, modio_filter_creator);
-  modioGetUserModfiles(Request, modio_filter_creator, FModioAsyncRequest_GetUserModfiles::Response);
-  modioFreeFilter(&modio_filter_creator);
-}
+  FScopeLock SdkLock( &SdkCriticalSection );
 
-void FModioSubsystem::SteamAuth(const FString &Base64Ticket, FModioGenericDelegate SteamAuthDelegate)
-{
-  FModioAsyncRequest_SteamAuth *Request = CreateAsyncRequest<FModioAsyncRequest_SteamAuth>( this, SteamAuthDelegate );
-  modioSteamAuthEncoded( Request, TCHAR_TO_UTF8(*Base64Ticket), FModioAsyncRequest_SteamAuth::Response );
-}
+  FModioAsyncRequest_EmailRequest *Request = CreateAsyncRequest<FModioAsyncRequest_EmailRequest>( this, TEXT( "EmailRequest" ), EmailRequestDelegate );
 
-void FModioSubsystem::GalaxyAuth(const FString &Appdata, FModioGenericDelegate GalaxyAuthDelegate)
-{
-  FModioAsyncRequest_GalaxyAuth *Request = CreateAsyncRequest<FModioAsyncRequest_GalaxyAuth>( this, GalaxyAuthDelegate );
-  modioGalaxyAuth( Request, TCHAR_TO_UTF8(*Appdata), FModioAsyncRequest_GalaxyAuth::Response );
-}
+  IssueRequest( Request, [=]()
+  {
+    modioEmailRequest( Request, TCHAR_TO_UTF8(*Email), FModioAsyncRequest_EmailRequest::Response );
+  });
 
-void FModioSubsystem::OculusAuth(const FString& Nonce, const FString& OculusUserId, const FString& AccessToken, const FString& Email, const FString& Device, int32 DateExpires, FModioGenericDelegate OculusAuthDelegate)
-{
-  FModioAsyncRequest_OculusAuth *Request = CreateAsyncRequest<FModioAsyncRequest_OculusAuth>( this, OculusAuthDelegate );
-  modioOculusAuth( Request, TCHAR_TO_UTF8(*Nonce), TCHAR_TO_UTF8(*OculusUserId), TCHAR_TO_UTF8(*AccessToken), TCHAR_TO_UTF8(*Email), TCHAR_TO_UTF8(*Device), (u32)DateExpires, FModioAsyncRequest_GalaxyAuth::Response );
+  return Request->GetHandle();
 }
 
-void FModioSubsystem::Process()
+FModioAsyncRequestHandle FModioSubsystem::GetAllMods(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, FModioModArrayDelegate GetAllModsDelegate)
 {
-  modioProcess();
+  return GetAllMods( FilterCreator, ModTags, Limit, Offset, DefaultModFields, GetAllModsDelegate );
 }
 
-void FModioSubsystem::PollEvents()
+FModioAsyncRequestHandle FModioSubsystem::GetAllMods(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, EModioModFields Fields, FModioModArrayDelegate GetAllModsDelegate)
 {
-  modioPollEvents();
+  return GetAllMods( FModioCompiledFilter::Compile( FilterCreator, ModTags ), Limit, Offset, Fields, GetAllModsDelegate );
 }
 
-void FModioSubsystem::SetModEventsPollInterval(int32 IntervalInSeconds)
+FModioAsyncRequestHandle FModioSubsystem::GetAllMods(const FModioCompiledFilterRef &Filter, int32 Limit, int32 Offset, EModioModFields Fields, FModioModArrayDelegate GetAllModsDelegate)
 {
-  modioSetModEventsPollInterval((u32)IntervalInSeconds);
-}
+  FScopeLock SdkLock( &SdkCriticalSection );
 
-void FModioSubsystem::SetUserEventsPollInterval(int32 IntervalInSeconds)
-{
-  modioSetUserEventsPollInterval((u32)IntervalInSeconds);
-}
+  FString CoalesceKey = TEXT("GetAllMods:") + Filter->MakePageKey(Limit, Offset) + FString::Printf(TEXT(":%d"), (int32)Fields);
+  FModioAsyncRequestHandle CachedHandle;
+  TSharedPtr<const TArray<FModioMod>> StaleMods;
+  // A max age of 0 asks for a fresh page, so it skips our cache as well
+  if( Filter->GetCacheMaxAgeSeconds() > 0 && FindCachedResponse<FModioAsyncRequest_GetAllMods, TArray<FModioMod>>( TEXT( "GetAllMods" ), CoalesceKey, GetAllModsDelegate, CachedHandle, &StaleMods ) )
+  {
+    if( StaleMods.IsValid() )
+    {
+      RefreshStaleModPage( Filter, Limit, Offset, Fields, CoalesceKey, StaleMods.ToSharedRef() );
+    }
+    return CachedHandle;
+  }
 
-void FModioSubsystem::Logout()
-{
-  modioLogout();
+  return IssueGetAllMods( Filter, Limit, Offset, Fields, CoalesceKey, Filter->GetCacheMaxAgeSeconds(), GetAllModsDelegate );
 }
 
-bool FModioSubsystem::IsLoggedIn()
+void FModioSubsystem::RefreshStaleModPage(const FModioCompiledFilterRef &Filter, int32 Limit, int32 Offset, EModioModFields Fields, const FString &CoalesceKey, TSharedRef<const TArray<FModioMod>> Stale)
 {
-  return modioIsLoggedIn();
-}
+  // Whatever is in flight for the page refreshes the cache already
+  if( InFlightReads.Contains( CoalesceKey ) )
+  {
+    return;
+  }
 
-FModioUser FModioSubsystem::CurrentUser()
-{
-  FModioUser User;
-  InitializeUser(User, modioGetCurrentUser());
-  return User;
-}
+  // The caller already has the stale page, errors and unchanged pages are dropped
+  FString PageKey = Filter->MakePageKey( Limit, Offset );
+  FModioModArrayDelegate RefreshDelegate = FModioModArrayDelegate::CreateLambda( [this, PageKey, Stale]( FModioResponse Response, const TArray<FModioMod> &Fresh )
+  {
+    if( Response.Code >= 200 && Response.Code < 300 && !ModioIsSameValue( *Stale, Fresh ) )
+    {
+      OnCachedModsRefreshed.Broadcast( PageKey, Response, Fresh );
+    }
+  });
 
-void FModioSubsystem::AuthenticateViaToken(const FString& AccessToken)
-{
-  modioAuthenticateViaToken(TCHAR_TO_UTF8(*AccessToken));
+  FModioRequestPriorityScope Background( this, EModioRequestPriority::BACKGROUND );
+  IssueGetAllMods( Filter, Limit, Offset, Fields, CoalesceKey, 0, RefreshDelegate );
 }
 
-void FModioSubsystem::GetGame(uint32 GameId, FModioGameDelegate GetGameDelegate)
+FModioAsyncRequestHandle FModioSubsystem::IssueGetAllMods(const FModioCompiledFilterRef &Filter, int32 Limit, int32 Offset, EModioModFields Fields, const FString &CoalesceKey, uint32 CacheMaxAgeSeconds, FModioModArrayDelegate GetAllModsDelegate)
 {
-  FModioAsyncRequest_GetGame* Request = CreateAsyncRequest<FModioAsyncRequest_GetGame>(this, GetGameDelegate);
+  bool bCoalesced = false;
+  FModioAsyncRequest_GetAllMods *Request = CreateCoalescedAsyncRequest<FModioAsyncRequest_GetAllMods>( TEXT( "GetAllMods" ), CoalesceKey, GetAllModsDelegate, bCoalesced );
+  if( bCoalesced )
+  {
+    return Request->GetHandle();
+  }
+  Request->Fields = Fields;
 
-  modioGetGame(Request, GameId, FModioAsyncRequest_GetGame::Response);
-}
+  IssueRequest( Request, [=]()
+  {
+    TArray<ANSICHAR> Query = Filter->MakePageQuery(Limit, Offset);
+    modioGetAllModsFilterString(Request, Query.GetData(), CacheMaxAgeSeconds, FModioAsyncRequest_GetAllMods::Response);
+  });
 
-void FModioSubsystem::DownloadMod(int32 ModId)
-{
-  modioDownloadMod((u32)ModId);
+  return Request->GetHandle();
 }
 
-void FModioSubsystem::CancelModDownload(int32 ModId)
+FModioAsyncRequestHandle FModioSubsystem::GetAllModsView(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, FModioModViewArrayDelegate GetAllModsDelegate)
 {
-  modioCancelModDownload((u32)ModId);
+  return GetAllModsView( FModioCompiledFilter::Compile( FilterCreator, ModTags ), Limit, Offset, GetAllModsDelegate );
 }
 
-void FModioSubsystem::PauseDownloads()
+FModioAsyncRequestHandle FModioSubsystem::GetAllModsView(const FModioCompiledFilterRef &Filter, int32 Limit, int32 Offset, FModioModViewArrayDelegate GetAllModsDelegate)
 {
-  modioPauseDownloads();
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  // Own key prefix, a leader only dispatches to followers wanting the same kind of result
+  FString CoalesceKey = TEXT("GetAllModsView:") + Filter->MakePageKey(Limit, Offset);
+  bool bCoalesced = false;
+  FModioAsyncRequest_GetAllMods *Request = CreateCoalescedAsyncRequest<FModioAsyncRequest_GetAllMods>( TEXT( "GetAllModsView" ), CoalesceKey, GetAllModsDelegate, bCoalesced );
+  if( bCoalesced )
+  {
+    return Request->GetHandle();
+  }
+
+  IssueRequest( Request, [=]()
+  {
+    TArray<ANSICHAR> Query = Filter->MakePageQuery(Limit, Offset);
+    modioGetAllModsFilterString(Request, Query.GetData(), Filter->GetCacheMaxAgeSeconds(), FModioAsyncRequest_GetAllMods::Response);
+  });
+
+  return Request->GetHandle();
 }
 
-void FModioSubsystem::ResumeDownloads()
+FModioAsyncRequestHandle FModioSubsystem::GetMod(uint32 ModId, const FModioModDelegate ModDelegate)
 {
-  modioResumeDownloads();
+  return GetMod( ModId, DefaultModFields, ModDelegate );
 }
 
-FModioInstalledMod FModioSubsystem::GetInstalledMod(int32 ModId)
+FModioAsyncRequestHandle FModioSubsystem::GetMod(uint32 ModId, EModioModFields Fields, FModioModDelegate ModDelegate)
 {
-  FModioInstalledMod InstalledMod;
+  FScopeLock SdkLock( &SdkCriticalSection );
 
-  ModioInstalledMod modio_installed_mod;
-  modioGetInstalledMod((u32)ModId, &modio_installed_mod);
+  FString CoalesceKey = FString::Printf(TEXT("GetMod:%u:%d"), ModId, (int32)Fields);
+  FModioAsyncRequestHandle CachedHandle;
+  TSharedPtr<const FModioMod> StaleMod;
+  if( FindCachedResponse<FModioAsyncRequest_GetMod, FModioMod>( TEXT( "GetMod" ), CoalesceKey, ModDelegate, CachedHandle, &StaleMod ) )
+  {
+    if( StaleMod.IsValid() )
+    {
+      RefreshStaleMod( ModId, Fields, CoalesceKey, StaleMod.ToSharedRef() );
+    }
+    return CachedHandle;
+  }
 
-  InitializeInstalledMod(InstalledMod, modio_installed_mod);
-  modioFreeInstalledMod(&modio_installed_mod);
+  bool bCoalesced = false;
+  FModioAsyncRequest_GetMod *Request = CreateCoalescedAsyncRequest<FModioAsyncRequest_GetMod>( TEXT( "GetMod" ), CoalesceKey, ModDelegate, bCoalesced );
+  if( bCoalesced )
+  {
+    return Request->GetHandle();
+  }
+  Request->Fields = Fields;
 
-  return InstalledMod;
-}
+  if( bBatchGetModCalls )
+  {
+    Request->ModId = ModId;
+    Request->Priority = GetRequestPriority( EModioRequestPriority::NORMAL );
+    if( !PendingGetModBatch.Num() )
+    {
+      PendingGetModBatchStartTime = FPlatformTime::Seconds();
+    }
+    PendingGetModBatch.Add( Request->GetHandle() );
+    return Request->GetHandle();
+  }
 
-TArray<FModioInstalledMod> FModioSubsystem::GetAllInstalledMods()
-{
-  TArray<FModioInstalledMod> InstalledMods;
+  IssueRequest( Request, [=]()
+  {
+    modioGetMod(Request, (u32)ModId, FModioAsyncRequest_GetMod::Response);
+  });
 
-  u32 installed_mods_count = modioGetAllInstalledModsCount();
-  ModioInstalledMod *modio_installed_mods = (ModioInstalledMod *)malloc(installed_mods_count * sizeof(*modio_installed_mods));
-  modioGetAllInstalledMods(modio_installed_mods);
+  return Request->GetHandle();
+}
 
-  for (u32 i = 0; i < installed_mods_count; i++)
+void FModioSubsystem::RefreshStaleMod(uint32 ModId, EModioModFields Fields, const FString &CoalesceKey, TSharedRef<const FModioMod> Stale)
+{
+  // Whatever is in flight for the mod refreshes the cache already
+  if( InFlightReads.Contains( CoalesceKey ) )
   {
-    FModioInstalledMod installed_mod;
-    InitializeInstalledMod(installed_mod, modio_installed_mods[i]);
-    modioFreeInstalledMod(&modio_installed_mods[i]);
-    InstalledMods.Add(installed_mod);
+    return;
   }
 
-  free(modio_installed_mods);
+  // The caller already has the stale mod, errors and unchanged mods are dropped
+  FModioModDelegate RefreshDelegate = FModioModDelegate::CreateLambda( [this, Stale]( FModioResponse Response, FModioMod Fresh )
+  {
+    if( Response.Code >= 200 && Response.Code < 300 && !ModioIsSameValue( *Stale, Fresh ) )
+    {
+      OnCachedModRefreshed.Broadcast( Response, Fresh );
+    }
+  });
+
+  bool bCoalesced = false;
+  FModioAsyncRequest_GetMod *Request = CreateCoalescedAsyncRequest<FModioAsyncRequest_GetMod>( TEXT( "GetMod" ), CoalesceKey, RefreshDelegate, bCoalesced );
+  check( !bCoalesced );
+  Request->ModId = ModId;
+  Request->Fields = Fields;
+
+  // modioGetMod can't skip the SDK's cache, so the mod is asked for as a batch of one with a max age of 0
+  FModioRequestPriorityScope Background( this, EModioRequestPriority::BACKGROUND );
+  FModioAsyncRequest_GetModBatch *BatchRequest = CreateAsyncRequest<FModioAsyncRequest_GetModBatch>( this, TEXT( "GetModBatch" ), TArray<FModioAsyncRequestHandle>{ Request->GetHandle() }, TArray<uint32>{ ModId }, TArray<EModioModFields>{ Fields } );
+  IssueRequest( BatchRequest, [BatchRequest, ModId]()
+  {
+    ANSICHAR Query[32];
+    FCStringAnsi::Sprintf( Query, "id=%u", ModId );
+    modioGetAllModsFilterString(BatchRequest, Query, 0, FModioAsyncRequest_GetModBatch::Response);
+  });
+}
+
+void FModioSubsystem::IssueGetMod( FModioAsyncRequest_GetMod *Request )
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
 
-  return InstalledMods;
+  uint32 ModId = Request->ModId;
+  IssueRequest( Request, [Request, ModId]()
+  {
+    modioGetMod(Request, (u32)ModId, FModioAsyncRequest_GetMod::Response);
+  }, (EModioRequestPriority)Request->Priority );
 }
 
-TArray<int32> FModioSubsystem::GetAllDownloadedMods()
+void FModioSubsystem::FlushGetModBatch()
 {
-  TArray<int32> DownloadedMods;
+  FScopeLock SdkLock( &SdkCriticalSection );
 
-  u32 downloaded_mods_count = modioGetAllDownloadedModsCount();
-  u32 *modio_downloaded_mods = new u32[downloaded_mods_count];
-  modioGetAllDownloadedMods(modio_downloaded_mods);
+  TArray<FModioAsyncRequestHandle> Batch = MoveTemp( PendingGetModBatch );
+  PendingGetModBatch.Reset();
 
-  for (u32 i = 0; i < downloaded_mods_count; i++)
+  for( int32 ChunkStart = 0; ChunkStart < Batch.Num(); ChunkStart += GetModBatchLimit )
   {
-    DownloadedMods.Add(modio_downloaded_mods[i]);
-  }
-
-  delete[] modio_downloaded_mods;
+    TArray<FModioAsyncRequestHandle> Chunk;
+    TArray<uint32> ChunkModIds;
+    TArray<EModioModFields> ChunkFields;
+    // The batch is as urgent as the most urgent GetMod in it
+    EModioRequestPriority ChunkPriority = EModioRequestPriority::BACKGROUND;
+
+    int32 ChunkEnd = FMath::Min( ChunkStart + GetModBatchLimit, Batch.Num() );
+    for( int32 i = ChunkStart; i < ChunkEnd; i++ )
+    {
+      FModioAsyncRequest_GetMod* Request = static_cast<FModioAsyncRequest_GetMod*>( AsyncRequests.Find( Batch[i] ) );
+      if( Request && !Request->FinishIfCancelled() )
+      {
+        Chunk.Add( Batch[i] );
+        ChunkModIds.Add( Request->ModId );
+        ChunkFields.Add( Request->Fields );
+        ChunkPriority = FMath::Min( ChunkPriority, (EModioRequestPriority)Request->Priority );
+      }
+    }
 
-  return DownloadedMods;
+    if( Chunk.Num() )
+    {
+      FModioAsyncRequest_GetModBatch *BatchRequest = CreateAsyncRequest<FModioAsyncRequest_GetModBatch>( this, TEXT( "GetModBatch" ), Chunk, ChunkModIds, ChunkFields );
+      IssueRequest( BatchRequest, [BatchRequest, ChunkModIds]()
+      {
+        ModioFilterCreator modio_filter_creator;
+        modioInitFilter(&modio_filter_creator);
+        modioSetFilterLimit(&modio_filter_creator, (u32)GetModBatchLimit);
+        for( uint32 ModId : ChunkModIds )
+        {
+          modioAddFilterInField(&modio_filter_creator, "id", toString((int32)ModId).c_str());
+        }
+        modioGetAllMods(BatchRequest, modio_filter_creator, FModioAsyncRequest_GetModBatch::Response);
+        modioFreeFilter(&modio_filter_creator);
+      }, ChunkPriority );
+    }
+  }
 }
 
-TArray<FModioQueuedModDownload> FModioSubsystem::GetModDownloadQueue()
+FModioAsyncRequestHandle FModioSubsystem::GetAuthenticatedUser(FModioUserDelegate GetAuthenticatedUserDelegate)
 {
-  TArray<FModioQueuedModDownload> QueuedMods;
+  FScopeLock SdkLock( &SdkCriticalSection );
 
-  u32 download_queue_count = modioGetModDownloadQueueCount();
-  ModioQueuedModDownload *modio_queued_mods = (ModioQueuedModDownload *)malloc(download_queue_count * sizeof(*modio_queued_mods));
-  modioGetModDownloadQueue(modio_queued_mods);
+  FModioAsyncRequest_GetAuthenticatedUser *Request = CreateAsyncRequest<FModioAsyncRequest_GetAuthenticatedUser>( this, TEXT( "GetAuthenticatedUser" ), GetAuthenticatedUserDelegate );
 
-  for (u32 i = 0; i < download_queue_count; i++)
+  IssueRequest( Request, [=]()
   {
-    FModioQueuedModDownload queued_mod;
-    InitializeQueuedModDownload(queued_mod, modio_queued_mods[i]);
-    modioFreeQueuedModDownload(&modio_queued_mods[i]);
-    QueuedMods.Add(queued_mod);
-  }
+    modioGetAuthenticatedUser(Request, FModioAsyncRequest_GetAuthenticatedUser::Response);
+  });
 
-  free(modio_queued_mods);
-
-  return QueuedMods;
-}
-void FModioSubsystem::InstallDownloadedMods()
-{
-  modioInstallDownloadedMods();
+  return Request->GetHandle();
 }
-void FModioSubsystem::AddModfile(int32 ModId, FModioModfileCreator ModfileCreator)
+
+FModioAsyncRequestHandle FModioSubsystem::GetUserEvents(int32 Limit, int32 Offset, FModioUserEventArrayDelegate GetUserEventsDelegate)
 {
-  ModioModfileCreator modio_modfile_creator;
-  modioInitModfileCreator(&modio_modfile_creator);
-  SetupModioModfileCreator(ModfileCreator, modio_modfile_creator);
-  modioAddModfile((u32)ModId, modio_modfile_creator);
-  modioFreeModfileCreator(&modio_modfile_creator);
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  FModioAsyncRequest_GetUserEvents *Request = CreateAsyncRequest<FModioAsyncRequest_GetUserEvents>( this, TEXT( "GetUserEvents" ), GetUserEventsDelegate );
+
+  IssueRequest( Request, [=]()
+  {
+    ModioFilterCreator modio_filter_creator;
+    modioInitFilter(&modio_filter_creator);
+    SetupModioFilterPagination(Limit, Offset, modio_filter_creator);
+    modioGetUserEvents(Request, modio_filter_creator, FModioAsyncRequest_GetUserEvents::Response);
+    modioFreeFilter(&modio_filter_creator);
+  });
+
+  return Request->GetHandle();
 }
-TArray<FModioQueuedModfileUpload> FModioSubsystem::GetModfileUploadQueue()
+
+FModioAsyncRequestHandle FModioSubsystem::GetUserRatings(int32 Limit, int32 Offset, FModioRatingArrayDelegate GetUserRatingsDelegate)
 {
-  TArray<FModioQueuedModfileUpload> UploadQueue;
+  FScopeLock SdkLock( &SdkCriticalSection );
 
-  u32 upload_queue_count = modioGetModfileUploadQueueCount();
-  ModioQueuedModfileUpload *modio_queued_mods = (ModioQueuedModfileUpload *)malloc(upload_queue_count * sizeof(*modio_queued_mods));
-  modioGetModfileUploadQueue(modio_queued_mods);
+  FModioAsyncRequest_GetUserRatings *Request = CreateAsyncRequest<FModioAsyncRequest_GetUserRatings>( this, TEXT( "GetUserRatings" ), GetUserRatingsDelegate );
 
-  for (u32 i = 0; i < upload_queue_count; i++)
+  IssueRequest( Request, [=]()
   {
-    FModioQueuedModfileUpload queued_mod;
-    InitializeQueuedModfileUpload(queued_mod, modio_queued_mods[i]);
-    UploadQueue.Add(queued_mod);
-  }
+    ModioFilterCreator modio_filter_creator;
+    modioInitFilter(&modio_filter_creator);
+    SetupModioFilterPagination(Limit, Offset, modio_filter_creator);
+    modioGetUserRatings(Request, modio_filter_creator, FModioAsyncRequest_GetUserRatings::Response);
+    modioFreeFilter(&modio_filter_creator);
+  });
 
-  free(modio_queued_mods);
+  return Request->GetHandle();
+}
 
-  return UploadQueue;
+FModioAsyncRequestHandle FModioSubsystem::GetUserSubscriptions(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, FModioModArrayDelegate GetUserSubscriptionsDelegate)
+{
+  return GetUserSubscriptions( FilterCreator, ModTags, Limit, Offset, DefaultModFields, GetUserSubscriptionsDelegate );
 }
 
-void FModioSubsystem::SubscribeToMod(int32 ModId, FModioModDelegate SubscribeToModDelegate)
+FModioAsyncRequestHandle FModioSubsystem::GetUserSubscriptions(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, EModioModFields Fields, FModioModArrayDelegate GetUserSubscriptionsDelegate)
 {
-  FModioAsyncRequest_SubscribeToMod *Request = CreateAsyncRequest<FModioAsyncRequest_SubscribeToMod>( this, SubscribeToModDelegate );
-  modioSubscribeToMod(Request, (u32)ModId, FModioAsyncRequest_SubscribeToMod::Response);
+  return GetUserSubscriptions( FModioCompiledFilter::Compile( FilterCreator, ModTags ), Limit, Offset, Fields, GetUserSubscriptionsDelegate );
 }
 
-void FModioSubsystem::UnsubscribeFromMod(int32 ModId, FModioGenericDelegate UnsubscribeFromModDelegate)
+FModioAsyncRequestHandle FModioSubsystem::GetUserSubscriptions(const FModioCompiledFilterRef &Filter, int32 Limit, int32 Offset, EModioModFields Fields, FModioModArrayDelegate GetUserSubscriptionsDelegate)
 {
-  FModioAsyncRequest_UnsubscribeFromMod *Request = CreateAsyncRequest<FModioAsyncRequest_UnsubscribeFromMod>( this, UnsubscribeFromModDelegate );
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  FModioAsyncRequest_GetUserSubscriptions *Request = CreateAsyncRequest<FModioAsyncRequest_GetUserSubscriptions>( this, TEXT( "GetUserSubscriptions" ), GetUserSubscriptionsDelegate );
+  Request->Fields = Fields;
 
-  modioUnsubscribeFromMod(Request, (u32)ModId, FModioAsyncRequest_UnsubscribeFromMod::Response);
+  IssueRequest( Request, [=]()
+  {
+    TArray<ANSICHAR> Query = Filter->MakePageQuery(Limit, Offset);
+    modioGetUserSubscriptionsFilterString(Request, Query.GetData(), Filter->GetCacheMaxAgeSeconds(), FModioAsyncRequest_GetUserSubscriptions::Response);
+  });
+
+  return Request->GetHandle();
 }
 
-bool FModioSubsystem::IsCurrentUserSubscribed(int32 ModId)
+FModioAsyncRequestHandle FModioSubsystem::GetUserSubscriptionsView(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, FModioModViewArrayDelegate GetUserSubscriptionsDelegate)
 {
-  return modioIsCurrentUserSubscribed((u32)ModId);
+  return GetUserSubscriptionsView( FModioCompiledFilter::Compile( FilterCreator, ModTags ), Limit, Offset, GetUserSubscriptionsDelegate );
 }
 
-TArray<int32> FModioSubsystem::GetCurrentUserSubscriptions()
+FModioAsyncRequestHandle FModioSubsystem::GetUserSubscriptionsView(const FModioCompiledFilterRef &Filter, int32 Limit, int32 Offset, FModioModViewArrayDelegate GetUserSubscriptionsDelegate)
 {
-  TArray<int32> CurrentUserSubscriptions;
+  FScopeLock SdkLock( &SdkCriticalSection );
 
-  u32 current_user_subscriptions_count = modioGetCurrentUserSubscriptionsCount();
-  u32 *current_user_subscriptions = new u32[current_user_subscriptions_count];
-  modioGetCurrentUserSubscriptions(current_user_subscriptions);
+  FModioAsyncRequest_GetUserSubscriptions *Request = CreateAsyncRequest<FModioAsyncRequest_GetUserSubscriptions>( this, TEXT( "GetUserSubscriptionsView" ), GetUserSubscriptionsDelegate );
 
-  for (u32 i = 0; i < current_user_subscriptions_count; i++)
+  IssueRequest( Request, [=]()
   {
-    CurrentUserSubscriptions.Add(current_user_subscriptions[i]);
-  }
+    TArray<ANSICHAR> Query = Filter->MakePageQuery(Limit, Offset);
+    modioGetUserSubscriptionsFilterString(Request, Query.GetData(), Filter->GetCacheMaxAgeSeconds(), FModioAsyncRequest_GetUserSubscriptions::Response);
+  });
 
-  delete[] current_user_subscriptions;
-
-  return CurrentUserSubscriptions;
+  return Request->GetHandle();
 }
 
-void FModioSubsystem::AddModRating(int32 ModId, bool IsRatingPositive, FModioGenericDelegate AddModRatingDelegate)
+FModioAsyncRequestHandle FModioSubsystem::GetUserMods(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, FModioModArrayDelegate GetUserModsDelegate)
 {
-  FModioAsyncRequest_AddModRating *Request = CreateAsyncRequest<FModioAsyncRequest_AddModRating>( this, AddModRatingDelegate );
-  modioAddModRating(Request, (u32)ModId, IsRatingPositive, FModioAsyncRequest_AddModRating::Response);
+  return GetUserMods( FilterCreator, ModTags, Limit, Offset, DefaultModFields, GetUserModsDelegate );
 }
 
-TEnumAsByte<EModioRatingType> FModioSubsystem::GetCurrentUserModRating(int32 ModId)
+FModioAsyncRequestHandle FModioSubsystem::GetUserMods(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, EModioModFields Fields, FModioModArrayDelegate GetUserModsDelegate)
 {
-  u32 ModRating = modioGetCurrentUserModRating((u32)ModId);
-  return ConvertToModRatingType(ModRating);
+  return GetUserMods( FModioCompiledFilter::Compile( FilterCreator, ModTags ), Limit, Offset, Fields, GetUserModsDelegate );
 }
 
-void FModioSubsystem::GetAllModDependencies(int32 ModId, FModioModDependencyArrayDelegate GetAllModDependenciesDelegate)
+FModioAsyncRequestHandle FModioSubsystem::GetUserMods(const FModioCompiledFilterRef &Filter, int32 Limit, int32 Offset, EModioModFields Fields, FModioModArrayDelegate GetUserModsDelegate)
 {
-  FModioAsyncRequest_GetAllModDependencies *Request = CreateAsyncRequest<FModioAsyncRequest_GetAllModDependencies>( this, GetAllModDependenciesDelegate );
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  FModioAsyncRequest_GetUserMods *Request = CreateAsyncRequest<FModioAsyncRequest_GetUserMods>( this, TEXT( "GetUserMods" ), GetUserModsDelegate );
+  Request->Fields = Fields;
+
+  IssueRequest( Request, [=]()
+  {
+    TArray<ANSICHAR> Query = Filter->MakePageQuery(Limit, Offset);
+    modioGetUserModsFilterString(Request, Query.GetData(), Filter->GetCacheMaxAgeSeconds(), FModioAsyncRequest_GetUserMods::Response);
+  });
 
-  modioGetAllModDependencies(Request, (u32)ModId, FModioAsyncRequest_GetAllModDependencies::Response);
+  return Request->GetHandle();
 }
 
-void FModioSubsystem::AddModDependencies(int32 ModId, const TArray<int32> &Dependencies, FModioGenericDelegate AddModDependenciesDelegate)
+FModioAsyncRequestHandle FModioSubsystem::GetUserModsView(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, FModioModViewArrayDelegate GetUserModsDelegate)
 {
-  FModioAsyncRequest_AddModDependencies *Request = CreateAsyncRequest<FModioAsyncRequest_AddModDependencies>( this, AddModDependenciesDelegate );
-  u32 *ModIds = new u32[Dependencies.Num()];
-  for(int i = 0; i < Dependencies.Num(); i++)
-  {
-    ModIds[i] = Dependencies[i];
-  }
-  modioAddModDependencies(Request, (u32)ModId, ModIds, (u32)Dependencies.Num(), FModioAsyncRequest_AddModDependencies::Response);
-  delete[] ModIds;
+  return GetUserModsView( FModioCompiledFilter::Compile( FilterCreator, ModTags ), Limit, Offset, GetUserModsDelegate );
 }
 
-void FModioSubsystem::DeleteModDependencies(int32 ModId, const TArray<int32> &Dependencies, FModioGenericDelegate DeleteModDependenciesDelegate)
+FModioAsyncRequestHandle FModioSubsystem::GetUserModsView(const FModioCompiledFilterRef &Filter, int32 Limit, int32 Offset, FModioModViewArrayDelegate GetUserModsDelegate)
 {
-  FModioAsyncRequest_DeleteModDependencies *Request = CreateAsyncRequest<FModioAsyncRequest_DeleteModDependencies>( this, DeleteModDependenciesDelegate );
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  FModioAsyncRequest_GetUserMods *Request = CreateAsyncRequest<FModioAsyncRequest_GetUserMods>( this, TEXT( "GetUserModsView" ), GetUserModsDelegate );
 
-  u32 *ModIds = new u32[Dependencies.Num()];
-  for(int i = 0; i < Dependencies.Num(); i++)
+  IssueRequest( Request, [=]()
   {
-    ModIds[i] = Dependencies[i];
-  }
-  modioDeleteModDependencies(Request, (u32)ModId, ModIds, (u32)Dependencies.Num(), FModioAsyncRequest_DeleteModDependencies::Response);
-  delete[] ModIds;
+    TArray<ANSICHAR> Query = Filter->MakePageQuery(Limit, Offset);
+    modioGetUserModsFilterString(Request, Query.GetData(), Filter->GetCacheMaxAgeSeconds(), FModioAsyncRequest_GetUserMods::Response);
+  });
+
+  return Request->GetHandle();
 }
 
-void FModioSubsystem::SubmitReport(TEnumAsByte<EModioResourceType> Resource, int32 Id, TEnumAsByte<EModioReportType> Type, const FString &Name, const FString &Summary, FModioGenericDelegate SubmitReportDelegate)
+FModioAsyncRequestHandle FModioSubsystem::GetUserModfiles(int32 Limit, int32 Offset, FModioModfileArrayDelegate GetUserModfilesDelegate)
 {
-  FModioAsyncRequest_SubmitReport *Request = CreateAsyncRequest<FModioAsyncRequest_SubmitReport>( this, SubmitReportDelegate );
-  
-  FString ResourceStr = "";
-  switch (Resource)
-  {
-  case EModioResourceType::GAMES:
-    ResourceStr = "games";
-    break;
-  case EModioResourceType::MODS:
-    ResourceStr = "mods";
-    break;
-  case EModioResourceType::USERS:
-    ResourceStr = "users";
-    break;
-  default:
-    // @todo: handle error
-    break;
-  }
+  FScopeLock SdkLock( &SdkCriticalSection );
 
-  u32 CType = 0;
+  FModioAsyncRequest_GetUserModfiles *Request = CreateAsyncRequest<FModioAsyncRequest_GetUserModfiles>( this, TEXT( "GetUserModfiles" ), GetUserModfilesDelegate );
 
-  switch (Type)
+  IssueRequest( Request, [=]()
   {
-  case EModioReportType::GENERIC:
-    CType = 0;
-    break;
-  case EModioReportType::DMCA:
-    CType = 1;
-    break;
-  default:
-    // @todo: handle error
-    break;
-  }
+    ModioFilterCreator modio_filter_creator;
+    modioInitFilter(&modio_filter_creator);
+    SetupModioFilterPagination(Limit, Offset, modio_filter_creator);
+    modioGetUserModfiles(Request, modio_filter_creator, FModioAsyncRequest_GetUserModfiles::Response);
+    modioFreeFilter(&modio_filter_creator);
+  });
 
-  modioSubmitReport(Request, TCHAR_TO_UTF8(*ResourceStr), (u32)Id, CType, TCHAR_TO_UTF8(*Name), TCHAR_TO_UTF8(*Summary), FModioAsyncRequest_SubmitReport::Response);
+  return Request->GetHandle();
 }
 
-void FModioSubsystem::GetAllModTags(int32 ModId, FModioModTagArrayDelegate GetAllModTagsDelegate)
+FModioAsyncRequestHandle FModioSubsystem::SteamAuth(const FString &Base64Ticket, FModioGenericDelegate SteamAuthDelegate)
 {
-  FModioAsyncRequest_GetAllModTags *Request = CreateAsyncRequest<FModioAsyncRequest_GetAllModTags>( this, GetAllModTagsDelegate );
-  modioGetModTags(Request, (u32)ModId, FModioAsyncRequest_GetAllModTags::Response);
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  FModioAsyncRequest_SteamAuth *Request = CreateAsyncRequest<FModioAsyncRequest_SteamAuth>( this, TEXT( "SteamAuth" ), SteamAuthDelegate );
+
+  IssueRequest( Request, [=]()
+  {
+    modioSteamAuthEncoded( Request, TCHAR_TO_UTF8(*Base64Ticket), FModioAsyncRequest_SteamAuth::Response );
+  });
+
+  return Request->GetHandle();
 }
 
-void FModioSubsystem::AddModTags(int32 ModId, const TArray<FString> &Tags, FModioGenericDelegate AddModTagsDelegate)
+FModioAsyncRequestHandle FModioSubsystem::GalaxyAuth(const FString &Appdata, FModioGenericDelegate GalaxyAuthDelegate)
 {
-  FModioAsyncRequest_AddModTags *Request = CreateAsyncRequest<FModioAsyncRequest_AddModTags>( this, AddModTagsDelegate );
-  char **ModTags = new char*[Tags.Num()];
-  for(int i = 0; i < Tags.Num(); i++)
-  {
-    ModTags[i] = new char[Tags[i].Len() + 1];
+  FScopeLock SdkLock( &SdkCriticalSection );
 
-    #ifdef MODIO_UE4_WINDOWS_BUILD
-      strcpy_s(ModTags[i], Tags[i].Len() + 1, TCHAR_TO_UTF8(*Tags[i]));
-    #elif defined(MODIO_UE4_MAC_BUILD) || defined(MODIO_UE4_LINUX_BUILD)
-      strcpy(ModTags[i], TCHAR_TO_UTF8(*Tags[i]));
-    #endif
-  }
+  FModioAsyncRequest_GalaxyAuth *Request = CreateAsyncRequest<FModioAsyncRequest_GalaxyAuth>( this, TEXT( "GalaxyAuth" ), GalaxyAuthDelegate );
 
-  modioAddModTags(Request, (u32)ModId, ModTags, (u32)Tags.Num(), FModioAsyncRequest_AddModTags::Response);
-  for(int i = 0; i < Tags.Num(); i++)
+  IssueRequest( Request, [=]()
   {
-    delete[] ModTags[i];
-  }
-  delete[] ModTags;
+    modioGalaxyAuth( Request, TCHAR_TO_UTF8(*Appdata), FModioAsyncRequest_GalaxyAuth::Response );
+  });
+
+  return Request->GetHandle();
 }
 
-void FModioSubsystem::DeleteModTags(int32 ModId, const TArray<FString> &Tags, FModioGenericDelegate DeleteModTagsDelegate)
+FModioAsyncRequestHandle FModioSubsystem::OculusAuth(const FString& Nonce, const FString& OculusUserId, const FString& AccessToken, const FString& Email, const FString& Device, int32 DateExpires, FModioGenericDelegate OculusAuthDelegate)
 {
-  FModioAsyncRequest_DeleteModTags *Request = CreateAsyncRequest<FModioAsyncRequest_DeleteModTags>( this, DeleteModTagsDelegate );
-  char **ModTags = new char*[Tags.Num()];
-  for(int i = 0; i < Tags.Num(); i++)
-  {
-    ModTags[i] = new char[Tags[i].Len() + 1];
-    #ifdef MODIO_UE4_WINDOWS_BUILD
-      strcpy_s(ModTags[i], Tags[i].Len() + 1, TCHAR_TO_UTF8(*Tags[i]));
-    #elif defined(MODIO_UE4_MAC_BUILD) || defined(MODIO_UE4_LINUX_BUILD)
-      strcpy(ModTags[i], TCHAR_TO_UTF8(*Tags[i]));
-    #endif
-  }
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  FModioAsyncRequest_OculusAuth *Request = CreateAsyncRequest<FModioAsyncRequest_OculusAuth>( this, TEXT( "OculusAuth" ), OculusAuthDelegate );
 
-  modioDeleteModTags(Request, (u32)ModId, ModTags, (u32)Tags.Num(), FModioAsyncRequest_DeleteModTags::Response);
-  for(int i = 0; i < Tags.Num(); i++)
+  IssueRequest( Request, [=]()
   {
-    delete[] ModTags[i];
-  }
-  delete[] ModTags;
+    modioOculusAuth( Request, TCHAR_TO_UTF8(*Nonce), TCHAR_TO_UTF8(*OculusUserId), TCHAR_TO_UTF8(*AccessToken), TCHAR_TO_UTF8(*Email), TCHAR_TO_UTF8(*Device), (u32)DateExpires, FModioAsyncRequest_GalaxyAuth::Response );
+  });
+
+  return Request->GetHandle();
 }
 
-void FModioSubsystem::GetAllMetadataKVP(int32 ModId, FModioMetadataKVPArrayDelegate GetAllMetadataKVPDelegate)
+TFunction<void( const FModioAsyncRequestHandle &Handle )> FModioSubsystem::MakePageCancelFunction()
 {
-  FModioAsyncRequest_GetAllMetadataKVP *Request = CreateAsyncRequest<FModioAsyncRequest_GetAllMetadataKVP>( this, GetAllMetadataKVPDelegate );
-  modioGetAllMetadataKVP(Request, (u32)ModId, FModioAsyncRequest_GetAllMetadataKVP::Response);
+  TWeakPtr<FModioSubsystem, ESPMode::Fast> WeakModio = AsShared();
+  return [WeakModio]( const FModioAsyncRequestHandle &Handle )
+  {
+    if( FModioSubsystemPtr Modio = WeakModio.Pin() )
+    {
+      Modio->CancelAsyncRequest( Handle );
+    }
+  };
 }
 
-void FModioSubsystem::AddMetadataKVP(int32 ModId, const TMap<FString, FString> &MetadataKVP, FModioGenericDelegate AddMetadataKVPDelegate)
+FModioPagedModQueryRef FModioSubsystem::GetAllModsPaged(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 PageSize, int32 MaxPagesInFlight, FModioModArrayDelegate PageDelegate, FModioGenericDelegate CompleteDelegate)
 {
-  FModioAsyncRequest_AddMetadataKVP *Request = CreateAsyncRequest<FModioAsyncRequest_AddMetadataKVP>( this, AddMetadataKVPDelegate );
-  char **CMetadataKVP = new char*[MetadataKVP.Num()];
-
-  uint32 i = 0;
-  for (const TPair<FString, FString>& pair : MetadataKVP)
+  TWeakPtr<FModioSubsystem, ESPMode::Fast> WeakModio = AsShared();
+  // Compiled once, every page only adds it's limit and offset
+  FModioCompiledFilterRef Filter = FModioCompiledFilter::Compile( FilterCreator, ModTags );
+  FModioPagedModQueryRef Query = FModioPagedModQuery::Create( [WeakModio, Filter]( int32 Limit, int32 Offset, FModioModArrayDelegate Delegate )
   {
-    FString StringfiedKVP = pair.Key + ":" + pair.Value;
-    CMetadataKVP[i] = new char[StringfiedKVP.Len() + 1];
-    #ifdef MODIO_UE4_WINDOWS_BUILD
-      strcpy_s(CMetadataKVP[i], StringfiedKVP.Len() + 1, TCHAR_TO_UTF8(*StringfiedKVP));
-    #elif defined(MODIO_UE4_MAC_BUILD) || defined(MODIO_UE4_LINUX_BUILD)
-      strcpy(CMetadataKVP[i], TCHAR_TO_UTF8(*StringfiedKVP));
-    #endif
-    i++;
-  }
-  modioAddMetadataKVP(Request, (u32)ModId, CMetadataKVP, (u32)MetadataKVP.Num(), FModioAsyncRequest_AddMetadataKVP::Response);
-  for(int j = 0; j < MetadataKVP.Num(); j++)
-  {
-    delete[] CMetadataKVP[j];
-  }
-  delete[] CMetadataKVP;
+    FModioSubsystemPtr Modio = WeakModio.Pin();
+    if( Modio.IsValid() )
+    {
+      return Modio->GetAllMods( Filter, Limit, Offset, Modio->DefaultModFields, Delegate );
+    }
+    return FModioAsyncRequestHandle();
+  }, MakePageCancelFunction(), 0, PageSize, MaxPagesInFlight, PageDelegate, CompleteDelegate );
+  Query->Start();
+  return Query;
 }
 
-void FModioSubsystem::DeleteMetadataKVP(int32 ModId, const TMap<FString, FString> &MetadataKVP, FModioGenericDelegate DeleteMetadataKVPDelegate)
+FModioPagedModQueryRef FModioSubsystem::GetUserSubscriptionsPaged(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 PageSize, int32 MaxPagesInFlight, FModioModArrayDelegate PageDelegate, FModioGenericDelegate CompleteDelegate)
 {
-  FModioAsyncRequest_DeleteMetadataKVP *Request = CreateAsyncRequest<FModioAsyncRequest_DeleteMetadataKVP>( this, DeleteMetadataKVPDelegate );
-  char **CMetadataKVP = new char*[MetadataKVP.Num()];
-  
-  uint32 i = 0;
-  for (const TPair<FString, FString>& pair : MetadataKVP)
+  TWeakPtr<FModioSubsystem, ESPMode::Fast> WeakModio = AsShared();
+  // Compiled once, every page only adds it's limit and offset
+  FModioCompiledFilterRef Filter = FModioCompiledFilter::Compile( FilterCreator, ModTags );
+  FModioPagedModQueryRef Query = FModioPagedModQuery::Create( [WeakModio, Filter]( int32 Limit, int32 Offset, FModioModArrayDelegate Delegate )
   {
-    FString StringfiedKVP = pair.Key + ":" + pair.Value;
-    CMetadataKVP[i] = new char[StringfiedKVP.Len() + 1];
-    #ifdef MODIO_UE4_WINDOWS_BUILD
-      strcpy_s(CMetadataKVP[i], StringfiedKVP.Len() + 1, TCHAR_TO_UTF8(*StringfiedKVP));
-    #elif defined(MODIO_UE4_MAC_BUILD) || defined(MODIO_UE4_LINUX_BUILD)
-      strcpy(CMetadataKVP[i], TCHAR_TO_UTF8(*StringfiedKVP));
-    #endif
-    i++;
-  }
+    FModioSubsystemPtr Modio = WeakModio.Pin();
+    if( Modio.IsValid() )
+    {
+      return Modio->GetUserSubscriptions( Filter, Limit, Offset, Modio->DefaultModFields, Delegate );
+    }
+    return FModioAsyncRequestHandle();
+  }, MakePageCancelFunction(), 0, PageSize, MaxPagesInFlight, PageDelegate, CompleteDelegate );
+  Query->Start();
+  return Query;
+}
 
-  modioDeleteMetadataKVP(Request, (u32)ModId, CMetadataKVP, (u32)MetadataKVP.Num(), FModioAsyncRequest_DeleteModTags::Response);
-  for(int j = 0; j < MetadataKVP.Num(); j++)
+FModioPagedModQueryRef FModioSubsystem::GetUserModsPaged(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 PageSize, int32 MaxPagesInFlight, FModioModArrayDelegate PageDelegate, FModioGenericDelegate CompleteDelegate)
+{
+  TWeakPtr<FModioSubsystem, ESPMode::Fast> WeakModio = AsShared();
+  // Compiled once, every page only adds it's limit and offset
+  FModioCompiledFilterRef Filter = FModioCompiledFilter::Compile( FilterCreator, ModTags );
+  FModioPagedModQueryRef Query = FModioPagedModQuery::Create( [WeakModio, Filter]( int32 Limit, int32 Offset, FModioModArrayDelegate Delegate )
   {
-    delete[] CMetadataKVP[j];
-  }
-  delete[] CMetadataKVP;
+    FModioSubsystemPtr Modio = WeakModio.Pin();
+    if( Modio.IsValid() )
+    {
+      return Modio->GetUserMods( Filter, Limit, Offset, Modio->DefaultModFields, Delegate );
+    }
+    return FModioAsyncRequestHandle();
+  }, MakePageCancelFunction(), 0, PageSize, MaxPagesInFlight, PageDelegate, CompleteDelegate );
+  Query->Start();
+  return Query;
 }
 
-void FModioSubsystem::AddModLogo(int32 ModId, const FString &LogoPath, FModioGenericDelegate AddModLogoDelegate)
+FModioPagedUserEventQueryRef FModioSubsystem::GetUserEventsPaged(int32 PageSize, int32 MaxPagesInFlight, FModioUserEventArrayDelegate PageDelegate, FModioGenericDelegate CompleteDelegate)
 {
-  FModioAsyncRequest_AddModLogo *Request = CreateAsyncRequest<FModioAsyncRequest_AddModLogo>( this, AddModLogoDelegate );
-  modioAddModLogo( Request, ModId, TCHAR_TO_UTF8(*LogoPath), FModioAsyncRequest_AddModLogo::Response );
+  TWeakPtr<FModioSubsystem, ESPMode::Fast> WeakModio = AsShared();
+  FModioPagedUserEventQueryRef Query = FModioPagedUserEventQuery::Create( [WeakModio]( int32 Limit, int32 Offset, FModioUserEventArrayDelegate Delegate )
+  {
+    FModioSubsystemPtr Modio = WeakModio.Pin();
+    if( Modio.IsValid() )
+    {
+      return Modio->GetUserEvents( Limit, Offset, Delegate );
+    }
+    return FModioAsyncRequestHandle();
+  }, MakePageCancelFunction(), 0, PageSize, MaxPagesInFlight, PageDelegate, CompleteDelegate );
+  Query->Start();
+  return Query;
 }
 
-void FModioSubsystem::AddModImages(int32 ModId, const TArray<FString> &ImagePaths, FModioGenericDelegate AddModImagesDelegate)
+FModioPagedRatingQueryRef FModioSubsystem::GetUserRatingsPaged(int32 PageSize, int32 MaxPagesInFlight, FModioRatingArrayDelegate PageDelegate, FModioGenericDelegate CompleteDelegate)
 {
-  FModioAsyncRequest_AddModImages *Request = CreateAsyncRequest<FModioAsyncRequest_AddModImages>( this, AddModImagesDelegate );
-  char **CImagePaths = new char*[ImagePaths.Num()];
-  for(int i = 0; i < ImagePaths.Num(); i++)
-  {
-    CImagePaths[i] = new char[ImagePaths[i].Len() + 1];
-    #ifdef MODIO_UE4_WINDOWS_BUILD
-      strcpy_s(CImagePaths[i], ImagePaths[i].Len() + 1, TCHAR_TO_UTF8(*ImagePaths[i]));
-    #elif defined(MODIO_UE4_MAC_BUILD) || defined(MODIO_UE4_LINUX_BUILD)
-      strcpy(CImagePaths[i], TCHAR_TO_UTF8(*ImagePaths[i]));
-    #endif
-  }
-  modioAddModImages(Request, (u32)ModId, CImagePaths, (u32)ImagePaths.Num(), FModioAsyncRequest_AddModImages::Response);
-  for(int i = 0; i < ImagePaths.Num(); i++)
+  TWeakPtr<FModioSubsystem, ESPMode::Fast> WeakModio = AsShared();
+  FModioPagedRatingQueryRef Query = FModioPagedRatingQuery::Create( [WeakModio]( int32 Limit, int32 Offset, FModioRatingArrayDelegate Delegate )
   {
-    delete[] CImagePaths[i];
-  }
-  delete[] CImagePaths;
+    FModioSubsystemPtr Modio = WeakModio.Pin();
+    if( Modio.IsValid() )
+    {
+      return Modio->GetUserRatings( Limit, Offset, Delegate );
+    }
+    return FModioAsyncRequestHandle();
+  }, MakePageCancelFunction(), 0, PageSize, MaxPagesInFlight, PageDelegate, CompleteDelegate );
+  Query->Start();
+  return Query;
 }
 
-void FModioSubsystem::AddModYoutubeLinks(int32 ModId, const TArray<FString> &YoutubeLinks, FModioGenericDelegate AddModYoutubeLinksDelegate)
+void FModioSubsystem::Process()
 {
-  FModioAsyncRequest_AddModYoutubeLinks *Request = CreateAsyncRequest<FModioAsyncRequest_AddModYoutubeLinks>( this, AddModYoutubeLinksDelegate );
-  char **CYoutubeLinks = new char*[YoutubeLinks.Num()];
-  for(int i = 0; i < YoutubeLinks.Num(); i++)
+  if( PendingGetModBatch.Num() && FPlatformTime::Seconds() - PendingGetModBatchStartTime >= GetModBatchWindow )
   {
-    CYoutubeLinks[i] = new char[YoutubeLinks[i].Len() + 1];
-    #ifdef MODIO_UE4_WINDOWS_BUILD
-      strcpy_s(CYoutubeLinks[i], YoutubeLinks[i].Len() + 1, TCHAR_TO_UTF8(*YoutubeLinks[i]));
-    #elif defined(MODIO_UE4_MAC_BUILD) || defined(MODIO_UE4_LINUX_BUILD)
-      strcpy(CYoutubeLinks[i], TCHAR_TO_UTF8(*YoutubeLinks[i]));
-    #endif
+    FlushGetModBatch();
   }
-  modioAddModYoutubeLinks(Request, (u32)ModId, CYoutubeLinks, (u32)YoutubeLinks.Num(), FModioAsyncRequest_AddModYoutubeLinks::Response);
-  for(int i = 0; i < YoutubeLinks.Num(); i++)
+
+  if( PendingSearch.IsSet() && FPlatformTime::Seconds() - PendingSearch->Time >= SearchDebounce )
   {
-    delete[] CYoutubeLinks[i];
+    FlushPendingSearch();
   }
-  delete[] CYoutubeLinks;
-}
 
-void FModioSubsystem::AddModSketchfabLinks(int32 ModId, const TArray<FString> &SketchfabLinks, FModioGenericDelegate AddModSketchfabLinksDelegate)
-{
-  FModioAsyncRequest_AddModSketchfabLinks *Request = CreateAsyncRequest<FModioAsyncRequest_AddModSketchfabLinks>( this, AddModSketchfabLinksDelegate );
-  char **CSketchfabLinks = new char*[SketchfabLinks.Num()];
-  for(int i = 0; i < SketchfabLinks.Num(); i++)
+  if( !ProcessWorker.IsValid() )
   {
-    CSketchfabLinks[i] = new char[SketchfabLinks[i].Len() + 1];
-    #ifdef MODIO_UE4_WINDOWS_BUILD
-      strcpy_s(CSketchfabLinks[i], SketchfabLinks[i].Len() + 1, TCHAR_TO_UTF8(*SketchfabLinks[i]));
-    #elif defined(MODIO_UE4_MAC_BUILD) || defined(MODIO_UE4_LINUX_BUILD)
-      strcpy(CSketchfabLinks[i], TCHAR_TO_UTF8(*SketchfabLinks[i]));
-    #endif
+    ProcessSdk();
   }
-  modioAddModSketchfabLinks(Request, (u32)ModId, CSketchfabLinks, (u32)SketchfabLinks.Num(), FModioAsyncRequest_AddModSketchfabLinks::Response);
-  for(int i = 0; i < SketchfabLinks.Num(); i++)
+
+  if( DispatchScheduler.NumQueued() )
   {
-    delete[] CSketchfabLinks[i];
+    DispatchScheduler.Dispatch();
   }
-  delete[] CSketchfabLinks;
 }
 
-void FModioSubsystem::DeleteModImages(int32 ModId, const TArray<FString> &ImagePaths, FModioGenericDelegate DeleteModImagesDelegate)
+void FModioSubsystem::PollEvents()
 {
-  FModioAsyncRequest_DeleteModImages *Request = CreateAsyncRequest<FModioAsyncRequest_DeleteModImages>( this, DeleteModImagesDelegate );
-  char **CImagePaths = new char*[ImagePaths.Num()];
-  for(int i = 0; i < ImagePaths.Num(); i++)
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  modioPollEvents();
+}
+
+void FModioSubsystem::SetModEventsPollInterval(int32 IntervalInSeconds)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  modioSetModEventsPollInterval((u32)IntervalInSeconds);
+}
+
+void FModioSubsystem::SetUserEventsPollInterval(int32 IntervalInSeconds)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  modioSetUserEventsPollInterval((u32)IntervalInSeconds);
+}
+
+void FModioSubsystem::SetGetModBatching(bool bEnabled, float WindowInSeconds)
+{
+  GetModBatchWindow = FMath::Max( WindowInSeconds, 0.0f );
+  bBatchGetModCalls = bEnabled;
+
+  if( !bBatchGetModCalls && PendingGetModBatch.Num() )
+  {
+    FlushGetModBatch();
+  }
+}
+
+void FModioSubsystem::SetDefaultModFields(EModioModFields Fields)
+{
+  DefaultModFields = Fields;
+}
+
+EModioModFields FModioSubsystem::GetDefaultModFields() const
+{
+  return DefaultModFields;
+}
+
+void FModioSubsystem::SetBackgroundProcessing(bool bEnabled)
+{
+  bProcessInBackground = bEnabled && FPlatformProcess::SupportsMultithreading();
+
+  if( bInitialized )
+  {
+    if( bProcessInBackground )
+    {
+      StartProcessWorker();
+    }
+    else
+    {
+      StopProcessWorker();
+    }
+  }
+}
+
+bool FModioSubsystem::IsProcessingInBackground() const
+{
+  return ProcessWorker.IsValid();
+}
+
+void FModioSubsystem::SetDispatchBudget(int32 BudgetInMicroseconds)
+{
+  DispatchScheduler.SetBudget( BudgetInMicroseconds );
+}
+
+int32 FModioSubsystem::GetNumQueuedDispatches() const
+{
+  return DispatchScheduler.NumQueued();
+}
+
+void FModioSubsystem::Logout()
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  modioLogout();
+}
+
+bool FModioSubsystem::IsLoggedIn()
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  return modioIsLoggedIn();
+}
+
+FModioUser FModioSubsystem::CurrentUser()
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  FModioUser User;
+  InitializeUser(User, modioGetCurrentUser());
+  return User;
+}
+
+void FModioSubsystem::AuthenticateViaToken(const FString& AccessToken)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  modioAuthenticateViaToken(TCHAR_TO_UTF8(*AccessToken));
+}
+
+FModioAsyncRequestHandle FModioSubsystem::GetGame(uint32 GameId, FModioGameDelegate GetGameDelegate)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  FString CoalesceKey = FString::Printf(TEXT("GetGame:%u"), GameId);
+  FModioAsyncRequestHandle CachedHandle;
+  if( FindCachedResponse<FModioAsyncRequest_GetGame, FModioGame>( TEXT( "GetGame" ), CoalesceKey, GetGameDelegate, CachedHandle ) )
+  {
+    return CachedHandle;
+  }
+
+  bool bCoalesced = false;
+  FModioAsyncRequest_GetGame* Request = CreateCoalescedAsyncRequest<FModioAsyncRequest_GetGame>( TEXT( "GetGame" ), CoalesceKey, GetGameDelegate, bCoalesced);
+  if( bCoalesced )
+  {
+    return Request->GetHandle();
+  }
+
+  IssueRequest( Request, [=]()
+  {
+    modioGetGame(Request, GameId, FModioAsyncRequest_GetGame::Response);
+  });
+
+  return Request->GetHandle();
+}
+
+FModioGameFuture FModioSubsystem::GetGameAsync(uint32 GameId)
+{
+  TModioPromise<TModioResult<FModioGame>> Promise;
+  GetGame( GameId, ModioFuture::MakeDelegate<FModioGameDelegate>( Promise ) );
+  return Promise.GetFuture();
+}
+
+FModioModFuture FModioSubsystem::GetModAsync(uint32 ModId)
+{
+  TModioPromise<TModioResult<FModioMod>> Promise;
+  GetMod( ModId, ModioFuture::MakeDelegate<FModioModDelegate>( Promise ) );
+  return Promise.GetFuture();
+}
+
+FModioModArrayFuture FModioSubsystem::GetAllModsAsync(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset)
+{
+  TModioPromise<TModioResult<TArray<FModioMod>>> Promise;
+  GetAllMods( FilterCreator, ModTags, Limit, Offset, ModioFuture::MakeDelegate<FModioModArrayDelegate>( Promise ) );
+  return Promise.GetFuture();
+}
+
+FModioUserFuture FModioSubsystem::GetAuthenticatedUserAsync()
+{
+  TModioPromise<TModioResult<FModioUser>> Promise;
+  GetAuthenticatedUser( ModioFuture::MakeDelegate<FModioUserDelegate>( Promise ) );
+  return Promise.GetFuture();
+}
+
+FModioModArrayFuture FModioSubsystem::GetUserSubscriptionsAsync(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset)
+{
+  TModioPromise<TModioResult<TArray<FModioMod>>> Promise;
+  GetUserSubscriptions( FilterCreator, ModTags, Limit, Offset, ModioFuture::MakeDelegate<FModioModArrayDelegate>( Promise ) );
+  return Promise.GetFuture();
+}
+
+FModioModArrayFuture FModioSubsystem::GetUserModsAsync(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset)
+{
+  TModioPromise<TModioResult<TArray<FModioMod>>> Promise;
+  GetUserMods( FilterCreator, ModTags, Limit, Offset, ModioFuture::MakeDelegate<FModioModArrayDelegate>( Promise ) );
+  return Promise.GetFuture();
+}
+
+FModioModfileArrayFuture FModioSubsystem::GetUserModfilesAsync(int32 Limit, int32 Offset)
+{
+  TModioPromise<TModioResult<TArray<FModioModfile>>> Promise;
+  GetUserModfiles( Limit, Offset, ModioFuture::MakeDelegate<FModioModfileArrayDelegate>( Promise ) );
+  return Promise.GetFuture();
+}
+
+FModioUserEventArrayFuture FModioSubsystem::GetUserEventsAsync(int32 Limit, int32 Offset)
+{
+  TModioPromise<TModioResult<TArray<FModioUserEvent>>> Promise;
+  GetUserEvents( Limit, Offset, ModioFuture::MakeDelegate<FModioUserEventArrayDelegate>( Promise ) );
+  return Promise.GetFuture();
+}
+
+FModioRatingArrayFuture FModioSubsystem::GetUserRatingsAsync(int32 Limit, int32 Offset)
+{
+  TModioPromise<TModioResult<TArray<FModioRating>>> Promise;
+  GetUserRatings( Limit, Offset, ModioFuture::MakeDelegate<FModioRatingArrayDelegate>( Promise ) );
+  return Promise.GetFuture();
+}
+
+FModioModfileArrayFuture FModioSubsystem::GetAllModfilesAsync(int32 ModId)
+{
+  TModioPromise<TModioResult<TArray<FModioModfile>>> Promise;
+  GetAllModfiles( ModId, ModioFuture::MakeDelegate<FModioModfileArrayDelegate>( Promise ) );
+  return Promise.GetFuture();
+}
+
+FModioModDependencyArrayFuture FModioSubsystem::GetAllModDependenciesAsync(int32 ModId)
+{
+  TModioPromise<TModioResult<TArray<FModioModDependency>>> Promise;
+  GetAllModDependencies( ModId, ModioFuture::MakeDelegate<FModioModDependencyArrayDelegate>( Promise ) );
+  return Promise.GetFuture();
+}
+
+FModioModTagArrayFuture FModioSubsystem::GetAllModTagsAsync(int32 ModId)
+{
+  TModioPromise<TModioResult<TArray<FModioModTag>>> Promise;
+  GetAllModTags( ModId, ModioFuture::MakeDelegate<FModioModTagArrayDelegate>( Promise ) );
+  return Promise.GetFuture();
+}
+
+FModioMetadataKVPArrayFuture FModioSubsystem::GetAllMetadataKVPAsync(int32 ModId)
+{
+  TModioPromise<TModioResult<TArray<FModioMetadataKVP>>> Promise;
+  GetAllMetadataKVP( ModId, ModioFuture::MakeDelegate<FModioMetadataKVPArrayDelegate>( Promise ) );
+  return Promise.GetFuture();
+}
+
+void FModioSubsystem::DownloadMod(int32 ModId)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  modioDownloadMod((u32)ModId);
+}
+
+void FModioSubsystem::CancelModDownload(int32 ModId)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  modioCancelModDownload((u32)ModId);
+}
+
+void FModioSubsystem::PauseDownloads()
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  modioPauseDownloads();
+}
+
+void FModioSubsystem::ResumeDownloads()
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  modioResumeDownloads();
+}
+
+FModioInstalledMod FModioSubsystem::GetInstalledMod(int32 ModId)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  FModioInstalledMod InstalledMod;
+
+  ModioInstalledMod modio_installed_mod;
+  modioGetInstalledMod((u32)ModId, &modio_installed_mod);
+
+  InitializeInstalledMod(InstalledMod, modio_installed_mod);
+  modioFreeInstalledMod(&modio_installed_mod);
+
+  return InstalledMod;
+}
+
+TArray<FModioInstalledMod> FModioSubsystem::GetAllInstalledMods()
+{
+  TArray<FModioInstalledMod> InstalledMods;
+  TArray<FModioInstalledModSummary> Summaries;
+
+  {
+    FScopeLock SdkLock( &SdkCriticalSection );
+
+    u32 installed_mods_count = modioGetAllInstalledModsCount();
+    ModioInstalledMod *modio_installed_mods = (ModioInstalledMod *)malloc(installed_mods_count * sizeof(*modio_installed_mods));
+    modioGetAllInstalledMods(modio_installed_mods);
+
+    // The index is refreshed for free while we have everything at hand
+    bool bRefreshIndex = IsInGameThread();
+    Summaries.SetNum( bRefreshIndex ? installed_mods_count : 0 );
+
+    for (u32 i = 0; i < installed_mods_count; i++)
+    {
+      FModioInstalledMod installed_mod;
+      InitializeInstalledMod(installed_mod, modio_installed_mods[i]);
+      if( bRefreshIndex )
+      {
+        InitializeInstalledModSummary( Summaries[i], modio_installed_mods[i] );
+      }
+      modioFreeInstalledMod(&modio_installed_mods[i]);
+      InstalledMods.Add(installed_mod);
+    }
+
+    free(modio_installed_mods);
+  }
+
+  if( IsInGameThread() )
+  {
+    if( bKeepModCatalog )
+    {
+      for( const FModioInstalledMod &InstalledMod : InstalledMods )
+      {
+        ModCatalog.AddOrUpdate( InstalledMod.Mod );
+      }
+    }
+    InstalledModIndex.Reset( MoveTemp( Summaries ) );
+  }
+
+  return InstalledMods;
+}
+
+TArray<int32> FModioSubsystem::GetAllDownloadedMods()
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  TArray<int32> DownloadedMods;
+
+  u32 downloaded_mods_count = modioGetAllDownloadedModsCount();
+  u32 *modio_downloaded_mods = new u32[downloaded_mods_count];
+  modioGetAllDownloadedMods(modio_downloaded_mods);
+
+  for (u32 i = 0; i < downloaded_mods_count; i++)
+  {
+    DownloadedMods.Add(modio_downloaded_mods[i]);
+  }
+
+  delete[] modio_downloaded_mods;
+
+  return DownloadedMods;
+}
+
+TArray<FModioQueuedModDownload> FModioSubsystem::GetModDownloadQueue()
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  TArray<FModioQueuedModDownload> QueuedMods;
+
+  u32 download_queue_count = modioGetModDownloadQueueCount();
+  ModioQueuedModDownload *modio_queued_mods = (ModioQueuedModDownload *)malloc(download_queue_count * sizeof(*modio_queued_mods));
+  modioGetModDownloadQueue(modio_queued_mods);
+
+  for (u32 i = 0; i < download_queue_count; i++)
+  {
+    FModioQueuedModDownload queued_mod;
+    InitializeQueuedModDownload(queued_mod, modio_queued_mods[i]);
+    modioFreeQueuedModDownload(&modio_queued_mods[i]);
+    QueuedMods.Add(queued_mod);
+  }
+
+  free(modio_queued_mods);
+
+  return QueuedMods;
+}
+void FModioSubsystem::InstallDownloadedMods()
+{
+  {
+    FScopeLock SdkLock( &SdkCriticalSection );
+
+    modioInstallDownloadedMods();
+  }
+
+  RunOnGameThread( [this]()
+  {
+    RefreshInstalledMods();
+  });
+}
+
+FModioInstalledModSnapshotRef FModioSubsystem::GetInstalledModsSnapshot()
+{
+  FModioInstalledModSnapshotRef Snapshot = InstalledModIndex.GetSnapshot();
+
+  u32 installed_mods_count;
+  {
+    FScopeLock SdkLock( &SdkCriticalSection );
+    installed_mods_count = modioGetAllInstalledModsCount();
+  }
+
+  if( (int32)installed_mods_count != Snapshot->Num() )
+  {
+    // Something installed or removed mods without going through us
+    if( IsInGameThread() )
+    {
+      RefreshInstalledMods();
+      Snapshot = InstalledModIndex.GetSnapshot();
+    }
+    else
+    {
+      RunOnGameThread( [this]()
+      {
+        RefreshInstalledMods();
+      });
+    }
+  }
+  return Snapshot;
+}
+
+void FModioSubsystem::RefreshInstalledMods()
+{
+  check( IsInGameThread() );
+
+  TArray<FModioInstalledModSummary> Summaries;
+  {
+    FScopeLock SdkLock( &SdkCriticalSection );
+
+    u32 installed_mods_count = modioGetAllInstalledModsCount();
+    ModioInstalledMod *modio_installed_mods = (ModioInstalledMod *)malloc(installed_mods_count * sizeof(*modio_installed_mods));
+    modioGetAllInstalledMods(modio_installed_mods);
+
+    // Every entry is kept, even odd ones, so the count keeps matching the SDK's
+    Summaries.SetNum( installed_mods_count );
+    for (u32 i = 0; i < installed_mods_count; i++)
+    {
+      InitializeInstalledModSummary( Summaries[i], modio_installed_mods[i] );
+      modioFreeInstalledMod(&modio_installed_mods[i]);
+    }
+
+    free(modio_installed_mods);
+  }
+
+  // Listeners are called outside the lock, they are free to call back into the SDK
+  InstalledModIndex.Reset( MoveTemp( Summaries ) );
+}
+
+FDelegateHandle FModioSubsystem::AddInstalledModListener(int32 ModId, FModioInstalledModChangedDelegate Delegate)
+{
+  return InstalledModIndex.AddListener( ModId, Delegate );
+}
+
+FDelegateHandle FModioSubsystem::AddInstalledModsListener(FModioInstalledModChangedDelegate Delegate)
+{
+  return InstalledModIndex.AddListener( Delegate );
+}
+
+void FModioSubsystem::RemoveInstalledModListener(FDelegateHandle Handle)
+{
+  InstalledModIndex.RemoveListener( Handle );
+}
+
+void FModioSubsystem::NotifyModInstalled(int32 ModId)
+{
+  check( IsInGameThread() );
+
+  FModioInstalledModSummary Summary;
+  bool bInstalled;
+  {
+    FScopeLock SdkLock( &SdkCriticalSection );
+
+    ModioInstalledMod modio_installed_mod;
+    modioGetInstalledMod((u32)ModId, &modio_installed_mod);
+    bInstalled = InitializeInstalledModSummary( Summary, modio_installed_mod );
+    modioFreeInstalledMod(&modio_installed_mod);
+  }
+
+  if( bInstalled )
+  {
+    InstalledModIndex.Update( MoveTemp( Summary ) );
+  }
+  else
+  {
+    InstalledModIndex.Remove( ModId );
+  }
+}
+
+void FModioSubsystem::NotifyModsUninstalled(const TArray<int32> &ModIds)
+{
+  for( int32 ModId : ModIds )
+  {
+    InstalledModIndex.Remove( ModId );
+  }
+}
+void FModioSubsystem::AddModfile(int32 ModId, FModioModfileCreator ModfileCreator)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  InvalidateCachedResponses( ModId );
+
+  ModioModfileCreator modio_modfile_creator;
+  modioInitModfileCreator(&modio_modfile_creator);
+  SetupModioModfileCreator(ModfileCreator, modio_modfile_creator);
+  modioAddModfile((u32)ModId, modio_modfile_creator);
+  modioFreeModfileCreator(&modio_modfile_creator);
+}
+TArray<FModioQueuedModfileUpload> FModioSubsystem::GetModfileUploadQueue()
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  TArray<FModioQueuedModfileUpload> UploadQueue;
+
+  u32 upload_queue_count = modioGetModfileUploadQueueCount();
+  ModioQueuedModfileUpload *modio_queued_mods = (ModioQueuedModfileUpload *)malloc(upload_queue_count * sizeof(*modio_queued_mods));
+  modioGetModfileUploadQueue(modio_queued_mods);
+
+  for (u32 i = 0; i < upload_queue_count; i++)
+  {
+    FModioQueuedModfileUpload queued_mod;
+    InitializeQueuedModfileUpload(queued_mod, modio_queued_mods[i]);
+    UploadQueue.Add(queued_mod);
+  }
+
+  free(modio_queued_mods);
+
+  return UploadQueue;
+}
+
+FModioAsyncRequestHandle FModioSubsystem::SubscribeToMod(int32 ModId, FModioModDelegate SubscribeToModDelegate)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  FModioAsyncRequest_SubscribeToMod *Request = CreateAsyncRequest<FModioAsyncRequest_SubscribeToMod>( this, TEXT( "SubscribeToMod" ), SubscribeToModDelegate );
+
+  IssueRequest( Request, [=]()
+  {
+    modioSubscribeToMod(Request, (u32)ModId, FModioAsyncRequest_SubscribeToMod::Response);
+  });
+
+  return Request->GetHandle();
+}
+
+FModioAsyncRequestHandle FModioSubsystem::UnsubscribeFromMod(int32 ModId, FModioGenericDelegate UnsubscribeFromModDelegate)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  FModioAsyncRequest_UnsubscribeFromMod *Request = CreateAsyncRequest<FModioAsyncRequest_UnsubscribeFromMod>( this, TEXT( "UnsubscribeFromMod" ), UnsubscribeFromModDelegate );
+
+  IssueRequest( Request, [=]()
+  {
+    modioUnsubscribeFromMod(Request, (u32)ModId, FModioAsyncRequest_UnsubscribeFromMod::Response);
+  });
+
+  return Request->GetHandle();
+}
+
+bool FModioSubsystem::IsCurrentUserSubscribed(int32 ModId)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  return modioIsCurrentUserSubscribed((u32)ModId);
+}
+
+TArray<int32> FModioSubsystem::GetCurrentUserSubscriptions()
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  TArray<int32> CurrentUserSubscriptions;
+
+  u32 current_user_subscriptions_count = modioGetCurrentUserSubscriptionsCount();
+  u32 *current_user_subscriptions = new u32[current_user_subscriptions_count];
+  modioGetCurrentUserSubscriptions(current_user_subscriptions);
+
+  for (u32 i = 0; i < current_user_subscriptions_count; i++)
+  {
+    CurrentUserSubscriptions.Add(current_user_subscriptions[i]);
+  }
+
+  delete[] current_user_subscriptions;
+
+  return CurrentUserSubscriptions;
+}
+
+FModioAsyncRequestHandle FModioSubsystem::AddModRating(int32 ModId, bool IsRatingPositive, FModioGenericDelegate AddModRatingDelegate)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  InvalidateCachedResponses( ModId );
+
+  FModioAsyncRequest_AddModRating *Request = CreateAsyncRequest<FModioAsyncRequest_AddModRating>( this, TEXT( "AddModRating" ), AddModRatingDelegate );
+
+  IssueRequest( Request, [=]()
+  {
+    modioAddModRating(Request, (u32)ModId, IsRatingPositive, FModioAsyncRequest_AddModRating::Response);
+  });
+
+  return Request->GetHandle();
+}
+
+TEnumAsByte<EModioRatingType> FModioSubsystem::GetCurrentUserModRating(int32 ModId)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  u32 ModRating = modioGetCurrentUserModRating((u32)ModId);
+  return ConvertToModRatingType(ModRating);
+}
+
+FModioAsyncRequestHandle FModioSubsystem::GetAllModDependencies(int32 ModId, FModioModDependencyArrayDelegate GetAllModDependenciesDelegate)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  FString CoalesceKey = FString::Printf(TEXT("GetAllModDependencies:%d"), ModId);
+  FModioAsyncRequestHandle CachedHandle;
+  if( FindCachedResponse<FModioAsyncRequest_GetAllModDependencies, TArray<FModioModDependency>>( TEXT( "GetAllModDependencies" ), CoalesceKey, GetAllModDependenciesDelegate, CachedHandle ) )
+  {
+    return CachedHandle;
+  }
+
+  bool bCoalesced = false;
+  FModioAsyncRequest_GetAllModDependencies *Request = CreateCoalescedAsyncRequest<FModioAsyncRequest_GetAllModDependencies>( TEXT( "GetAllModDependencies" ), CoalesceKey, GetAllModDependenciesDelegate, bCoalesced );
+  if( bCoalesced )
+  {
+    return Request->GetHandle();
+  }
+
+  IssueRequest( Request, [=]()
+  {
+    modioGetAllModDependencies(Request, (u32)ModId, FModioAsyncRequest_GetAllModDependencies::Response);
+  });
+
+  return Request->GetHandle();
+}
+
+FModioAsyncRequestHandle FModioSubsystem::AddModDependencies(int32 ModId, const TArray<int32> &Dependencies, FModioGenericDelegate AddModDependenciesDelegate)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  InvalidateCachedResponses( ModId );
+
+  FModioAsyncRequest_AddModDependencies *Request = CreateAsyncRequest<FModioAsyncRequest_AddModDependencies>( this, TEXT( "AddModDependencies" ), AddModDependenciesDelegate );
+
+  IssueRequest( Request, [=]()
+  {
+    u32 *ModIds = new u32[Dependencies.Num()];
+    for(int i = 0; i < Dependencies.Num(); i++)
+    {
+      ModIds[i] = Dependencies[i];
+    }
+    modioAddModDependencies(Request, (u32)ModId, ModIds, (u32)Dependencies.Num(), FModioAsyncRequest_AddModDependencies::Response);
+    delete[] ModIds;
+  });
+
+  return Request->GetHandle();
+}
+
+FModioAsyncRequestHandle FModioSubsystem::DeleteModDependencies(int32 ModId, const TArray<int32> &Dependencies, FModioGenericDelegate DeleteModDependenciesDelegate)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  InvalidateCachedResponses( ModId );
+
+  FModioAsyncRequest_DeleteModDependencies *Request = CreateAsyncRequest<FModioAsyncRequest_DeleteModDependencies>( this, TEXT( "DeleteModDependencies" ), DeleteModDependenciesDelegate );
+
+  IssueRequest( Request, [=]()
+  {
+    u32 *ModIds = new u32[Dependencies.Num()];
+    for(int i = 0; i < Dependencies.Num(); i++)
+    {
+      ModIds[i] = Dependencies[i];
+    }
+    modioDeleteModDependencies(Request, (u32)ModId, ModIds, (u32)Dependencies.Num(), FModioAsyncRequest_DeleteModDependencies::Response);
+    delete[] ModIds;
+  });
+
+  return Request->GetHandle();
+}
+
+FModioAsyncRequestHandle FModioSubsystem::SubmitReport(TEnumAsByte<EModioResourceType> Resource, int32 Id, TEnumAsByte<EModioReportType> Type, const FString &Name, const FString &Summary, FModioGenericDelegate SubmitReportDelegate)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  FModioAsyncRequest_SubmitReport *Request = CreateAsyncRequest<FModioAsyncRequest_SubmitReport>( this, TEXT( "SubmitReport" ), SubmitReportDelegate );
+  
+  IssueRequest( Request, [=]()
+  {
+    FString ResourceStr = "";
+    switch (Resource)
+    {
+    case EModioResourceType::GAMES:
+      ResourceStr = "games";
+      break;
+    case EModioResourceType::MODS:
+      ResourceStr = "mods";
+      break;
+    case EModioResourceType::USERS:
+      ResourceStr = "users";
+      break;
+    default:
+      // @todo: handle error
+      break;
+    }
+
+    u32 CType = 0;
+
+    switch (Type)
+    {
+    case EModioReportType::GENERIC:
+      CType = 0;
+      break;
+    case EModioReportType::DMCA:
+      CType = 1;
+      break;
+    default:
+      // @todo: handle error
+      break;
+    }
+
+    modioSubmitReport(Request, TCHAR_TO_UTF8(*ResourceStr), (u32)Id, CType, TCHAR_TO_UTF8(*Name), TCHAR_TO_UTF8(*Summary), FModioAsyncRequest_SubmitReport::Response);
+  });
+
+  return Request->GetHandle();
+}
+
+FModioAsyncRequestHandle FModioSubsystem::GetAllModTags(int32 ModId, FModioModTagArrayDelegate GetAllModTagsDelegate)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  FString CoalesceKey = FString::Printf(TEXT("GetAllModTags:%d"), ModId);
+  FModioAsyncRequestHandle CachedHandle;
+  if( FindCachedResponse<FModioAsyncRequest_GetAllModTags, TArray<FModioModTag>>( TEXT( "GetAllModTags" ), CoalesceKey, GetAllModTagsDelegate, CachedHandle ) )
+  {
+    return CachedHandle;
+  }
+
+  bool bCoalesced = false;
+  FModioAsyncRequest_GetAllModTags *Request = CreateCoalescedAsyncRequest<FModioAsyncRequest_GetAllModTags>( TEXT( "GetAllModTags" ), CoalesceKey, GetAllModTagsDelegate, bCoalesced );
+  if( bCoalesced )
+  {
+    return Request->GetHandle();
+  }
+
+  IssueRequest( Request, [=]()
+  {
+    modioGetModTags(Request, (u32)ModId, FModioAsyncRequest_GetAllModTags::Response);
+  });
+
+  return Request->GetHandle();
+}
+
+FModioAsyncRequestHandle FModioSubsystem::AddModTags(int32 ModId, const TArray<FString> &Tags, FModioGenericDelegate AddModTagsDelegate)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  InvalidateCachedResponses( ModId );
+
+  FModioAsyncRequest_AddModTags *Request = CreateAsyncRequest<FModioAsyncRequest_AddModTags>( this, TEXT( "AddModTags" ), AddModTagsDelegate );
+
+  IssueRequest( Request, [=]()
+  {
+    FModioUtf8StringArray ModTags( Tags );
+    modioAddModTags(Request, (u32)ModId, ModTags.GetData(), ModTags.Num(), FModioAsyncRequest_AddModTags::Response);
+  });
+
+  return Request->GetHandle();
+}
+
+FModioAsyncRequestHandle FModioSubsystem::DeleteModTags(int32 ModId, const TArray<FString> &Tags, FModioGenericDelegate DeleteModTagsDelegate)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  InvalidateCachedResponses( ModId );
+
+  FModioAsyncRequest_DeleteModTags *Request = CreateAsyncRequest<FModioAsyncRequest_DeleteModTags>( this, TEXT( "DeleteModTags" ), DeleteModTagsDelegate );
+
+  IssueRequest( Request, [=]()
+  {
+    FModioUtf8StringArray ModTags( Tags );
+    modioDeleteModTags(Request, (u32)ModId, ModTags.GetData(), ModTags.Num(), FModioAsyncRequest_DeleteModTags::Response);
+  });
+
+  return Request->GetHandle();
+}
+
+FModioAsyncRequestHandle FModioSubsystem::GetAllMetadataKVP(int32 ModId, FModioMetadataKVPArrayDelegate GetAllMetadataKVPDelegate)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  bool bCoalesced = false;
+  FModioAsyncRequest_GetAllMetadataKVP *Request = CreateCoalescedAsyncRequest<FModioAsyncRequest_GetAllMetadataKVP>( TEXT( "GetAllMetadataKVP" ), FString::Printf(TEXT("GetAllMetadataKVP:%d"), ModId), GetAllMetadataKVPDelegate, bCoalesced );
+  if( bCoalesced )
+  {
+    return Request->GetHandle();
+  }
+
+  IssueRequest( Request, [=]()
+  {
+    modioGetAllMetadataKVP(Request, (u32)ModId, FModioAsyncRequest_GetAllMetadataKVP::Response);
+  });
+
+  return Request->GetHandle();
+}
+
+FModioAsyncRequestHandle FModioSubsystem::AddMetadataKVP(int32 ModId, const TMap<FString, FString> &MetadataKVP, FModioGenericDelegate AddMetadataKVPDelegate)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  InvalidateCachedResponses( ModId );
+
+  FModioAsyncRequest_AddMetadataKVP *Request = CreateAsyncRequest<FModioAsyncRequest_AddMetadataKVP>( this, TEXT( "AddMetadataKVP" ), AddMetadataKVPDelegate );
+
+  IssueRequest( Request, [=]()
+  {
+    FModioUtf8StringArray CMetadataKVP( MetadataKVP );
+    modioAddMetadataKVP(Request, (u32)ModId, CMetadataKVP.GetData(), CMetadataKVP.Num(), FModioAsyncRequest_AddMetadataKVP::Response);
+  });
+
+  return Request->GetHandle();
+}
+
+FModioAsyncRequestHandle FModioSubsystem::DeleteMetadataKVP(int32 ModId, const TMap<FString, FString> &MetadataKVP, FModioGenericDelegate DeleteMetadataKVPDelegate)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  InvalidateCachedResponses( ModId );
+
+  FModioAsyncRequest_DeleteMetadataKVP *Request = CreateAsyncRequest<FModioAsyncRequest_DeleteMetadataKVP>( this, TEXT( "DeleteMetadataKVP" ), DeleteMetadataKVPDelegate );
+
+  IssueRequest( Request, [=]()
+  {
+    FModioUtf8StringArray CMetadataKVP( MetadataKVP );
+    modioDeleteMetadataKVP(Request, (u32)ModId, CMetadataKVP.GetData(), CMetadataKVP.Num(), FModioAsyncRequest_DeleteModTags::Response);
+  });
+
+  return Request->GetHandle();
+}
+
+FModioAsyncRequestHandle FModioSubsystem::AddModLogo(int32 ModId, const FString &LogoPath, FModioGenericDelegate AddModLogoDelegate)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  InvalidateCachedResponses( ModId );
+
+  FModioAsyncRequest_AddModLogo *Request = CreateAsyncRequest<FModioAsyncRequest_AddModLogo>( this, TEXT( "AddModLogo" ), AddModLogoDelegate );
+
+  IssueRequest( Request, [=]()
+  {
+    modioAddModLogo( Request, ModId, TCHAR_TO_UTF8(*LogoPath), FModioAsyncRequest_AddModLogo::Response );
+  });
+
+  return Request->GetHandle();
+}
+
+FModioAsyncRequestHandle FModioSubsystem::AddModImages(int32 ModId, const TArray<FString> &ImagePaths, FModioGenericDelegate AddModImagesDelegate)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  InvalidateCachedResponses( ModId );
+
+  FModioAsyncRequest_AddModImages *Request = CreateAsyncRequest<FModioAsyncRequest_AddModImages>( this, TEXT( "AddModImages" ), AddModImagesDelegate );
+
+  IssueRequest( Request, [=]()
+  {
+    FModioUtf8StringArray CImagePaths( ImagePaths );
+    modioAddModImages(Request, (u32)ModId, CImagePaths.GetData(), CImagePaths.Num(), FModioAsyncRequest_AddModImages::Response);
+  });
+
+  return Request->GetHandle();
+}
+
+FModioAsyncRequestHandle FModioSubsystem::AddModYoutubeLinks(int32 ModId, const TArray<FString> &YoutubeLinks, FModioGenericDelegate AddModYoutubeLinksDelegate)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  InvalidateCachedResponses( ModId );
+
+  FModioAsyncRequest_AddModYoutubeLinks *Request = CreateAsyncRequest<FModioAsyncRequest_AddModYoutubeLinks>( this, TEXT( "AddModYoutubeLinks" ), AddModYoutubeLinksDelegate );
+
+  IssueRequest( Request, [=]()
+  {
+    FModioUtf8StringArray CYoutubeLinks( YoutubeLinks );
+    modioAddModYoutubeLinks(Request, (u32)ModId, CYoutubeLinks.GetData(), CYoutubeLinks.Num(), FModioAsyncRequest_AddModYoutubeLinks::Response);
+  });
+
+  return Request->GetHandle();
+}
+
+FModioAsyncRequestHandle FModioSubsystem::AddModSketchfabLinks(int32 ModId, const TArray<FString> &SketchfabLinks, FModioGenericDelegate AddModSketchfabLinksDelegate)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  InvalidateCachedResponses( ModId );
+
+  FModioAsyncRequest_AddModSketchfabLinks *Request = CreateAsyncRequest<FModioAsyncRequest_AddModSketchfabLinks>( this, TEXT( "AddModSketchfabLinks" ), AddModSketchfabLinksDelegate );
+
+  IssueRequest( Request, [=]()
+  {
+    FModioUtf8StringArray CSketchfabLinks( SketchfabLinks );
+    modioAddModSketchfabLinks(Request, (u32)ModId, CSketchfabLinks.GetData(), CSketchfabLinks.Num(), FModioAsyncRequest_AddModSketchfabLinks::Response);
+  });
+
+  return Request->GetHandle();
+}
+
+FModioAsyncRequestHandle FModioSubsystem::DeleteModImages(int32 ModId, const TArray<FString> &ImagePaths, FModioGenericDelegate DeleteModImagesDelegate)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  InvalidateCachedResponses( ModId );
+
+  FModioAsyncRequest_DeleteModImages *Request = CreateAsyncRequest<FModioAsyncRequest_DeleteModImages>( this, TEXT( "DeleteModImages" ), DeleteModImagesDelegate );
+
+  IssueRequest( Request, [=]()
+  {
+    FModioUtf8StringArray CImagePaths( ImagePaths );
+    modioDeleteModImages(Request, (u32)ModId, CImagePaths.GetData(), CImagePaths.Num(), FModioAsyncRequest_DeleteModImages::Response);
+  });
+
+  return Request->GetHandle();
+}
+
+FModioAsyncRequestHandle FModioSubsystem::DeleteModYoutubeLinks(int32 ModId, const TArray<FString> &YoutubeLinks, FModioGenericDelegate DeleteModYoutubeLinksDelegate)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  InvalidateCachedResponses( ModId );
+
+  FModioAsyncRequest_DeleteModYoutubeLinks *Request = CreateAsyncRequest<FModioAsyncRequest_DeleteModYoutubeLinks>( this, TEXT( "DeleteModYoutubeLinks" ), DeleteModYoutubeLinksDelegate );
+
+  IssueRequest( Request, [=]()
+  {
+    FModioUtf8StringArray CYoutubeLinks( YoutubeLinks );
+    modioDeleteModYoutubeLinks(Request, (u32)ModId, CYoutubeLinks.GetData(), CYoutubeLinks.Num(), FModioAsyncRequest_DeleteModYoutubeLinks::Response);
+  });
+
+  return Request->GetHandle();
+}
+
+FModioAsyncRequestHandle FModioSubsystem::DeleteModSketchfabLinks(int32 ModId, const TArray<FString> &SketchfabLinks, FModioGenericDelegate DeleteModSketchfabLinksDelegate)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  InvalidateCachedResponses( ModId );
+
+  FModioAsyncRequest_DeleteModSketchfabLinks *Request = CreateAsyncRequest<FModioAsyncRequest_DeleteModSketchfabLinks>( this, TEXT( "DeleteModSketchfabLinks" ), DeleteModSketchfabLinksDelegate );
+
+  IssueRequest( Request, [=]()
+  {
+    FModioUtf8StringArray CSketchfabLinks( SketchfabLinks );
+    modioDeleteModSketchfabLinks(Request, (u32)ModId, CSketchfabLinks.GetData(), CSketchfabLinks.Num(), FModioAsyncRequest_DeleteModSketchfabLinks::Response);
+  });
+
+  return Request->GetHandle();
+}
+
+void FModioSubsystem::SetModDownloadListener(FModioListenerDelegate Delegate)
+{
+  FModioSubsystem::ModioOnModDownloadDelegate = Delegate;
+}
+
+void FModioSubsystem::SetModfileUploadListener(FModioListenerDelegate Delegate)
+{
+  FModioSubsystem::ModioOnModUploadDelegate = Delegate;
+}
+
+void FModioSubsystem::SetModEventListener(FModioModEventArrayDelegate Delegate)
+{
+  FModioSubsystem::ModioOnModEventDelegate = Delegate;
+}
+
+TEnumAsByte<EModioModState> FModioSubsystem::GetModState(int32 ModId)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  u32 ModState = modioGetModState((u32)ModId);
+  return ConvertToModState(ModState);
+}
+
+void FModioSubsystem::PrioritizeModDownload(int32 ModId)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  modioPrioritizeModDownload((u32)ModId);
+}
+
+FModioAsyncRequestHandle FModioSubsystem::DownloadModfilesById(const TArray<int32> &ModIds, FModioBooleanDelegate DownloadModfilesByIdDelegate)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  FModioAsyncRequest_DownloadModfilesById *Request = CreateAsyncRequest<FModioAsyncRequest_DownloadModfilesById>( this, TEXT( "DownloadModfilesById" ), DownloadModfilesByIdDelegate );
+
+  IssueRequest( Request, [=]()
+  {
+    u32 *CModIds = new u32[ModIds.Num()];
+    for(int i = 0; i < ModIds.Num(); i++)
+    {
+      CModIds[i] = ModIds[i];
+    }
+    modioDownloadModfilesById(Request, CModIds, (u32)ModIds.Num(), FModioAsyncRequest_DownloadModfilesById::Response);
+    delete[] CModIds;
+  }, EModioRequestPriority::BACKGROUND );
+
+  return Request->GetHandle();
+}
+
+FModioAsyncRequestHandle FModioSubsystem::GetAllModfiles(int32 ModId, FModioModfileArrayDelegate GetAllModfilesDelegate)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  FString CoalesceKey = FString::Printf(TEXT("GetAllModfiles:%d"), ModId);
+  FModioAsyncRequestHandle CachedHandle;
+  if( FindCachedResponse<FModioAsyncRequest_GetAllModfiles, TArray<FModioModfile>>( TEXT( "GetAllModfiles" ), CoalesceKey, GetAllModfilesDelegate, CachedHandle ) )
+  {
+    return CachedHandle;
+  }
+
+  bool bCoalesced = false;
+  FModioAsyncRequest_GetAllModfiles *Request = CreateCoalescedAsyncRequest<FModioAsyncRequest_GetAllModfiles>( TEXT( "GetAllModfiles" ), CoalesceKey, GetAllModfilesDelegate, bCoalesced );
+  if( bCoalesced )
+  {
+    return Request->GetHandle();
+  }
+  
+  IssueRequest( Request, [=]()
+  {
+    ModioFilterCreator LocalModioFilterCreator;
+    modioInitFilter(&LocalModioFilterCreator);
+
+    modioGetAllModfiles( Request, ModId, LocalModioFilterCreator, FModioAsyncRequest_GetAllModfiles::Response );
+  });
+
+  return Request->GetHandle();
+}
+
+FModioAsyncRequestHandle FModioSubsystem::DownloadSubscribedModfiles(bool UninstallUnsubscribed, FModioBooleanDelegate DownloadSubscribedModfilesDelegate)
+{
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  FModioAsyncRequest_DownloadSubscribedModfiles *Request = CreateAsyncRequest<FModioAsyncRequest_DownloadSubscribedModfiles>( this, TEXT( "DownloadSubscribedModfiles" ), DownloadSubscribedModfilesDelegate );
+
+  IssueRequest( Request, [=]()
+  {
+    modioDownloadSubscribedModfiles(Request, UninstallUnsubscribed, FModioAsyncRequest_DownloadSubscribedModfiles::Response);
+  }, EModioRequestPriority::BACKGROUND );
+
+  return Request->GetHandle();
+}
+
+bool FModioSubsystem::UninstallMod(int32 ModId)
+{
+  bool bUninstalled;
+  {
+    FScopeLock SdkLock( &SdkCriticalSection );
+
+    bUninstalled = modioUninstallMod((u32)ModId);
+  }
+
+  if( bUninstalled )
+  {
+    RunOnGameThread( [this, ModId]()
+    {
+      NotifyModsUninstalled( { ModId } );
+    });
+  }
+  return bUninstalled;
+}
+
+FModioAsyncRequestHandle FModioSubsystem::UninstallUnavailableMods(FModioGenericDelegate UninstallUnavailableModsDelegate)
+{
+  // Checked even if the request waits in the queue, as PendingCalls is counted from them. Taken before the
+  // lock, as it might read the installed mods again and notify their listeners
+  FModioInstalledModSnapshotRef InstalledMods = GetInstalledModsSnapshot();
+
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  UE_LOG(LogTemp, Warning, TEXT("[mod.io] Uninstalling unavailable mods"));
+  int32 ResponseLimit = 100;
+  int32 PendingCalls = FMath::DivideAndRoundUp( InstalledMods->Num(), ResponseLimit );
+  UE_LOG(LogTemp, Warning, TEXT("[mod.io] A total of %i calls will be made to the mod.io API"), PendingCalls);
+  FModioAsyncRequest_UninstallUnavailableMods *Request = CreateAsyncRequest<FModioAsyncRequest_UninstallUnavailableMods>( this, TEXT( "UninstallUnavailableMods" ), UninstallUnavailableModsDelegate, PendingCalls );
+  FModioAsyncRequestHandle Handle = Request->GetHandle();
+  if( PendingCalls == 0 )
+  {
+    // No response would ever finish it, and issued it would hold a background slot for good
+    Request->FinishWithoutCalls();
+    return Handle;
+  }
+  Request->InstalledMods.Reserve( InstalledMods->Num() );
+  for( const FModioInstalledModSummary& InstalledMod : InstalledMods->GetMods() )
+  {
+    Request->InstalledMods.Add( InstalledMod.ModId );
+  }
+
+  IssueRequest( Request, [=]()
+  {
+    ModioFilterCreator modio_filter_creator;
+    modioInitFilter(&modio_filter_creator);
+    int32 CurrentCallCount = 0;
+    for(const FModioInstalledModSummary& InstalledMod : InstalledMods->GetMods())
+    {
+      CurrentCallCount ++;
+      modioAddFilterInField(&modio_filter_creator, "id", toString(InstalledMod.ModId).c_str());
+      if(CurrentCallCount % ResponseLimit == 0)
+      {
+        UE_LOG(LogTemp, Warning, TEXT("[mod.io] Calling modioGetAllMods"));
+        CurrentCallCount = 0;
+        modioGetAllMods(Request, modio_filter_creator, FModioAsyncRequest_UninstallUnavailableMods::Response);
+
+        modioFreeFilter(&modio_filter_creator);
+        modioInitFilter(&modio_filter_creator);
+      }
+    }
+    if(CurrentCallCount > 0)
+    {
+      UE_LOG(LogTemp, Warning, TEXT("[mod.io] Calling final modioGetAllMods"));
+      modioGetAllMods(Request, modio_filter_creator, FModioAsyncRequest_UninstallUnavailableMods::Response);
+    }
+    modioFreeFilter(&modio_filter_creator);
+  }, EModioRequestPriority::BACKGROUND );
+
+  return Handle;
+}
+
+/** Listeners are called from modioProcess, so they might come in on the processing worker */
+static void RunListener(TFunction<void()> Listener)
+{
+  if( ListenerSubsystem )
+  {
+    ListenerSubsystem->RunOnGameThread( MoveTemp( Listener ) );
+  }
+  else
+  {
+    Listener();
+  }
+}
+
+void onModDownload(u32 response_code, u32 mod_id)
+{
+  RunListener( [response_code, mod_id]()
+  {
+    FModioSubsystem::ModioOnModDownloadDelegate.ExecuteIfBound( (int32)response_code, (int32)mod_id );
+  });
+}
+
+void onModDownloadWithAutomaticInstalls(u32 response_code, u32 mod_id)
+{
+  modioInstallDownloadedMods();
+  RunListener( [response_code, mod_id]()
+  {
+    // Installed state is up to date by the time the download listener hears of it
+    if( ListenerSubsystem )
+    {
+      ListenerSubsystem->NotifyModInstalled( (int32)mod_id );
+    }
+    FModioSubsystem::ModioOnModDownloadDelegate.ExecuteIfBound( (int32)response_code, (int32)mod_id );
+  });
+}
+
+void onModUpload(u32 response_code, u32 mod_id)
+{
+  RunListener( [response_code, mod_id]()
+  {
+    FModioSubsystem::ModioOnModUploadDelegate.ExecuteIfBound( (int32)response_code, (int32)mod_id );
+  });
+}
+
+void onModEvent(ModioResponse ModioResponse, ModioModEvent* ModioEventsArray, u32 ModioEventsArraySize)
+{
+  FModioResponse Response;
+  InitializeResponse( Response, ModioResponse );
+  TArray<FModioModEvent> ModEvents = ConvertToTArrayModEvents(ModioEventsArray, ModioEventsArraySize);
+  RunListener( [Response, ModEvents = MoveTemp( ModEvents )]()
+  {
+    if( ListenerSubsystem )
+    {
+      ListenerSubsystem->NotifyModEventsReceived( ModEvents );
+    }
+    FModioSubsystem::ModioOnModEventDelegate.ExecuteIfBound( Response, ModEvents );
+  });
+}
+
+void FModioSubsystem::Init( const FString& RootDirectory, uint32 GameId, const FString& ApiKey, bool bIsLiveEnvironment, bool bInstallOnModDownload, bool bRetrieveModsFromOtherGames, bool bEnablePolling)
+{
+  check(!bInitialized);
+
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  u32 Environment = bIsLiveEnvironment ? MODIO_ENVIRONMENT_LIVE : MODIO_ENVIRONMENT_TEST;
+
+  modioInit( Environment, (u32)GameId, bRetrieveModsFromOtherGames, bEnablePolling, TCHAR_TO_UTF8(*ApiKey), TCHAR_TO_UTF8(*RootDirectory) );
+
+  if(bInstallOnModDownload)
+    modioSetDownloadListener(&onModDownloadWithAutomaticInstalls);
+  else
+    modioSetDownloadListener(&onModDownload);
+  
+  modioSetUploadListener(&onModUpload);
+
+  modioSetEventListener(&onModEvent);
+
+  ListenerSubsystem = this;
+  ModCatalogStorePath = FPaths::Combine( RootDirectory, TEXT( "modio_catalog.bin" ) );
+  StoreGameId = GameId;
+  bModCatalogStoreLoaded = false;
+  bInitialized = true;
+
+  // Mods installed in earlier sessions, or by another game when the root directory changed
+  RefreshInstalledMods();
+
+  if( bProcessInBackground )
+  {
+    StartProcessWorker();
+  }
+}
+
+void FModioSubsystem::QueueAsyncTask( struct FModioAsyncRequest* Request, void (*DestroyFunction)(struct FModioAsyncRequest*) )
+{
+  checkf(Request, TEXT("Trying to queue up a invalid async request"));
+  checkf(!Request->Handle.IsValid(), TEXT("Trying queue a async request twice"));
+
+  Request->Handle = AsyncRequests.Add(Request, DestroyFunction);
+}
+
+void FModioSubsystem::AsyncRequestDone( struct FModioAsyncRequest *Request )
+{
+  checkf(Request, TEXT("Passing in a bad request to AsyncRequestDone"));
+
+  StopCoalescing(Request);
+
+  if( !Request->QuerySlot.IsNone() )
+  {
+    // A later search on the slot has replaced us already if the handle differs
+    const FModioAsyncRequestHandle* SlotHandle = QuerySlots.Find( Request->QuerySlot );
+    if( SlotHandle && *SlotHandle == Request->Handle )
+    {
+      QuerySlots.Remove( Request->QuerySlot );
+    }
+  }
+
+  bool bFreedSlot = Request->bHoldsSlot;
+  if( bFreedSlot )
   {
-    CImagePaths[i] = new char[ImagePaths[i].Len() + 1];
-    #ifdef MODIO_UE4_WINDOWS_BUILD
-      strcpy_s(CImagePaths[i], ImagePaths[i].Len() + 1, TCHAR_TO_UTF8(*ImagePaths[i]));
-    #elif defined(MODIO_UE4_MAC_BUILD) || defined(MODIO_UE4_LINUX_BUILD)
-      strcpy(CImagePaths[i], TCHAR_TO_UTF8(*ImagePaths[i]));
-    #endif
+    Request->bHoldsSlot = false;
+    NumRequestsInFlight[Request->Priority]--;
   }
-  modioDeleteModImages(Request, (u32)ModId, CImagePaths, (u32)ImagePaths.Num(), FModioAsyncRequest_DeleteModImages::Response);
-  for(int i = 0; i < ImagePaths.Num(); i++)
+
+  verifyf(AsyncRequests.Remove(Request->Handle), TEXT("Async Request marking itself as done multiple times"));
+
+  if( bFreedSlot )
   {
-    delete[] CImagePaths[i];
+    AdmitQueuedRequests();
   }
-  delete[] CImagePaths;
 }
 
-void FModioSubsystem::DeleteModYoutubeLinks(int32 ModId, const TArray<FString> &YoutubeLinks, FModioGenericDelegate DeleteModYoutubeLinksDelegate)
+bool FModioSubsystem::CancelAsyncRequest( const FModioAsyncRequestHandle &Handle )
 {
-  FModioAsyncRequest_DeleteModYoutubeLinks *Request = CreateAsyncRequest<FModioAsyncRequest_DeleteModYoutubeLinks>( this, DeleteModYoutubeLinksDelegate );
-  char **CYoutubeLinks = new char*[YoutubeLinks.Num()];
-  for(int i = 0; i < YoutubeLinks.Num(); i++)
+  FModioAsyncRequest* Request = AsyncRequests.Find( Handle );
+  if( !Request )
   {
-    CYoutubeLinks[i] = new char[YoutubeLinks[i].Len() + 1];
-    #ifdef MODIO_UE4_WINDOWS_BUILD
-      strcpy_s(CYoutubeLinks[i], YoutubeLinks[i].Len() + 1, TCHAR_TO_UTF8(*YoutubeLinks[i]));
-    #elif defined(MODIO_UE4_MAC_BUILD) || defined(MODIO_UE4_LINUX_BUILD)
-      strcpy(CYoutubeLinks[i], TCHAR_TO_UTF8(*YoutubeLinks[i]));
-    #endif
+    return false;
   }
-  modioDeleteModYoutubeLinks(Request, (u32)ModId, CYoutubeLinks, (u32)YoutubeLinks.Num(), FModioAsyncRequest_DeleteModYoutubeLinks::Response);
-  for(int i = 0; i < YoutubeLinks.Num(); i++)
+
+  if( !Request->bCancelled )
+  {
+    Request->bCancelled = true;
+    NumCancelledRequests++;
+    INC_DWORD_STAT( STAT_ModioCancelledRequests );
+  }
+
+  // Once nobody in the group wants the response it doesn't have to be converted at all
+  FModioAsyncRequest* Leader = Request->LeaderHandle.IsValid() ? AsyncRequests.Find( Request->LeaderHandle ) : Request;
+  if( Leader && Leader->bCancelled )
   {
-    delete[] CYoutubeLinks[i];
+    bool bAbandoned = true;
+    for( const FModioAsyncRequestHandle& FollowerHandle : Leader->Followers )
+    {
+      FModioAsyncRequest* Follower = AsyncRequests.Find( FollowerHandle );
+      if( Follower && !Follower->bCancelled )
+      {
+        bAbandoned = false;
+        break;
+      }
+    }
+
+    if( bAbandoned )
+    {
+      // New identical reads need to go to the backend themselves
+      StopCoalescing( Leader );
+      Leader->bAbandoned = true;
+
+      // One still waiting for a slot is never sent, and doesn't hold back the requests queued behind it
+      if( !Leader->bHoldsSlot && QueuedRequests[Leader->Priority].Remove( Leader->GetHandle() ) )
+      {
+        Leader->FinishIfCancelled();
+        AdmitQueuedRequests();
+      }
+    }
   }
-  delete[] CYoutubeLinks;
+  return true;
 }
 
-void FModioSubsystem::DeleteModSketchfabLinks(int32 ModId, const TArray<FString> &SketchfabLinks, FModioGenericDelegate DeleteModSketchfabLinksDelegate)
+FModioAsyncRequestHandle FModioSubsystem::AssignQuerySlot( FName QuerySlot, const FModioAsyncRequestHandle &Handle )
 {
-  FModioAsyncRequest_DeleteModSketchfabLinks *Request = CreateAsyncRequest<FModioAsyncRequest_DeleteModSketchfabLinks>( this, DeleteModSketchfabLinksDelegate );
-  char **CSketchfabLinks = new char*[SketchfabLinks.Num()];
-  for(int i = 0; i < SketchfabLinks.Num(); i++)
+  // Copied, as cancelling can finish the previous request and remove it from the slot
+  FModioAsyncRequestHandle PreviousHandle = QuerySlots.FindRef( QuerySlot );
+  if( PreviousHandle.IsValid() && PreviousHandle != Handle )
+  {
+    CancelAsyncRequest( PreviousHandle );
+  }
+
+  // Requests answered right away, like from the cache, have nothing left to cancel
+  FModioAsyncRequest* Request = AsyncRequests.Find( Handle );
+  if( Request )
   {
-    CSketchfabLinks[i] = new char[SketchfabLinks[i].Len() + 1];
-    #ifdef MODIO_UE4_WINDOWS_BUILD
-      strcpy_s(CSketchfabLinks[i], SketchfabLinks[i].Len() + 1, TCHAR_TO_UTF8(*SketchfabLinks[i]));
-    #elif defined(MODIO_UE4_MAC_BUILD) || defined(MODIO_UE4_LINUX_BUILD)
-      strcpy(CSketchfabLinks[i], TCHAR_TO_UTF8(*SketchfabLinks[i]));
-    #endif
+    Request->QuerySlot = QuerySlot;
+    QuerySlots.Add( QuerySlot, Handle );
   }
-  modioDeleteModSketchfabLinks(Request, (u32)ModId, CSketchfabLinks, (u32)SketchfabLinks.Num(), FModioAsyncRequest_DeleteModSketchfabLinks::Response);
-  for(int i = 0; i < SketchfabLinks.Num(); i++)
+  else
   {
-    delete[] CSketchfabLinks[i];
+    QuerySlots.Remove( QuerySlot );
   }
-  delete[] CSketchfabLinks;
+  return Handle;
 }
 
-void FModioSubsystem::SetModDownloadListener(FModioListenerDelegate Delegate)
+int32 FModioSubsystem::GetNumCancelledRequests() const
 {
-  FModioSubsystem::ModioOnModDownloadDelegate = Delegate;
+  return NumCancelledRequests;
 }
 
-void FModioSubsystem::SetModfileUploadListener(FModioListenerDelegate Delegate)
+TArray<FModioEndpointMetrics> FModioSubsystem::GetRequestMetrics() const
 {
-  FModioSubsystem::ModioOnModUploadDelegate = Delegate;
+  return RequestMetrics.GetMetrics();
 }
 
-void FModioSubsystem::SetModEventListener(FModioModEventArrayDelegate Delegate)
+void FModioSubsystem::ResetRequestMetrics()
 {
-  FModioSubsystem::ModioOnModEventDelegate = Delegate;
+  RequestMetrics.Reset();
 }
 
-TEnumAsByte<EModioModState> FModioSubsystem::GetModState(int32 ModId)
+void FModioSubsystem::SetModCatalogEnabled(bool bEnabled)
 {
-  u32 ModState = modioGetModState((u32)ModId);
-  return ConvertToModState(ModState);
+  bKeepModCatalog = bEnabled;
+  if( !bKeepModCatalog )
+  {
+    ModCatalog.Reset();
+    UpdateModCatalogStats();
+  }
+  LoadModCatalogStore();
 }
 
-void FModioSubsystem::PrioritizeModDownload(int32 ModId)
+void FModioSubsystem::SetModCatalogStoreEnabled(bool bEnabled)
 {
-  modioPrioritizeModDownload((u32)ModId);
+  bStoreModCatalog = bEnabled;
+  LoadModCatalogStore();
+}
+
+bool FModioSubsystem::SaveModCatalogStore()
+{
+  check( IsInGameThread() );
+
+  FModioBinaryStoreWriter Writer;
+  TArray<int32> Indices;
+  ModCatalog.GetAllIndices( Indices );
+  for( int32 Index : Indices )
+  {
+    Writer.AddMod( ModCatalog.GetMod( Index ) );
+  }
+  Writer.AddTagOptions( CatalogTagOptions );
+  if( bInitialized && IsLoggedIn() )
+  {
+    Writer.SetUser( CurrentUser() );
+  }
+
+  if( !Writer.Save( ModCatalogStorePath, StoreGameId ) )
+  {
+    UE_LOG( LogModio, Warning, TEXT( "Couldn't write the mod catalog store to %s" ), *ModCatalogStorePath );
+    return false;
+  }
+  return true;
 }
 
-void FModioSubsystem::DownloadModfilesById(const TArray<int32> &ModIds, FModioBooleanDelegate DownloadModfilesByIdDelegate)
+bool FModioSubsystem::GetStoredUser(FModioUser &OutUser) const
 {
-  FModioAsyncRequest_DownloadModfilesById *Request = CreateAsyncRequest<FModioAsyncRequest_DownloadModfilesById>( this, DownloadModfilesByIdDelegate );
-  u32 *CModIds = new u32[ModIds.Num()];
-  for(int i = 0; i < ModIds.Num(); i++)
+  check( IsInGameThread() );
+  if( !StoredUser.IsSet() )
   {
-    CModIds[i] = ModIds[i];
+    return false;
   }
-  modioDownloadModfilesById(Request, CModIds, (u32)ModIds.Num(), FModioAsyncRequest_DownloadModfilesById::Response);
-  delete[] CModIds;
+  OutUser = StoredUser.GetValue();
+  return true;
 }
 
-void FModioSubsystem::GetAllModfiles(int32 ModId, FModioModfileArrayDelegate GetAllModfilesDelegate)
+void FModioSubsystem::LoadModCatalogStore()
 {
-  FModioAsyncRequest_GetAllModfiles *Request = CreateAsyncRequest<FModioAsyncRequest_GetAllModfiles>( this, GetAllModfilesDelegate );
-  
-  ModioFilterCreator LocalModioFilterCreator;
-  modioInitFilter(&LocalModioFilterCreator);
+  if( !bKeepModCatalog || !bStoreModCatalog || bModCatalogStoreLoaded || !bInitialized || !IsInGameThread() )
+  {
+    return;
+  }
+  bModCatalogStoreLoaded = true;
 
-  modioGetAllModfiles( Request, ModId, LocalModioFilterCreator, FModioAsyncRequest_GetAllModfiles::Response );
+  double StartTime = FPlatformTime::Seconds();
+  TUniquePtr<FModioBinaryStoreReader> Reader = FModioBinaryStoreReader::Open( ModCatalogStorePath, StoreGameId );
+  if( !Reader.IsValid() )
+  {
+    return;
+  }
+
+  // Tag options go first, the catalog's tag index is built from them
+  Reader->ReadTagOptions( CatalogTagOptions );
+  ModCatalog.RegisterTagOptions( CatalogTagOptions );
+
+  // Mods received since startup are newer than the stored ones
+  TArray<FModioMod> Mods;
+  Mods.Reserve( Reader->NumMods() );
+  for( int32 i = 0; i < Reader->NumMods(); i++ )
+  {
+    if( ModCatalog.FindIndex( Reader->GetModId( i ) ) == INDEX_NONE )
+    {
+      Reader->ReadMod( i, Mods.AddDefaulted_GetRef() );
+    }
+  }
+  ModCatalog.AddOrUpdate( Mods );
+  UpdateModCatalogStats();
+
+  FModioUser User;
+  if( Reader->ReadUser( User ) )
+  {
+    StoredUser = MoveTemp( User );
+  }
+
+  UE_LOG( LogModio, Log, TEXT( "Read %d mods from the mod catalog store in %.2f ms" ), Mods.Num(), ( FPlatformTime::Seconds() - StartTime ) * 1000.0 );
 }
 
-void FModioSubsystem::DownloadSubscribedModfiles(bool UninstallUnsubscribed, FModioBooleanDelegate DownloadSubscribedModfilesDelegate)
+const FModioModCatalog &FModioSubsystem::GetModCatalog() const
 {
-  FModioAsyncRequest_DownloadSubscribedModfiles *Request = CreateAsyncRequest<FModioAsyncRequest_DownloadSubscribedModfiles>( this, DownloadSubscribedModfilesDelegate );
-  modioDownloadSubscribedModfiles(Request, UninstallUnsubscribed, FModioAsyncRequest_DownloadSubscribedModfiles::Response);
+  check( IsInGameThread() );
+  return ModCatalog;
 }
 
-bool FModioSubsystem::UninstallMod(int32 ModId)
+void FModioSubsystem::NotifyModsReceived(TArrayView<const FModioMod> Mods)
+{
+  check( IsInGameThread() );
+  if( bKeepModCatalog )
+  {
+    ModCatalog.AddOrUpdate( Mods );
+    UpdateModCatalogStats();
+  }
+}
+
+void FModioSubsystem::NotifyGameReceived(const FModioGame &Game)
 {
-  return modioUninstallMod((u32)ModId);
+  check( IsInGameThread() );
+  if( bKeepModCatalog )
+  {
+    CatalogTagOptions = Game.TagOptions;
+    ModCatalog.RegisterTagOptions( Game.TagOptions );
+  }
 }
 
-void FModioSubsystem::UninstallUnavailableMods(FModioGenericDelegate UninstallUnavailableModsDelegate)
+void FModioSubsystem::SetModCatalogComplete(bool bComplete)
 {
-  UE_LOG(LogTemp, Warning, TEXT("[mod.io] Uninstalling unavailable mods"));
-  int32 ResponseLimit = 100;
-  int32 PendingCalls = 1 + (this->GetAllInstalledMods().Num() / ResponseLimit);
-  UE_LOG(LogTemp, Warning, TEXT("[mod.io] A total of %i calls will be made to the mod.io API"), PendingCalls);
-  FModioAsyncRequest_UninstallUnavailableMods *Request = CreateAsyncRequest<FModioAsyncRequest_UninstallUnavailableMods>( this, UninstallUnavailableModsDelegate, PendingCalls );
+  check( IsInGameThread() );
+  ModCatalog.SetComplete( bKeepModCatalog && bComplete );
+}
 
-  ModioFilterCreator modio_filter_creator;
-  modioInitFilter(&modio_filter_creator);
-  int32 CurrentCallCount = 0;
-  TArray<int32> ModIds;
-  for(auto InstalledMod : this->GetAllInstalledMods())
+void FModioSubsystem::NotifyModEventsReceived(const TArray<FModioModEvent> &ModEvents)
+{
+  check( IsInGameThread() );
+
+  // Whatever happened to the mod, what we cached of it is stale
+  for( const FModioModEvent& ModEvent : ModEvents )
   {
-    ModIds.Push(InstalledMod.Mod.Id);
-    CurrentCallCount ++;
-    modioAddFilterInField(&modio_filter_creator, "id", toString(InstalledMod.Mod.Id).c_str());
-    if(CurrentCallCount % 100 == 0)
-    {
-      UE_LOG(LogTemp, Warning, TEXT("[mod.io] Calling modioGetAllMods"));
-      CurrentCallCount = 0;
-      modioGetAllMods(Request, modio_filter_creator, FModioAsyncRequest_UninstallUnavailableMods::Response);
+    InvalidateCachedResponses( ModEvent.ModId );
+  }
+
+  if( !bKeepModCatalog )
+  {
+    return;
+  }
 
-      modioFreeFilter(&modio_filter_creator);
-      modioInitFilter(&modio_filter_creator);
+  for( const FModioModEvent& ModEvent : ModEvents )
+  {
+    switch( ModEvent.EventType )
+    {
+    case MODIO_EVENT_MOD_UNAVAILABLE:
+    case MODIO_EVENT_MOD_DELETED:
+      ModCatalog.Remove( ModEvent.ModId );
+      break;
+    case MODIO_EVENT_MOD_EDITED:
+    case MODIO_EVENT_MODFILE_CHANGED:
+      // Refetch mods we have, the full response updates the catalog when it arrives
+      if( ModCatalog.FindIndex( ModEvent.ModId ) != INDEX_NONE )
+      {
+        GetMod( ModEvent.ModId, EModioModFields::All, FModioModDelegate() );
+      }
+      break;
+    default:
+      break;
     }
   }
-  if(CurrentCallCount > 0)
+  UpdateModCatalogStats();
+}
+
+/** Ids of the mods at the catalog indices */
+static TArray<int32> GetCatalogModIds(const FModioModCatalog &Catalog, const TArray<int32> &Indices)
+{
+  TArray<int32> ModIds;
+  ModIds.Reserve( Indices.Num() );
+  for( int32 Index : Indices )
   {
-    UE_LOG(LogTemp, Warning, TEXT("[mod.io] Calling final modioGetAllMods"));
-    modioGetAllMods(Request, modio_filter_creator, FModioAsyncRequest_UninstallUnavailableMods::Response);
-    modioFreeFilter(&modio_filter_creator);
+    ModIds.Add( Catalog.GetMod( Index ).Id );
   }
+  return ModIds;
 }
 
-void onModDownload(u32 response_code, u32 mod_id)
+TArray<int32> FModioSubsystem::GetModIdsByMetadata(const FString &Key, const FString &Value) const
 {
-  FModioSubsystem::ModioOnModDownloadDelegate.ExecuteIfBound( (int32)response_code, (int32)mod_id );
+  check( IsInGameThread() );
+  TArray<int32> Indices;
+  ModCatalog.FindByMetadata( Key, Value, Indices );
+  return GetCatalogModIds( ModCatalog, Indices );
 }
 
-void onModDownloadWithAutomaticInstalls(u32 response_code, u32 mod_id)
+TArray<int32> FModioSubsystem::GetModIdsByMetadataRange(const FString &Key, double Min, double Max) const
 {
-  modioInstallDownloadedMods();
-  FModioSubsystem::ModioOnModDownloadDelegate.ExecuteIfBound( (int32)response_code, (int32)mod_id );
+  check( IsInGameThread() );
+  TArray<int32> Indices;
+  ModCatalog.FindByMetadataRange( Key, Min, Max, Indices );
+  return GetCatalogModIds( ModCatalog, Indices );
 }
 
-void onModUpload(u32 response_code, u32 mod_id)
+void FModioSubsystem::SearchMods(const FString &Text, int32 Limit, FModioModSearchDelegate SearchDelegate)
 {
-  FModioSubsystem::ModioOnModUploadDelegate.ExecuteIfBound( (int32)response_code, (int32)mod_id );
+  check( IsInGameThread() );
+
+  if( bKeepModCatalog )
+  {
+    TArray<int32> Indices;
+    ModCatalog.Search( Text, Limit, Indices );
+
+    TArray<FModioMod> Mods;
+    Mods.Reserve( Indices.Num() );
+    for( int32 Index : Indices )
+    {
+      Mods.Add( ModCatalog.GetMod( Index ) );
+    }
+
+    FModioResponse Response;
+    Response.Code = 200;
+    Response.ResultCount = Mods.Num();
+    Response.ResultLimit = Limit;
+    Response.ResultOffset = 0;
+    Response.ResultTotal = Mods.Num();
+    Response.ResultCached = true;
+    SearchDelegate.ExecuteIfBound( Response, Mods, false );
+  }
+
+  FPendingSearch Search;
+  Search.Text = Text;
+  Search.Limit = Limit;
+  Search.Delegate = SearchDelegate;
+  Search.Time = FPlatformTime::Seconds();
+  PendingSearch = MoveTemp( Search );
 }
 
-void onModEvent(ModioResponse ModioResponse, ModioModEvent* ModioEventsArray, u32 ModioEventsArraySize)
+void FModioSubsystem::SetSearchDebounce(float Seconds)
 {
-  FModioResponse Response;
-  InitializeResponse( Response, ModioResponse );
-  FModioSubsystem::ModioOnModEventDelegate.ExecuteIfBound( Response, ConvertToTArrayModEvents(ModioEventsArray, ModioEventsArraySize) );
+  SearchDebounce = FMath::Max( Seconds, 0.0f );
 }
 
-void FModioSubsystem::Init( const FString& RootDirectory, uint32 GameId, const FString& ApiKey, bool bIsLiveEnvironment, bool bInstallOnModDownload, bool bRetrieveModsFromOtherGames, bool bEnablePolling)
+void FModioSubsystem::SetResponseCacheBudget(int64 Bytes)
 {
-  check(!bInitialized);
+  RunOnGameThread( [this, Bytes]()
+  {
+    ResponseCache.SetBudget( Bytes );
+  });
+}
 
-  u32 Environment = bIsLiveEnvironment ? MODIO_ENVIRONMENT_LIVE : MODIO_ENVIRONMENT_TEST;
+void FModioSubsystem::SetResponseCacheTimeToLive(FName Endpoint, float Seconds)
+{
+  RunOnGameThread( [this, Endpoint, Seconds]()
+  {
+    ResponseCache.SetTimeToLive( Endpoint, Seconds );
+  });
+}
 
-  modioInit( Environment, (u32)GameId, bRetrieveModsFromOtherGames, bEnablePolling, TCHAR_TO_UTF8(*ApiKey), TCHAR_TO_UTF8(*RootDirectory) );
+void FModioSubsystem::SetResponseCacheStaleTime(FName Endpoint, float Seconds)
+{
+  RunOnGameThread( [this, Endpoint, Seconds]()
+  {
+    ResponseCache.SetStaleTime( Endpoint, Seconds );
+  });
+}
 
-  if(bInstallOnModDownload)
-    modioSetDownloadListener(&onModDownloadWithAutomaticInstalls);
-  else
-    modioSetDownloadListener(&onModDownload);
-  
-  modioSetUploadListener(&onModUpload);
+const FModioResponseCacheStats &FModioSubsystem::GetResponseCacheStats() const
+{
+  check( IsInGameThread() );
+  return ResponseCache.GetStats();
+}
 
-  modioSetEventListener(&onModEvent);
+void FModioSubsystem::ClearResponseCache()
+{
+  RunOnGameThread( [this]()
+  {
+    ResponseCache.Reset();
+  });
+}
 
-  bInitialized = true;
+void FModioSubsystem::InvalidateCachedResponses(int32 ModId)
+{
+  RunOnGameThread( [this, ModId]()
+  {
+    ResponseCache.RemoveByPrefix( FString::Printf( TEXT("GetMod:%u:"), (uint32)ModId ) );
+    ResponseCache.Remove( FString::Printf( TEXT("GetAllModTags:%d"), ModId ) );
+    ResponseCache.Remove( FString::Printf( TEXT("GetAllModfiles:%d"), ModId ) );
+    ResponseCache.Remove( FString::Printf( TEXT("GetAllModDependencies:%d"), ModId ) );
+  });
 }
 
-void FModioSubsystem::QueueAsyncTask( struct FModioAsyncRequest* Request )
+void FModioSubsystem::FlushPendingSearch()
 {
-  checkf(Request, TEXT("Trying to queue up a invalid async request"));
-  TSharedPtr<FModioAsyncRequest> SharedRequest = MakeShareable(Request);
-  checkf(!AsyncRequests.Contains(SharedRequest), TEXT("Trying queue a async request twice"));
+  FPendingSearch Search = MoveTemp( PendingSearch.GetValue() );
+  PendingSearch.Reset();
 
-  AsyncRequests.Add(SharedRequest);
+  FModioFilterCreator FilterCreator;
+  FilterCreator.Sort.ModSortType = EModioModSortType::SORT_BY_POPULAR;
+  FilterCreator.Sort.Ascending = true;
+  FilterCreator.FullTextSearch = Search.Text;
+
+  FModioModSearchDelegate SearchDelegate = Search.Delegate;
+  FModioAsyncRequestHandle Handle = GetAllMods( FilterCreator, TArray<FString>(), Search.Limit, 0, EModioModFields::All,
+    FModioModArrayDelegate::CreateLambda( [SearchDelegate]( FModioResponse Response, const TArray<FModioMod> &Mods )
+    {
+      SearchDelegate.ExecuteIfBound( Response, Mods, true );
+    }));
+
+  // Only the latest search gets delivered
+  AssignQuerySlot( TEXT( "SearchMods" ), Handle );
 }
 
-void FModioSubsystem::AsyncRequestDone( struct FModioAsyncRequest *Request )
+void FModioSubsystem::UpdateModCatalogStats()
 {
-  checkf(Request, TEXT("Passing in a bad request to AsyncRequestDone"));
-  checkf(AsyncRequests.Contains(Request->AsShared()), TEXT("Async Request marking itself as done multiple times"));
+  SET_MEMORY_STAT( STAT_ModioSearchIndexMemory, ModCatalog.GetSearchIndexSize() );
+}
+
+bool FModioSubsystem::QueryModCatalog(const FModioModCatalogFilter &Filter, EModioModSortType SortType, bool bAscending, TArray<FModioMod> &OutMods) const
+{
+  check( IsInGameThread() );
+  if( !ModCatalog.IsComplete() )
+  {
+    return false;
+  }
+
+  TArray<int32> Indices;
+  ModCatalog.Filter( Filter, Indices );
+  ModCatalog.Sort( Indices, SortType, bAscending );
+
+  OutMods.Reset( Indices.Num() );
+  for( int32 Index : Indices )
+  {
+    OutMods.Add( ModCatalog.GetMod( Index ) );
+  }
+  return true;
+}
+
+void FModioSubsystem::SetRequestLimit( TEnumAsByte<EModioRequestPriority> Priority, int32 Limit )
+{
+  if( Priority < EModioRequestPriority::PRIORITY_MAX )
+  {
+    RequestLimits[Priority] = FMath::Max( Limit, 0 );
+    AdmitQueuedRequests();
+  }
+}
+
+int32 FModioSubsystem::GetNumQueuedRequests( TEnumAsByte<EModioRequestPriority> Priority ) const
+{
+  return Priority < EModioRequestPriority::PRIORITY_MAX ? QueuedRequests[Priority].Num() : 0;
+}
+
+EModioRequestPriority FModioSubsystem::GetRequestPriority( EModioRequestPriority DefaultPriority ) const
+{
+  return PriorityOverride != EModioRequestPriority::PRIORITY_MAX ? PriorityOverride : DefaultPriority;
+}
+
+bool FModioSubsystem::CanAdmitRequest( EModioRequestPriority Priority ) const
+{
+  if( RequestLimits[Priority] > 0 && NumRequestsInFlight[Priority] >= RequestLimits[Priority] )
+  {
+    return false;
+  }
+
+  // Background work never goes ahead of interactive requests waiting for a slot
+  return Priority != EModioRequestPriority::BACKGROUND || QueuedRequests[EModioRequestPriority::INTERACTIVE].Num() == 0;
+}
+
+void FModioSubsystem::IssueRequest( FModioAsyncRequest* Request, TFunction<void()> Issue, EModioRequestPriority DefaultPriority )
+{
+  EModioRequestPriority Priority = GetRequestPriority( DefaultPriority );
+  Request->Priority = Priority;
+
+  if( QueuedRequests[Priority].Num() == 0 && CanAdmitRequest( Priority ) )
+  {
+    Request->bHoldsSlot = true;
+    NumRequestsInFlight[Priority]++;
+    Request->Timings.IssueTime = FPlatformTime::Seconds();
+    Issue();
+    return;
+  }
+
+  QueuedRequests[Priority].Add( FQueuedRequest{ Request->GetHandle(), MoveTemp( Issue ) } );
+}
+
+void FModioSubsystem::AdmitQueuedRequests()
+{
+  // Requests can finish while being issued, the outer call keeps admitting
+  if( bAdmittingRequests )
+  {
+    return;
+  }
+  TGuardValue<bool> AdmittingGuard( bAdmittingRequests, true );
+  FScopeLock SdkLock( &SdkCriticalSection );
+
+  for( int32 Priority = 0; Priority < EModioRequestPriority::PRIORITY_MAX; Priority++ )
+  {
+    FRequestQueue& Queue = QueuedRequests[Priority];
+    while( Queue.Num() && CanAdmitRequest( (EModioRequestPriority)Priority ) )
+    {
+      FQueuedRequest Queued = Queue.Pop();
+
+      // Requests cancelled while waiting are finished here instead of being sent
+      FModioAsyncRequest* Request = AsyncRequests.Find( Queued.Request );
+      if( !Request || Request->FinishIfCancelled() )
+      {
+        continue;
+      }
+
+      Request->bHoldsSlot = true;
+      NumRequestsInFlight[Priority]++;
+      Request->Timings.IssueTime = FPlatformTime::Seconds();
+      Queued.Issue();
+    }
+  }
+}
+
+FModioAsyncRequest* FModioSubsystem::FindAsyncRequest( const FModioAsyncRequestHandle &Handle ) const
+{
+  return AsyncRequests.Find(Handle);
+}
 
-  AsyncRequests.RemoveSwap(Request->AsShared());
+void FModioSubsystem::StopCoalescing( struct FModioAsyncRequest *Request )
+{
+  if( Request->CoalesceKey.Len() )
+  {
+    const FModioAsyncRequestHandle* LeaderHandle = InFlightReads.Find(Request->CoalesceKey);
+    if( LeaderHandle && *LeaderHandle == Request->Handle )
+    {
+      InFlightReads.Remove(Request->CoalesceKey);
+    }
+    Request->CoalesceKey.Empty();
+  }
 }
 
 void FModioSubsystem::Shutdown()
 {
   check(bInitialized);
 
-  modioShutdown();
+  StopProcessWorker();
+
+  // Responses deferred by the dispatch budget still have to reach the callers
+  RunQueuedConversions();
+  DispatchScheduler.DispatchAll();
+
+  // Nothing will answer the batched calls once modio is shut down
+  PendingGetModBatch.Reset();
+
+  if( bKeepModCatalog && bStoreModCatalog )
+  {
+    SaveModCatalogStore();
+  }
+  StoredUser.Reset();
+
+  // The next session can be for another game
+  ResponseCache.Reset();
+  for( FRequestQueue& Queue : QueuedRequests )
+  {
+    Queue.Reset();
+  }
+
+  {
+    FScopeLock SdkLock( &SdkCriticalSection );
+
+    modioShutdown();
 
-  // I would assume that nullptr is valid to stop the callbacks comming in
-  modioSetDownloadListener(nullptr);
-  modioSetUploadListener(nullptr);
+    // I would assume that nullptr is valid to stop the callbacks comming in
+    modioSetDownloadListener(nullptr);
+    modioSetUploadListener(nullptr);
+  }
+
+  if( ListenerSubsystem == this )
+  {
+    ListenerSubsystem = nullptr;
+  }
 
+  // Left to static teardown the blocks would be freed after the allocator is gone
+  FModioAsyncRequestPools::ReleaseAll();
   bInitialized = false;
+}
+
+void FModioSubsystem::StartProcessWorker()
+{
+  if( !ProcessWorker.IsValid() )
+  {
+    ProcessWorker = MakeUnique<FModioProcessWorker>( [this]()
+    {
+      ProcessSdk();
+    });
+  }
+}
+
+void FModioSubsystem::StopProcessWorker()
+{
+  if( ProcessWorker.IsValid() )
+  {
+    ProcessWorker.Reset();
+
+    // Whatever the worker processed still has to reach the callers
+    RunQueuedConversions();
+    DispatchScheduler.DispatchAll();
+  }
+}
+
+void FModioSubsystem::ProcessSdk()
+{
+  {
+    FScopeLock SdkLock( &SdkCriticalSection );
+    modioProcess();
+  }
+  RunQueuedConversions();
+}
+
+void FModioSubsystem::QueueConversion( TFunction<void()> Convert )
+{
+  QueuedConversions.Add( MoveTemp( Convert ) );
+}
+
+void FModioSubsystem::RunQueuedConversions()
+{
+  TArray<TFunction<void()>> Conversions;
+  {
+    FScopeLock SdkLock( &SdkCriticalSection );
+    Conversions = MoveTemp( QueuedConversions );
+  }
+  for( TFunction<void()>& Convert : Conversions )
+  {
+    Convert();
+  }
+}
+
+void FModioSubsystem::DeliverResponse( FModioAsyncRequest *Request, TFunction<void()> Dispatch )
+{
+  FModioAsyncRequestHandle Handle = Request->GetHandle();
+  if( IsInGameThread() && !DispatchScheduler.IsBudgeted() )
+  {
+    RunRequestDispatch( Handle, Dispatch );
+  }
+  else
+  {
+    DispatchScheduler.Enqueue( [this, Handle, Dispatch = MoveTemp( Dispatch )]()
+    {
+      RunRequestDispatch( Handle, Dispatch );
+    });
+  }
+}
+
+void FModioSubsystem::RunOnGameThread( TFunction<void()> Task )
+{
+  if( IsInGameThread() )
+  {
+    Task();
+  }
+  else
+  {
+    DispatchScheduler.Enqueue( MoveTemp( Task ) );
+  }
+}
+
+void FModioSubsystem::RunRequestDispatch( const FModioAsyncRequestHandle &Handle, const TFunction<void()> &Dispatch )
+{
+  FModioAsyncRequest* Request = AsyncRequests.Find( Handle );
+  if( !Request || Request->FinishIfCancelled() )
+  {
+    return;
+  }
+
+  double DispatchStart = FPlatformTime::Seconds();
+  if( Dispatch )
+  {
+    Dispatch();
+  }
+  RequestMetrics.Record( Request->GetTimings(), DispatchStart, FPlatformTime::Seconds() );
+  Request->Done();
 }
\ No newline at end of file
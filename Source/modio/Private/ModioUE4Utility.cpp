@@ -3,100 +3,47 @@
 
 #include "ModioUE4Utility.h"
 
-TArray<FModioMod> ConvertToTArrayMods(ModioMod* ModioMods, u32 ModsSize)
+TArray<FModioMod> ConvertToTArrayMods(ModioMod* ModioMods, u32 ModsSize, EModioModFields Fields)
 {
-  TArray<FModioMod> Mods;
-  for (u32 i = 0; i < ModsSize; i++)
+  return ConvertModioArray<FModioMod>(ModioMods, ModsSize, [Fields](FModioMod& Mod, const ModioMod& modio_mod)
   {
-    FModioMod Mod;
-    InitializeMod(Mod, ModioMods[i]);
-    Mods.Add(Mod);
-  }
-  return Mods;
+    InitializeMod(Mod, modio_mod, Fields);
+  });
 }
 
 TArray<FModioModfile> ConvertToTArrayModfiles(ModioModfile* ModioModfiles, u32 ModfilesSize)
 {
-  TArray<FModioModfile> Modfiles;
-  for (u32 i = 0; i < ModfilesSize; i++)
-  {
-    FModioModfile Modfile;
-    InitializeModfile(Modfile, ModioModfiles[i]);
-    Modfiles.Add(Modfile);
-  }
-  return Modfiles;
+  return ConvertModioArray<FModioModfile>(ModioModfiles, ModfilesSize, &InitializeModfile);
 }
 
 TArray<FModioRating> ConvertToTArrayRatings(ModioRating* ModioRatings, u32 RatingsSize)
 {
-  TArray<FModioRating> Ratings;
-  for (u32 i = 0; i < RatingsSize; i++)
-  {
-    FModioRating Rating;
-    InitializeRating(Rating, ModioRatings[i]);
-    Ratings.Add(Rating);
-  }
-  return Ratings;
+  return ConvertModioArray<FModioRating>(ModioRatings, RatingsSize, &InitializeRating);
 }
 
 TArray<FModioModDependency> ConvertToTArrayModDependencies(ModioDependency* ModioDependencies, u32 DependenciesSize)
 {
-  TArray<FModioModDependency> ModDependencies;
-  for (u32 i = 0; i < DependenciesSize; i++)
-  {
-    FModioModDependency ModDependency;
-    InitializeModDependency(ModDependency, ModioDependencies[i]);
-    ModDependencies.Add(ModDependency);
-  }
-  return ModDependencies;
+  return ConvertModioArray<FModioModDependency>(ModioDependencies, DependenciesSize, &InitializeModDependency);
 }
 
 TArray<FModioModTag> ConvertToTArrayModTags(ModioTag* ModioTags, u32 TagsSize)
 {
-  TArray<FModioModTag> ModTags;
-  for (u32 i = 0; i < TagsSize; i++)
-  {
-    FModioModTag ModTag;
-    InitializeModTag(ModTag, ModioTags[i]);
-    ModTags.Add(ModTag);
-  }
-  return ModTags;
+  return ConvertModioArray<FModioModTag>(ModioTags, TagsSize, &InitializeModTag);
 }
 
 TArray<FModioMetadataKVP> ConvertToTArrayMetadataKVP(ModioMetadataKVP* ModioMetadataKVP, u32 MetadataKVPize)
 {
-  TArray<FModioMetadataKVP> TArray_MetadataKVP;
-  for (u32 i = 0; i < MetadataKVPize; i++)
-  {
-    FModioMetadataKVP MetadataKVP;
-    InitializeMetadataKVP(MetadataKVP, ModioMetadataKVP[i]);
-    TArray_MetadataKVP.Add(MetadataKVP);
-  }
-  return TArray_MetadataKVP;
+  return ConvertModioArray<FModioMetadataKVP>(ModioMetadataKVP, MetadataKVPize, &InitializeMetadataKVP);
 }
 
 TArray<FModioUserEvent> ConvertToTArrayUserEvents(ModioUserEvent* ModioUserEvents, u32 UserEventsSize)
 {
-  TArray<FModioUserEvent> UserEvents;
-  for (u32 i = 0; i < UserEventsSize; i++)
-  {
-    FModioUserEvent UserEvent;
-    InitializeUserEvent(UserEvent, ModioUserEvents[i]);
-    UserEvents.Add(UserEvent);
-  }
-  return UserEvents;
+  return ConvertModioArray<FModioUserEvent>(ModioUserEvents, UserEventsSize, &InitializeUserEvent);
 }
 
 TArray<FModioModEvent> ConvertToTArrayModEvents(ModioModEvent* ModioModEvents, u32 ModEventsSize)
 {
-  TArray<FModioModEvent> ModEvents;
-  for (u32 i = 0; i < ModEventsSize; i++)
-  {
-    FModioModEvent ModEvent;
-    InitializeModEvent(ModEvent, ModioModEvents[i]);
-    ModEvents.Add(ModEvent);
-  }
-  return ModEvents;
+  return ConvertModioArray<FModioModEvent>(ModioModEvents, ModEventsSize, &InitializeModEvent);
 }
 
 TEnumAsByte<EModioModState> ConvertToModState(u32 ModioModState)
@@ -155,39 +102,37 @@ void SetupModioFilterPagination(int32 Limit, int32 Offset, ModioFilterCreator& m
   modioSetFilterOffset(&modio_filter_creator, (u32)Offset);
 }
 
-void SetupModSortingFilter(TEnumAsByte<EModioModSortType> ModSortType, ModioFilterCreator& modio_filter_creator, bool IsAscending)
+const char* GetModSortField(TEnumAsByte<EModioModSortType> ModSortType)
 {
   switch (ModSortType)
   {
-  case EModioModSortType::SORT_BY_ID:
-    break;
   case EModioModSortType::SORT_BY_DATE_ADDED:
-    modioSetFilterSort(&modio_filter_creator, (char *)"date_added", IsAscending);
-    break;
+    return "date_added";
   case EModioModSortType::SORT_BY_DATE_UPDATED:
-    modioSetFilterSort(&modio_filter_creator, (char *)"date_updated", IsAscending);
-    break;
+    return "date_updated";
   case EModioModSortType::SORT_BY_DATE_LIVE:
-    modioSetFilterSort(&modio_filter_creator, (char *)"date_live", IsAscending);
-    break;
+    return "date_live";
   case EModioModSortType::SORT_BY_NAME:
-    modioSetFilterSort(&modio_filter_creator, (char *)"name", IsAscending);
-    break;
+    return "name";
   case EModioModSortType::SORT_BY_DOWNLOADS:
-    modioSetFilterSort(&modio_filter_creator, (char *)"downloads", IsAscending);
-    break;
+    return "downloads";
   case EModioModSortType::SORT_BY_POPULAR:
-    modioSetFilterSort(&modio_filter_creator, (char *)"popular", IsAscending);
-    break;
+    return "popular";
   case EModioModSortType::SORT_BY_RATING:
-    modioSetFilterSort(&modio_filter_creator, (char *)"rating", IsAscending);
-    break;
+    return "rating";
   case EModioModSortType::SORT_BY_SUBSCRIBERS:
-    modioSetFilterSort(&modio_filter_creator, (char *)"subscribers", IsAscending);
-    break;
+    return "subscribers";
   default:
-    // @todo: handle error
-    break;
+    // SORT_BY_ID is what the backend does without a sort
+    return nullptr;
+  }
+}
+
+void SetupModSortingFilter(TEnumAsByte<EModioModSortType> ModSortType, ModioFilterCreator& modio_filter_creator, bool IsAscending)
+{
+  if (const char* SortField = GetModSortField(ModSortType))
+  {
+    modioSetFilterSort(&modio_filter_creator, SortField, IsAscending);
   }
 }
 
@@ -195,6 +140,7 @@ void SetupModioModFilterCreator(const FModioFilterCreator &FilterCreator, const
 {
   modioSetFilterLimit(&modio_filter_creator, (u32)Limit);
   modioSetFilterOffset(&modio_filter_creator, (u32)Offset);
+  modioSetFilterCacheMaxAgeSeconds(&modio_filter_creator, (u32)FMath::Max(FilterCreator.CacheMaxAgeSeconds, 0));
 
   for (int i = 0; i < ModTags.Num(); i++)
     modioAddFilterInField(&modio_filter_creator, "tags", TCHAR_TO_UTF8(*ModTags[i]) );
@@ -331,6 +277,43 @@ void SetupModioModfileCreator(FModioModfileCreator ModfileCreator, ModioModfileC
     modioSetModfileCreatorFilehash(&modio_modfile_creator, TCHAR_TO_UTF8(*ModfileCreator.Filehash));
 }
 
+FModioUtf8StringArray::FModioUtf8StringArray(const TArray<FString> &Strings)
+{
+  Offsets.Reserve(Strings.Num());
+  for (const FString& String : Strings)
+  {
+    Add(*String);
+  }
+  Finish();
+}
+
+FModioUtf8StringArray::FModioUtf8StringArray(const TMap<FString, FString> &MetadataKVP)
+{
+  Offsets.Reserve(MetadataKVP.Num());
+  for (const TPair<FString, FString>& Pair : MetadataKVP)
+  {
+    Add(*(Pair.Key + TEXT(":") + Pair.Value));
+  }
+  Finish();
+}
+
+void FModioUtf8StringArray::Add(const TCHAR* String)
+{
+  FTCHARToUTF8 Converted(String);
+  Offsets.Add(Buffer.Num());
+  Buffer.Append((const ANSICHAR*)Converted.Get(), Converted.Length());
+  Buffer.Add('\0');
+}
+
+void FModioUtf8StringArray::Finish()
+{
+  Pointers.Reserve(Offsets.Num());
+  for (int32 Offset : Offsets)
+  {
+    Pointers.Add(Buffer.GetData() + Offset);
+  }
+}
+
 std::string toString(int32 number)
 {
   if (number == 0)
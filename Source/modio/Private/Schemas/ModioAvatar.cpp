@@ -2,11 +2,12 @@
 // Released under MIT.
 
 #include "Schemas/ModioAvatar.h"
+#include "ModioStringConversion.h"
 
 void InitializeAvatar(FModioAvatar &Avatar, const ModioAvatar &modio_avatar)
 {
-  Avatar.Filename = UTF8_TO_TCHAR(modio_avatar.filename);
-  Avatar.Original = UTF8_TO_TCHAR(modio_avatar.original);
-  Avatar.Thumb50x50 = UTF8_TO_TCHAR(modio_avatar.thumb_50x50);
-  Avatar.Thumb100x100 = UTF8_TO_TCHAR(modio_avatar.thumb_100x100);
+  ModioUtf8ToString(Avatar.Filename, modio_avatar.filename);
+  ModioUtf8ToString(Avatar.Original, modio_avatar.original);
+  ModioUtf8ToString(Avatar.Thumb50x50, modio_avatar.thumb_50x50);
+  ModioUtf8ToString(Avatar.Thumb100x100, modio_avatar.thumb_100x100);
 }
\ No newline at end of file
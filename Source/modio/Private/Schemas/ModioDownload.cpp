@@ -2,9 +2,10 @@
 // Released under MIT.
 
 #include "Schemas/ModioDownload.h"
+#include "ModioStringConversion.h"
 
 void InitializeDownload(FModioDownload &Download, const ModioDownload &modio_download)
 {
   Download.DateExpires = modio_download.date_expires;
-  Download.BinaryUrl = UTF8_TO_TCHAR(modio_download.binary_url);
+  ModioUtf8ToString(Download.BinaryUrl, modio_download.binary_url);
 }
\ No newline at end of file
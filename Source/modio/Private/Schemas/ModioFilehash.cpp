@@ -2,8 +2,9 @@
 // Released under MIT.
 
 #include "Schemas/ModioFilehash.h"
+#include "ModioStringConversion.h"
 
 void InitializeFilehash(FModioFilehash &Filehash, const ModioFilehash &modio_filehash)
 {
-  Filehash.Md5 = UTF8_TO_TCHAR(modio_filehash.md5);
+  ModioUtf8ToString(Filehash.Md5, modio_filehash.md5);
 }
\ No newline at end of file
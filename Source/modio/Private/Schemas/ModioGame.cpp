@@ -1,4 +1,5 @@
 #include "Schemas/ModioGame.h"
+#include "ModioStringConversion.h"
 
 #include "Schemas/ModioLogo.h"
 #include "Schemas/ModioUser.h"
@@ -38,20 +39,20 @@ void InitializeGame(FModioGame& game, const ModioGame& modio_game)
       InitializeGameTagOption(game.TagOptions[i], modio_game.game_tag_option_array[i]);
     }
   }
-  game.UGCName = UTF8_TO_TCHAR(modio_game.ugc_name);
+  ModioUtf8ToString(game.UGCName, modio_game.ugc_name);
 }
 
 void InitializeHeaderImage(FModioHeaderImage& headerImage, const ModioHeader& modio_header_image)
 {
-  headerImage.Filename = UTF8_TO_TCHAR(modio_header_image.filename);
-  headerImage.Original = UTF8_TO_TCHAR(modio_header_image.original);
+  ModioUtf8ToString(headerImage.Filename, modio_header_image.filename);
+  ModioUtf8ToString(headerImage.Original, modio_header_image.original);
 }
 
 void InitializeIcon(FModioIcon& icon, const ModioIcon& modio_icon)
 {
-  icon.Filename = UTF8_TO_TCHAR(modio_icon.filename);
-  icon.Original = UTF8_TO_TCHAR(modio_icon.original);
-  icon.Thumb64x64 = UTF8_TO_TCHAR(modio_icon.thumb_64x64);
-  icon.Thumb128x128 = UTF8_TO_TCHAR(modio_icon.thumb_128x128);
-  icon.Thumb256x256 = UTF8_TO_TCHAR(modio_icon.thumb_256x256);
+  ModioUtf8ToString(icon.Filename, modio_icon.filename);
+  ModioUtf8ToString(icon.Original, modio_icon.original);
+  ModioUtf8ToString(icon.Thumb64x64, modio_icon.thumb_64x64);
+  ModioUtf8ToString(icon.Thumb128x128, modio_icon.thumb_128x128);
+  ModioUtf8ToString(icon.Thumb256x256, modio_icon.thumb_256x256);
 }
\ No newline at end of file
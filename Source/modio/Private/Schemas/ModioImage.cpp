@@ -2,10 +2,11 @@
 // Released under MIT.
 
 #include "Schemas/ModioImage.h"
+#include "ModioStringConversion.h"
 
 void InitializeImage(FModioImage &Image, const ModioImage &modio_image)
 {
-  Image.Filename = UTF8_TO_TCHAR(modio_image.filename);
-  Image.Original = UTF8_TO_TCHAR(modio_image.original);
-  Image.Thumb320x180 = UTF8_TO_TCHAR(modio_image.thumb_320x180);
+  ModioUtf8ToString(Image.Filename, modio_image.filename);
+  ModioUtf8ToString(Image.Original, modio_image.original);
+  ModioUtf8ToString(Image.Thumb320x180, modio_image.thumb_320x180);
 }
\ No newline at end of file
@@ -2,9 +2,10 @@
 // Released under MIT.
 
 #include "Schemas/ModioInstalledMod.h"
+#include "ModioStringConversion.h"
 
 void InitializeInstalledMod(FModioInstalledMod &installed_mod, const ModioInstalledMod &modio_installed_mod)
 {
-  installed_mod.Path = UTF8_TO_TCHAR(modio_installed_mod.path);
+  ModioUtf8ToString(installed_mod.Path, modio_installed_mod.path);
   InitializeMod(installed_mod.Mod, modio_installed_mod.mod);
 }
\ No newline at end of file
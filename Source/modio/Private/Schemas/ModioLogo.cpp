@@ -2,12 +2,13 @@
 // Released under MIT.
 
 #include "Schemas/ModioLogo.h"
+#include "ModioStringConversion.h"
 
 void InitializeLogo(FModioLogo &Logo, const ModioLogo &modio_logo)
 {
-  Logo.Filename = UTF8_TO_TCHAR(modio_logo.filename);
-  Logo.Original = UTF8_TO_TCHAR(modio_logo.original);
-  Logo.Thumb320x180 = UTF8_TO_TCHAR(modio_logo.thumb_320x180);
-  Logo.Thumb640x360 = UTF8_TO_TCHAR(modio_logo.thumb_640x360);
-  Logo.Thumb1280x720 = UTF8_TO_TCHAR(modio_logo.thumb_1280x720);
+  ModioUtf8ToString(Logo.Filename, modio_logo.filename);
+  ModioUtf8ToString(Logo.Original, modio_logo.original);
+  ModioUtf8ToString(Logo.Thumb320x180, modio_logo.thumb_320x180);
+  ModioUtf8ToString(Logo.Thumb640x360, modio_logo.thumb_640x360);
+  ModioUtf8ToString(Logo.Thumb1280x720, modio_logo.thumb_1280x720);
 }
\ No newline at end of file
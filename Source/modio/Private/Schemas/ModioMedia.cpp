@@ -2,17 +2,19 @@
 // Released under MIT.
 
 #include "Schemas/ModioMedia.h"
+#include "ModioStringConversion.h"
 
 void InitializeMedia(FModioMedia &media, const ModioMedia &modio_media)
 {
+  media.Youtube.Reserve(media.Youtube.Num() + modio_media.youtube_size);
+  media.Sketchfab.Reserve(media.Sketchfab.Num() + modio_media.sketchfab_size);
+  media.Images.Reserve(media.Images.Num() + modio_media.images_size);
   for (u32 i = 0; i < modio_media.youtube_size; i++)
-    media.Youtube.Add(UTF8_TO_TCHAR(modio_media.youtube_array[i]));
+    ModioUtf8ToString(media.Youtube.AddDefaulted_GetRef(), modio_media.youtube_array[i]);
   for (u32 i = 0; i < modio_media.sketchfab_size; i++)
-    media.Sketchfab.Add(UTF8_TO_TCHAR(modio_media.sketchfab_array[i]));
+    ModioUtf8ToString(media.Sketchfab.AddDefaulted_GetRef(), modio_media.sketchfab_array[i]);
   for (u32 i = 0; i < modio_media.images_size; i++)
   {
-    FModioImage image;
-    InitializeImage(image, modio_media.images_array[i]);
-    media.Images.Add(image);
+    InitializeImage(media.Images.AddDefaulted_GetRef(), modio_media.images_array[i]);
   }
 }
\ No newline at end of file
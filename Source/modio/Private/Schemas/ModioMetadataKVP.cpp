@@ -2,9 +2,10 @@
 // Released under MIT.
 
 #include "Schemas/ModioMetadataKVP.h"
+#include "ModioStringConversion.h"
 
 void InitializeMetadataKVP(FModioMetadataKVP &MetadataKVP, const ModioMetadataKVP &modio_metadata_kvp)
 {
-  MetadataKVP.Metakey = UTF8_TO_TCHAR(modio_metadata_kvp.metakey);
-  MetadataKVP.Metavalue = UTF8_TO_TCHAR(modio_metadata_kvp.metavalue);
+  ModioUtf8ToString(MetadataKVP.Metakey, modio_metadata_kvp.metakey);
+  ModioUtf8ToString(MetadataKVP.Metavalue, modio_metadata_kvp.metavalue);
 }
\ No newline at end of file
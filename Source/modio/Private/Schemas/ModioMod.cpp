@@ -2,8 +2,9 @@
 // Released under MIT.
 
 #include "Schemas/ModioMod.h"
+#include "ModioStringConversion.h"
 
-void InitializeMod(FModioMod &mod, const ModioMod &modio_mod)
+void InitializeMod(FModioMod &mod, const ModioMod &modio_mod, EModioModFields Fields)
 {
   mod.Id = modio_mod.id;
   mod.GameId = modio_mod.game_id;
@@ -13,31 +14,60 @@ void InitializeMod(FModioMod &mod, const ModioMod &modio_mod)
   mod.DateAdded = modio_mod.date_added;
   mod.DateUpdated = modio_mod.date_updated;
   mod.DateLive = modio_mod.date_live;
-  mod.HomepageUrl = UTF8_TO_TCHAR(modio_mod.homepage_url);
-  mod.Name = UTF8_TO_TCHAR(modio_mod.name);
-  mod.NameId = UTF8_TO_TCHAR(modio_mod.name_id);
-  mod.Summary = UTF8_TO_TCHAR(modio_mod.summary);
-  mod.Description = UTF8_TO_TCHAR(modio_mod.description);
-  mod.DescriptionPlainText = UTF8_TO_TCHAR(modio_mod.description_plaintext);
-  mod.MetadataBlob = UTF8_TO_TCHAR(modio_mod.metadata_blob);
-  mod.ProfileUrl = UTF8_TO_TCHAR(modio_mod.profile_url);
-  InitializeLogo(mod.Logo, modio_mod.logo);
-  InitializeUser(mod.SubmittedBy, modio_mod.submitted_by);
-  InitializeModfile(mod.Modfile, modio_mod.modfile);
-  InitializeMedia(mod.Media, modio_mod.media);
-  InitializeStats(mod.Stats, modio_mod.stats);
+  ModioUtf8ToString(mod.Name, modio_mod.name);
+  ModioUtf8ToString(mod.NameId, modio_mod.name_id);
 
-  for (u32 i = 0; i < modio_mod.tags_array_size; i++)
+  if (EnumHasAnyFlags(Fields, EModioModFields::Summary))
   {
-    FModioModTag tag;
-    InitializeModTag(tag, modio_mod.tags_array[i]);
-    mod.Tags.Add(tag);
+    ModioUtf8ToString(mod.Summary, modio_mod.summary);
+  }
+  if (EnumHasAnyFlags(Fields, EModioModFields::Description))
+  {
+    ModioUtf8ToString(mod.Description, modio_mod.description);
+    ModioUtf8ToString(mod.DescriptionPlainText, modio_mod.description_plaintext);
+  }
+  if (EnumHasAnyFlags(Fields, EModioModFields::Urls))
+  {
+    ModioUtf8ToString(mod.HomepageUrl, modio_mod.homepage_url);
+    ModioUtf8ToString(mod.ProfileUrl, modio_mod.profile_url);
+  }
+  if (EnumHasAnyFlags(Fields, EModioModFields::Logo))
+  {
+    InitializeLogo(mod.Logo, modio_mod.logo);
+  }
+  if (EnumHasAnyFlags(Fields, EModioModFields::SubmittedBy))
+  {
+    InitializeUser(mod.SubmittedBy, modio_mod.submitted_by);
+  }
+  if (EnumHasAnyFlags(Fields, EModioModFields::Modfile))
+  {
+    InitializeModfile(mod.Modfile, modio_mod.modfile);
+  }
+  if (EnumHasAnyFlags(Fields, EModioModFields::Media))
+  {
+    InitializeMedia(mod.Media, modio_mod.media);
+  }
+  if (EnumHasAnyFlags(Fields, EModioModFields::Stats))
+  {
+    InitializeStats(mod.Stats, modio_mod.stats);
+  }
+
+  if (EnumHasAnyFlags(Fields, EModioModFields::Tags))
+  {
+    mod.Tags.Reset(modio_mod.tags_array_size);
+    for (u32 i = 0; i < modio_mod.tags_array_size; i++)
+    {
+      InitializeModTag(mod.Tags.AddDefaulted_GetRef(), modio_mod.tags_array[i]);
+    }
   }
 
-  for (u32 i = 0; i < modio_mod.metadata_kvp_array_size; i++)
+  if (EnumHasAnyFlags(Fields, EModioModFields::Metadata))
   {
-    FModioMetadataKVP metadata_kvp;
-    InitializeMetadataKVP(metadata_kvp, modio_mod.metadata_kvp_array[i]);
-    mod.MetadataKVP.Add(metadata_kvp);
+    ModioUtf8ToString(mod.MetadataBlob, modio_mod.metadata_blob);
+    mod.MetadataKVP.Reset(modio_mod.metadata_kvp_array_size);
+    for (u32 i = 0; i < modio_mod.metadata_kvp_array_size; i++)
+    {
+      InitializeMetadataKVP(mod.MetadataKVP.AddDefaulted_GetRef(), modio_mod.metadata_kvp_array[i]);
+    }
   }
 }
\ No newline at end of file
@@ -2,9 +2,10 @@
 // Released under MIT.
 
 #include "Schemas/ModioModTag.h"
+#include "ModioStringConversion.h"
 
 void InitializeModTag(FModioModTag &Tag, const ModioTag &modio_tag)
 {
   Tag.DateAdded = modio_tag.date_added;
-  Tag.Name = UTF8_TO_TCHAR(modio_tag.name);
+  ModioUtf8ToString(Tag.Name, modio_tag.name);
 }
\ No newline at end of file
@@ -0,0 +1,245 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#include "Schemas/ModioModView.h"
+#include "ModioStringConversion.h"
+
+/** Text fields of a mod in EModioModViewString order */
+static void GetModStrings( const ModioMod& SourceMod, const char* (&OutStrings)[(int32)EModioModViewString::Count] )
+{
+  OutStrings[(int32)EModioModViewString::HomepageUrl] = SourceMod.homepage_url;
+  OutStrings[(int32)EModioModViewString::Name] = SourceMod.name;
+  OutStrings[(int32)EModioModViewString::NameId] = SourceMod.name_id;
+  OutStrings[(int32)EModioModViewString::Summary] = SourceMod.summary;
+  OutStrings[(int32)EModioModViewString::Description] = SourceMod.description;
+  OutStrings[(int32)EModioModViewString::DescriptionPlainText] = SourceMod.description_plaintext;
+  OutStrings[(int32)EModioModViewString::MetadataBlob] = SourceMod.metadata_blob;
+  OutStrings[(int32)EModioModViewString::ProfileUrl] = SourceMod.profile_url;
+  OutStrings[(int32)EModioModViewString::LogoFilename] = SourceMod.logo.filename;
+  OutStrings[(int32)EModioModViewString::LogoOriginal] = SourceMod.logo.original;
+  OutStrings[(int32)EModioModViewString::LogoThumb320x180] = SourceMod.logo.thumb_320x180;
+  OutStrings[(int32)EModioModViewString::LogoThumb640x360] = SourceMod.logo.thumb_640x360;
+  OutStrings[(int32)EModioModViewString::LogoThumb1280x720] = SourceMod.logo.thumb_1280x720;
+  OutStrings[(int32)EModioModViewString::SubmittedByUsername] = SourceMod.submitted_by.username;
+  OutStrings[(int32)EModioModViewString::SubmittedByNameId] = SourceMod.submitted_by.name_id;
+  OutStrings[(int32)EModioModViewString::SubmittedByProfileUrl] = SourceMod.submitted_by.profile_url;
+  OutStrings[(int32)EModioModViewString::RatingsDisplayText] = SourceMod.stats.ratings_display_text;
+}
+
+FModioModViewPage::FModioModViewPage( const ModioMod* ModioMods, u32 ModioModsSize )
+{
+  // Size everything up front, so the whole page takes a handful of allocations
+  int32 TextSize = 1;
+  int32 NumTags = 0;
+  for( u32 i = 0; i < ModioModsSize; i++ )
+  {
+    const char* Strings[NumStrings];
+    GetModStrings( ModioMods[i], Strings );
+    for( const char* String : Strings )
+    {
+      TextSize += String ? FCStringAnsi::Strlen( String ) + 1 : 0;
+    }
+    for( u32 j = 0; j < ModioMods[i].tags_array_size; j++ )
+    {
+      const char* TagName = ModioMods[i].tags_array[j].name;
+      TextSize += TagName ? FCStringAnsi::Strlen( TagName ) + 1 : 0;
+    }
+    NumTags += ModioMods[i].tags_array_size;
+  }
+
+  Text.Reserve( TextSize );
+  Tags.Reserve( NumTags );
+  Records.SetNumUninitialized( ModioModsSize );
+  Converted.SetNum( ModioModsSize * NumStrings );
+
+  // Offset 0 is the empty string every missing field points at
+  Text.Add( '\0' );
+
+  for( u32 i = 0; i < ModioModsSize; i++ )
+  {
+    const ModioMod& SourceMod = ModioMods[i];
+    FRecord& Record = Records[i];
+    Record.Id = SourceMod.id;
+    Record.GameId = SourceMod.game_id;
+    Record.Status = SourceMod.status;
+    Record.Visible = SourceMod.visible;
+    Record.MaturityOption = SourceMod.maturity_option;
+    Record.DateAdded = SourceMod.date_added;
+    Record.DateUpdated = SourceMod.date_updated;
+    Record.DateLive = SourceMod.date_live;
+    Record.SubmittedById = SourceMod.submitted_by.id;
+    Record.PopularityRankPosition = SourceMod.stats.popularity_rank_position;
+    Record.PopularityRankTotalMods = SourceMod.stats.popularity_rank_total_mods;
+    Record.DownloadsTotal = SourceMod.stats.downloads_total;
+    Record.SubscribersTotal = SourceMod.stats.subscribers_total;
+    Record.RatingsTotal = SourceMod.stats.ratings_total;
+    Record.RatingsPositive = SourceMod.stats.ratings_positive;
+    Record.RatingsNegative = SourceMod.stats.ratings_negative;
+    Record.RatingsPercentagePositive = SourceMod.stats.ratings_percentage_positive;
+    Record.StatsDateExpires = SourceMod.stats.date_expires;
+    Record.RatingsWeightedAggregate = SourceMod.stats.ratings_weighted_aggregate;
+
+    const char* Strings[NumStrings];
+    GetModStrings( SourceMod, Strings );
+    for( int32 Field = 0; Field < NumStrings; Field++ )
+    {
+      Record.Strings[Field] = AddString( Strings[Field] );
+    }
+
+    Record.FirstTag = Tags.Num();
+    Record.NumTags = SourceMod.tags_array_size;
+    for( u32 j = 0; j < SourceMod.tags_array_size; j++ )
+    {
+      FTagRecord& Tag = Tags.AddDefaulted_GetRef();
+      Tag.Name = AddString( SourceMod.tags_array[j].name );
+      Tag.DateAdded = SourceMod.tags_array[j].date_added;
+    }
+  }
+}
+
+int32 FModioModViewPage::AddString( const char* String )
+{
+  if( !String || !*String )
+  {
+    return 0;
+  }
+
+  int32 Offset = Text.Num();
+  Text.Append( String, FCStringAnsi::Strlen( String ) + 1 );
+  return Offset;
+}
+
+const FString& FModioModViewPage::GetString( int32 RecordIndex, EModioModViewString Field ) const
+{
+  TUniquePtr<FString>& Slot = Converted[RecordIndex * NumStrings + (int32)Field];
+  if( !Slot.IsValid() )
+  {
+    Slot = MakeUnique<FString>();
+    ModioUtf8ToString( *Slot, &Text[Records[RecordIndex].Strings[(int32)Field]] );
+  }
+  return *Slot;
+}
+
+FModioModView::FModioModView() :
+  Index( INDEX_NONE )
+{
+}
+
+FModioModView::FModioModView( const TSharedRef<const FModioModViewPage, ESPMode::ThreadSafe>& InPage, int32 InIndex ) :
+  Page( InPage ),
+  Index( InIndex )
+{
+  check( Index >= 0 && Index < InPage->Num() );
+}
+
+TArray<FModioModView> FModioModView::MakeViews( const ModioMod* ModioMods, u32 ModioModsSize )
+{
+  TSharedRef<const FModioModViewPage, ESPMode::ThreadSafe> Page = MakeShared<FModioModViewPage, ESPMode::ThreadSafe>( ModioMods, ModioModsSize );
+
+  TArray<FModioModView> Views;
+  Views.Reserve( Page->Num() );
+  for( int32 i = 0; i < Page->Num(); i++ )
+  {
+    Views.Emplace( Page, i );
+  }
+  return Views;
+}
+
+const FModioModViewPage::FRecord& FModioModView::GetRecord() const
+{
+  check( IsValid() );
+  return Page->Records[Index];
+}
+
+const FString& FModioModView::GetString( EModioModViewString Field ) const
+{
+  check( IsValid() && Field < EModioModViewString::Count );
+  return Page->GetString( Index, Field );
+}
+
+FModioStats FModioModView::GetStats() const
+{
+  const FModioModViewPage::FRecord& Record = GetRecord();
+
+  FModioStats Stats;
+  Stats.ModId = Record.Id;
+  Stats.PopularityRankPosition = Record.PopularityRankPosition;
+  Stats.PopularityRankTotalMods = Record.PopularityRankTotalMods;
+  Stats.DownloadsTotal = Record.DownloadsTotal;
+  Stats.SubscribersTotal = Record.SubscribersTotal;
+  Stats.RatingsTotal = Record.RatingsTotal;
+  Stats.RatingsPositive = Record.RatingsPositive;
+  Stats.RatingsNegative = Record.RatingsNegative;
+  Stats.RatingsPercentagePositive = Record.RatingsPercentagePositive;
+  Stats.RatingsWeightedAggregate = Record.RatingsWeightedAggregate;
+  Stats.DateExpires = Record.StatsDateExpires;
+  Stats.RatingsDisplayText = GetString( EModioModViewString::RatingsDisplayText );
+  return Stats;
+}
+
+FModioLogo FModioModView::GetLogo() const
+{
+  FModioLogo Logo;
+  Logo.Filename = GetString( EModioModViewString::LogoFilename );
+  Logo.Original = GetString( EModioModViewString::LogoOriginal );
+  Logo.Thumb320x180 = GetString( EModioModViewString::LogoThumb320x180 );
+  Logo.Thumb640x360 = GetString( EModioModViewString::LogoThumb640x360 );
+  Logo.Thumb1280x720 = GetString( EModioModViewString::LogoThumb1280x720 );
+  return Logo;
+}
+
+int32 FModioModView::GetNumTags() const
+{
+  return GetRecord().NumTags;
+}
+
+FString FModioModView::GetTag( int32 TagIndex ) const
+{
+  const FModioModViewPage::FRecord& Record = GetRecord();
+  check( TagIndex >= 0 && TagIndex < Record.NumTags );
+  FString Tag;
+  ModioUtf8ToString( Tag, &Page->Text[Page->Tags[Record.FirstTag + TagIndex].Name] );
+  return Tag;
+}
+
+int32 FModioModView::GetTagDateAdded( int32 TagIndex ) const
+{
+  const FModioModViewPage::FRecord& Record = GetRecord();
+  check( TagIndex >= 0 && TagIndex < Record.NumTags );
+  return Page->Tags[Record.FirstTag + TagIndex].DateAdded;
+}
+
+void FModioModView::ToMod( FModioMod& Mod ) const
+{
+  const FModioModViewPage::FRecord& Record = GetRecord();
+  Mod.Id = Record.Id;
+  Mod.GameId = Record.GameId;
+  Mod.Status = Record.Status;
+  Mod.Visible = Record.Visible;
+  Mod.MaturityOption = Record.MaturityOption;
+  Mod.DateAdded = Record.DateAdded;
+  Mod.DateUpdated = Record.DateUpdated;
+  Mod.DateLive = Record.DateLive;
+  Mod.HomepageUrl = GetString( EModioModViewString::HomepageUrl );
+  Mod.Name = GetString( EModioModViewString::Name );
+  Mod.NameId = GetString( EModioModViewString::NameId );
+  Mod.Summary = GetString( EModioModViewString::Summary );
+  Mod.Description = GetString( EModioModViewString::Description );
+  Mod.DescriptionPlainText = GetString( EModioModViewString::DescriptionPlainText );
+  Mod.MetadataBlob = GetString( EModioModViewString::MetadataBlob );
+  Mod.ProfileUrl = GetString( EModioModViewString::ProfileUrl );
+  Mod.Logo = GetLogo();
+  Mod.SubmittedBy.Id = Record.SubmittedById;
+  Mod.SubmittedBy.Username = GetString( EModioModViewString::SubmittedByUsername );
+  Mod.SubmittedBy.NameId = GetString( EModioModViewString::SubmittedByNameId );
+  Mod.SubmittedBy.ProfileUrl = GetString( EModioModViewString::SubmittedByProfileUrl );
+  Mod.Stats = GetStats();
+
+  Mod.Tags.Reset( Record.NumTags );
+  for( int32 i = 0; i < Record.NumTags; i++ )
+  {
+    FModioModTag& Tag = Mod.Tags.AddDefaulted_GetRef();
+    Tag.DateAdded = GetTagDateAdded( i );
+    Tag.Name = GetTag( i );
+  }
+}
@@ -2,6 +2,7 @@
 // Released under MIT.
 
 #include "Schemas/ModioModfile.h"
+#include "ModioStringConversion.h"
 
 void InitializeModfile(FModioModfile &Modfile, const ModioModfile &modio_modfile)
 {
@@ -12,11 +13,11 @@ void InitializeModfile(FModioModfile &Modfile, const ModioModfile &modio_modfile
   Modfile.DateAdded = modio_modfile.date_added;
   Modfile.DateScanned = modio_modfile.date_scanned;
   Modfile.Filesize = modio_modfile.filesize;
-  Modfile.Filename = UTF8_TO_TCHAR(modio_modfile.filename);
-  Modfile.Version = UTF8_TO_TCHAR(modio_modfile.version);
-  Modfile.VirustotalHash = UTF8_TO_TCHAR(modio_modfile.virustotal_hash);
-  Modfile.Changelog = UTF8_TO_TCHAR(modio_modfile.changelog);
-  Modfile.MetadataBlob = UTF8_TO_TCHAR(modio_modfile.metadata_blob);
+  ModioUtf8ToString(Modfile.Filename, modio_modfile.filename);
+  ModioUtf8ToString(Modfile.Version, modio_modfile.version);
+  ModioUtf8ToString(Modfile.VirustotalHash, modio_modfile.virustotal_hash);
+  ModioUtf8ToString(Modfile.Changelog, modio_modfile.changelog);
+  ModioUtf8ToString(Modfile.MetadataBlob, modio_modfile.metadata_blob);
   InitializeFilehash(Modfile.Filehash, modio_modfile.filehash);
   InitializeDownload(Modfile.Download, modio_modfile.download);
 }
\ No newline at end of file
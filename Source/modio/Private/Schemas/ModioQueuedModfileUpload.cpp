@@ -2,6 +2,7 @@
 // Released under MIT.
 
 #include "Schemas/ModioQueuedModfileUpload.h"
+#include "ModioStringConversion.h"
 
 void InitializeQueuedModfileUpload(FModioQueuedModfileUpload &queued_modfile_upload, const ModioQueuedModfileUpload &modio_queued_modfile_upload)
 {
@@ -9,5 +10,5 @@ void InitializeQueuedModfileUpload(FModioQueuedModfileUpload &queued_modfile_upl
   queued_modfile_upload.ModId = modio_queued_modfile_upload.mod_id;
   queued_modfile_upload.CurrentProgress = modio_queued_modfile_upload.current_progress;
   queued_modfile_upload.TotalSize = modio_queued_modfile_upload.total_size;
-  queued_modfile_upload.Path = UTF8_TO_TCHAR(modio_queued_modfile_upload.path);
+  ModioUtf8ToString(queued_modfile_upload.Path, modio_queued_modfile_upload.path);
 }
\ No newline at end of file
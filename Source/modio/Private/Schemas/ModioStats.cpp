@@ -2,6 +2,7 @@
 // Released under MIT.
 
 #include "Schemas/ModioStats.h"
+#include "ModioStringConversion.h"
 
 void InitializeStats(FModioStats &Stats, const ModioStats &modio_stats)
 {
@@ -16,5 +17,5 @@ void InitializeStats(FModioStats &Stats, const ModioStats &modio_stats)
   Stats.RatingsPercentagePositive = modio_stats.ratings_percentage_positive;
   Stats.RatingsWeightedAggregate = modio_stats.ratings_weighted_aggregate;
   Stats.DateExpires = modio_stats.date_expires;
-  Stats.RatingsDisplayText = UTF8_TO_TCHAR(modio_stats.ratings_display_text);
+  ModioUtf8ToString(Stats.RatingsDisplayText, modio_stats.ratings_display_text);
 }
\ No newline at end of file
@@ -2,15 +2,16 @@
 // Released under MIT.
 
 #include "Schemas/ModioUser.h"
+#include "ModioStringConversion.h"
 
 void InitializeUser(FModioUser &User, const ModioUser &modio_user)
 {
   User.Id = modio_user.id;
   User.DateOnline = modio_user.date_online;
-  User.Username = UTF8_TO_TCHAR(modio_user.username);
-  User.NameId = UTF8_TO_TCHAR(modio_user.name_id);
-  User.Timezone = UTF8_TO_TCHAR(modio_user.timezone);
-  User.Language = UTF8_TO_TCHAR(modio_user.language);
-  User.ProfileUrl = UTF8_TO_TCHAR(modio_user.profile_url);
+  ModioUtf8ToString(User.Username, modio_user.username);
+  ModioUtf8ToString(User.NameId, modio_user.name_id);
+  ModioUtf8ToString(User.Timezone, modio_user.timezone);
+  ModioUtf8ToString(User.Language, modio_user.language);
+  ModioUtf8ToString(User.ProfileUrl, modio_user.profile_url);
   InitializeAvatar(User.Avatar, modio_user.avatar);
 }
\ No newline at end of file
@@ -3,23 +3,141 @@
 
 #pragma once
 
-#include "Templates/SharedPointer.h"
+#include "CoreMinimal.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Templates/Function.h"
+#include "AsyncRequest/ModioAsyncRequestHandle.h"
+#include "ModioRequestMetrics.h"
 
 /**
  * Baseclass for async requests. Helps keep the implementation cleaner when doing
  * different async requests
+ *
+ * Responses run on the game thread, or on the processing worker when background processing is
+ * enabled, so they should only convert the data and hand the dispatch to Deliver. They run while the SDK
+ * lock is held, so responses with many mods copy them and convert through ConvertAfterSdkLock
  */
-struct FModioAsyncRequest :
-  TSharedFromThis<FModioAsyncRequest>
+struct MODIO_API FModioAsyncRequest
 {
 public:
   FModioAsyncRequest() = delete;
   FModioAsyncRequest(const FModioAsyncRequest& Other) = delete;
+
+  /** Handle that identifies this request while it's in flight */
+  const FModioAsyncRequestHandle& GetHandle() const
+  {
+    return Handle;
+  }
+
+  /** If the caller abandoned the request, it's response shouldn't be converted or delivered */
+  bool IsCancelled() const
+  {
+    return bCancelled;
+  }
+
+  /** When the request was created, answered and converted */
+  const FModioRequestTimings& GetTimings() const
+  {
+    return Timings;
+  }
+
+  /** Set once the request and everything coalesced onto it was cancelled, safe to read from any thread */
+  bool IsAbandoned() const
+  {
+    return bAbandoned;
+  }
+
+  /**
+   * Finishes the request without delivering anything if it and all it's followers were cancelled. Game
+   * thread only, responses use FinishIfAbandoned instead
+   */
+  bool FinishIfCancelled();
+
+  /**
+   * Call this first thing in the response, before converting anything, and bail out if it returns true.
+   * The request is finished on the game thread. Also marks when the SDK answered
+   */
+  bool FinishIfAbandoned();
+
+  /**
+   * Runs Dispatch on the game thread, unless the request got cancelled in the meantime, and finishes the
+   * request. Dispatch should own everything it uses, as it can run after the response returned. Response
+   * is the converted response, it's code and result count are recorded in the request metrics
+   */
+  void Deliver( const struct FModioResponse &Response, TFunction<void()> Dispatch );
+
+  /**
+   * Runs Convert on the thread that processed the response once the SDK lock is released, so the game thread
+   * doesn't wait on the conversion to call the SDK. The SDK's buffers are gone by then, copy what Convert needs
+   */
+  void ConvertAfterSdkLock( TFunction<void()> Convert );
+
+  /** For requests answered as part of another one, like GetMod calls answered by a batch. Call before Deliver */
+  void TakeNetworkTimings( const FModioAsyncRequest& AnsweredBy );
 protected:
   FModioAsyncRequest(struct FModioSubsystem* Modio);
 
-  /** Call this in your subclass when you are done with your object */
+  /** Call this in your subclass when you are done with your object, this also finishes all followers */
   void Done();
 
+  /**
+   * Runs Func for this request and for all the identical requests that were coalesced onto it, so
+   * one response can be fanned out to every caller. Needs to be called before calling Done
+   */
+  template<typename RequestType, typename FuncType>
+  void DispatchToAll( FuncType Func )
+  {
+    TArray<FModioAsyncRequest*, TInlineAllocator<8>> LiveFollowers;
+    BeginDispatch( LiveFollowers );
+
+    if( !bCancelled )
+    {
+      Func( static_cast<RequestType*>( this ) );
+    }
+    for( FModioAsyncRequest* Follower : LiveFollowers )
+    {
+      Func( static_cast<RequestType*>( Follower ) );
+    }
+  }
+
   struct FModioSubsystem *ModioSubsystem;
-};
\ No newline at end of file
+
+private:
+  friend struct FModioSubsystem;
+  friend class FModioAsyncRequestRegistry;
+
+  /** Stops new requests from coalescing onto this one and gathers the followers that still want the response */
+  void BeginDispatch( TArray<FModioAsyncRequest*, TInlineAllocator<8>> &OutLiveFollowers );
+
+  FModioAsyncRequestHandle Handle;
+
+  /** Written by the response on whichever thread it runs, read on the game thread once delivered */
+  FModioRequestTimings Timings;
+
+  /** Key identical reads are coalesced on, empty if this request doesn't accept followers */
+  FString CoalesceKey;
+
+  /** Identical requests that don't call the backend themselves but are answered with our response */
+  TArray<FModioAsyncRequestHandle> Followers;
+
+  /** Destructs the request with it's real type and releases it's memory, set when queued */
+  void (*DestroyFunction)(FModioAsyncRequest* Request);
+
+  /** Request we are coalesced onto, invalid if we call the backend ourselves */
+  FModioAsyncRequestHandle LeaderHandle;
+
+  /** Query slot the request is the latest search of, see FModioSubsystem::AssignQuerySlot */
+  FName QuerySlot;
+
+  /** Set when the caller cancels the request */
+  uint8 bCancelled : 1;
+
+  /** Set while the request holds a slot of it's priority class */
+  uint8 bHoldsSlot : 1;
+
+  /** EModioRequestPriority the request was issued with */
+  uint8 Priority;
+
+  /** Set when nobody wants the response anymore, read by the processing worker */
+  FThreadSafeBool bAbandoned;
+};
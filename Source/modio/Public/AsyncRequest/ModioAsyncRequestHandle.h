@@ -0,0 +1,55 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Lightweight identifier of a queued async request. The generation makes sure that
+ * a handle to a finished request never resolves to a newer request reusing the same slot
+ */
+struct FModioAsyncRequestHandle
+{
+  FModioAsyncRequestHandle() :
+    Index( INDEX_NONE ),
+    Generation( 0 )
+  {
+  }
+
+  FModioAsyncRequestHandle( int32 InIndex, uint32 InGeneration ) :
+    Index( InIndex ),
+    Generation( InGeneration )
+  {
+  }
+
+  /** True if this handle has ever been assigned to a request, it might have finished since */
+  bool IsValid() const
+  {
+    return Index != INDEX_NONE;
+  }
+
+  void Invalidate()
+  {
+    Index = INDEX_NONE;
+    Generation = 0;
+  }
+
+  bool operator==( const FModioAsyncRequestHandle &Other ) const
+  {
+    return Index == Other.Index && Generation == Other.Generation;
+  }
+
+  bool operator!=( const FModioAsyncRequestHandle &Other ) const
+  {
+    return !( *this == Other );
+  }
+
+  friend uint32 GetTypeHash( const FModioAsyncRequestHandle &Handle )
+  {
+    return HashCombine( ::GetTypeHash( Handle.Index ), ::GetTypeHash( Handle.Generation ) );
+  }
+
+  int32 Index;
+  uint32 Generation;
+};
@@ -0,0 +1,99 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+/** Keeps track of every request pool, so their idle memory can be released in one go */
+class MODIO_API FModioAsyncRequestPools
+{
+public:
+  /**
+   * Frees the idle blocks of every pool. Called by the subsystem on shutdown, while the allocator is still
+   * around, requests finishing later just start filling their pool again
+   */
+  static void ReleaseAll();
+
+private:
+  template<typename RequestType>
+  friend class TModioAsyncRequestPool;
+
+  static void Register( void (*Release)() );
+};
+
+/**
+ * Per request type free list, so that the memory of finished async requests is reused
+ * by the next request of the same type instead of going back to the allocator. Requests are
+ * created on the game thread but can be destroyed from the processing worker, so every pool
+ * has it's own lock instead of relying on the caller holding the SDK lock
+ */
+template<typename RequestType>
+class TModioAsyncRequestPool
+{
+public:
+  /** Returns uninitialized memory big enough to placement new a RequestType into */
+  static void* Allocate()
+  {
+    FFreeBlocks& FreeBlocks = GetFreeBlocks();
+    {
+      FScopeLock Lock( &FreeBlocks.CriticalSection );
+      if( FreeBlocks.Blocks.Num() )
+      {
+        return FreeBlocks.Blocks.Pop( false );
+      }
+    }
+    return FMemory::Malloc( sizeof(RequestType), alignof(RequestType) );
+  }
+
+  /** Destructs the request and hands back its memory to the pool */
+  static void Destroy( struct FModioAsyncRequest* Request )
+  {
+    RequestType* TypedRequest = static_cast<RequestType*>( Request );
+    TypedRequest->~RequestType();
+
+    FFreeBlocks& FreeBlocks = GetFreeBlocks();
+    {
+      FScopeLock Lock( &FreeBlocks.CriticalSection );
+      if( FreeBlocks.Blocks.Num() < MaxRetainedBlocks )
+      {
+        FreeBlocks.Blocks.Push( TypedRequest );
+        return;
+      }
+    }
+    FMemory::Free( TypedRequest );
+  }
+
+private:
+  /** Upper bound of how many idle requests of one type we keep around */
+  static constexpr int32 MaxRetainedBlocks = 256;
+
+  struct FFreeBlocks
+  {
+    FCriticalSection CriticalSection;
+    TArray<void*> Blocks;
+  };
+
+  static void Release()
+  {
+    FFreeBlocks& FreeBlocks = GetFreeBlocks();
+    FScopeLock Lock( &FreeBlocks.CriticalSection );
+    for( void* Block : FreeBlocks.Blocks )
+    {
+      FMemory::Free( Block );
+    }
+    FreeBlocks.Blocks.Empty();
+  }
+
+  static FFreeBlocks& GetFreeBlocks()
+  {
+    // Never destructed, static teardown can run after the allocator is gone. ReleaseAll frees the blocks
+    static FFreeBlocks* FreeBlocks = []()
+    {
+      FModioAsyncRequestPools::Register( &TModioAsyncRequestPool::Release );
+      return new FFreeBlocks();
+    }();
+    return *FreeBlocks;
+  }
+};
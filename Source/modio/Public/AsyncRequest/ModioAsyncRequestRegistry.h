@@ -0,0 +1,52 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AsyncRequest/ModioAsyncRequestHandle.h"
+
+/**
+ * Slot map holding all in flight async requests. Adding, finding and removing a request
+ * are all O(1), and stale handles are detected through the generation stored in each slot
+ */
+class MODIO_API FModioAsyncRequestRegistry
+{
+public:
+  FModioAsyncRequestRegistry();
+  FModioAsyncRequestRegistry(const FModioAsyncRequestRegistry& Other) = delete;
+  FModioAsyncRequestRegistry& operator=(const FModioAsyncRequestRegistry& Other) = delete;
+  ~FModioAsyncRequestRegistry();
+
+  /**
+   * Takes ownership of the request and returns the handle it can be found with, DestroyFunction releases it
+   * once it's removed
+   */
+  FModioAsyncRequestHandle Add( struct FModioAsyncRequest* Request, void (*DestroyFunction)(struct FModioAsyncRequest*) );
+
+  /** Returns the request for the handle, or nullptr if it has already finished */
+  struct FModioAsyncRequest* Find( const FModioAsyncRequestHandle &Handle ) const;
+
+  /** Destroys the request owned by the handle, returns false if the handle was stale */
+  bool Remove( const FModioAsyncRequestHandle &Handle );
+
+  /** Destroys all requests still in flight */
+  void Reset();
+
+  /** Number of requests currently in flight */
+  int32 Num() const
+  {
+    return NumActive;
+  }
+
+private:
+  struct FSlot
+  {
+    struct FModioAsyncRequest* Request;
+    uint32 Generation;
+  };
+
+  TArray<FSlot> Slots;
+  TArray<int32> FreeSlots;
+  int32 NumActive;
+};
@@ -22,7 +22,7 @@ protected:
 
   /** This should be the only way to create and queue async requests */
   template<typename RequestType, typename CallbackType, typename... Params>
-  friend RequestType* CreateAsyncRequest( FModioSubsystem* Subsystem, CallbackType CallbackDelegate, Params... Parameters );
+  friend RequestType* CreateAsyncRequest( FModioSubsystem* Subsystem, const TCHAR* Endpoint, CallbackType CallbackDelegate, Params... Parameters );
 private:
   FModioMetadataKVPArrayDelegate ResponseDelegate;
 };
\ No newline at end of file
@@ -19,6 +19,15 @@ public:
 
   static void Response(void *Object, ModioResponse ModioResponse, ModioMod Mod );
 
+  /** Hands the result to this request and it's followers and finishes the request */
+  void DeliverResponse( const FModioResponse &Response, FModioMod Mod );
+
+  /** Mod that was requested, used when the request is answered as part of a batch */
+  uint32 ModId;
+
+  /** Parts of the mod to convert */
+  EModioModFields Fields;
+
 private:
   FModioModDelegate ResponseDelegate;
-};
\ No newline at end of file
+};
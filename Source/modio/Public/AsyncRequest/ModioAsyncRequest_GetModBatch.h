@@ -0,0 +1,37 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+#include "AsyncRequest/ModioAsyncRequest.h"
+#include "Schemas/ModioResponse.h"
+#include "Schemas/ModioMod.h"
+
+/**
+* Answers a batch of GetMod requests with a single id-in GetAllMods query. Each
+* batched request gets it's own mod, the ones the query didn't return are asked
+* for again one by one
+* @param ModioResponse - Response from Modio backend
+* @param Mods - Mods matching the batched ids
+*/
+
+class FModioAsyncRequest_GetModBatch : public FModioAsyncRequest
+{
+public:
+  static void Response(void *Object, ModioResponse ModioResponse, ModioMod *ModioMods, u32 ModioModsSize);
+
+protected:
+  FModioAsyncRequest_GetModBatch( FModioSubsystem* Modio, const TArray<FModioAsyncRequestHandle> &BatchedRequests, const TArray<uint32> &BatchedModIds, const TArray<EModioModFields> &BatchedFields );
+
+  /** This should be the only way to create and queue async requests */
+  template<typename RequestType, typename CallbackType, typename... Params>
+  friend RequestType* CreateAsyncRequest( FModioSubsystem* Subsystem, const TCHAR* Endpoint, CallbackType CallbackDelegate, Params... Parameters );
+private:
+  /** GetMod requests waiting on this batch */
+  TArray<FModioAsyncRequestHandle> BatchedRequests;
+
+  /** Mod requested by each of the batched requests, kept here as the response can't look at the requests */
+  TArray<uint32> BatchedModIds;
+
+  /** Parts of the mod each of the batched requests wants converted */
+  TArray<EModioModFields> BatchedFields;
+};
@@ -5,6 +5,7 @@
 #include "AsyncRequest/ModioAsyncRequest.h"
 #include "Schemas/ModioResponse.h"
 #include "Schemas/ModioMod.h"
+#include "Schemas/ModioModView.h"
 
 /**
 * Callback returning all the mod profiles the user is subcribed
@@ -17,12 +18,18 @@ class FModioAsyncRequest_GetUserSubscriptions : public FModioAsyncRequest
 public:
   static void Response(void *Object, ModioResponse ModioResponse, ModioMod *ModioMods, u32 ModioModsSize);
 
+  /** Parts of the mods to convert */
+  EModioModFields Fields;
+
 protected:
   FModioAsyncRequest_GetUserSubscriptions( FModioSubsystem* Modio, FModioModArrayDelegate Delegate );
+  FModioAsyncRequest_GetUserSubscriptions( FModioSubsystem* Modio, FModioModViewArrayDelegate Delegate );
 
   /** This should be the only way to create and queue async requests */
   template<typename RequestType, typename CallbackType, typename... Params>
-  friend RequestType* CreateAsyncRequest( FModioSubsystem* Subsystem, CallbackType CallbackDelegate, Params... Parameters );
+  friend RequestType* CreateAsyncRequest( FModioSubsystem* Subsystem, const TCHAR* Endpoint, CallbackType CallbackDelegate, Params... Parameters );
 private:
   FModioModArrayDelegate ResponseDelegate;
+  /** Bound instead of ResponseDelegate when the mods are wanted as views */
+  FModioModViewArrayDelegate ViewDelegate;
 };
\ No newline at end of file
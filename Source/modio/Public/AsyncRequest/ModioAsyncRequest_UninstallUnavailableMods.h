@@ -16,11 +16,18 @@ class FModioAsyncRequest_UninstallUnavailableMods : public FModioAsyncRequest
 public:
   int32 PendingCalls;
   TArray<int32> AvailableMods;
+  /** Installed when the request was made */
+  TArray<int32> InstalledMods;
+  /** Set if any of the calls was answered with an error */
+  bool bAnyCallFailed;
 
   FModioAsyncRequest_UninstallUnavailableMods( FModioSubsystem *Modio, FModioGenericDelegate Delegate, int32 PendingCalls );
 
   static void Response(void *Object, ModioResponse ModioResponse, ModioMod *ModioMods, u32 ModioModsSize);
 
+  /** Succeeds right away, for when there is nothing installed to check */
+  void FinishWithoutCalls();
+
 private:
   FModioGenericDelegate ResponseDelegate;
 };
\ No newline at end of file
@@ -5,7 +5,7 @@
 
 #include "ModioSubsystem.h"
 #include "Schemas/ModioResponse.h"
-#include "Net/OnlineBlueprintCallProxyBase.h"
+#include "BlueprintCallbackProxies/ModioCallbackProxyBase.h"
 #include "CallbackProxy_AddMetadataKVP.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(
@@ -14,7 +14,7 @@ FModioResponse,
 response );
 
 UCLASS()
-class MODIO_API UCallbackProxy_AddMetadataKVP : public UOnlineBlueprintCallProxyBase
+class MODIO_API UCallbackProxy_AddMetadataKVP : public UModioCallbackProxyBase
 {
   GENERATED_UCLASS_BODY()
 
@@ -7,7 +7,7 @@
 #include "Enums/ModioMaturityOption.h"
 #include "Schemas/ModioResponse.h"
 #include "Schemas/ModioMod.h"
-#include "Net/OnlineBlueprintCallProxyBase.h"
+#include "BlueprintCallbackProxies/ModioCallbackProxyBase.h"
 #include "CallbackProxy_AddMod.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
@@ -18,7 +18,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
     Mod);
 
 UCLASS()
-class MODIO_API UCallbackProxy_AddMod : public UOnlineBlueprintCallProxyBase
+class MODIO_API UCallbackProxy_AddMod : public UModioCallbackProxyBase
 {
   GENERATED_UCLASS_BODY()
 
@@ -4,7 +4,7 @@
 #pragma once
 
 #include "Schemas/ModioResponse.h"
-#include "Net/OnlineBlueprintCallProxyBase.h"
+#include "BlueprintCallbackProxies/ModioCallbackProxyBase.h"
 #include "CallbackProxy_AddModRating.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(
@@ -13,7 +13,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(
     Response);
 
 UCLASS()
-class MODIO_API UCallbackProxy_AddModRating : public UOnlineBlueprintCallProxyBase
+class MODIO_API UCallbackProxy_AddModRating : public UModioCallbackProxyBase
 {
   GENERATED_UCLASS_BODY()
 
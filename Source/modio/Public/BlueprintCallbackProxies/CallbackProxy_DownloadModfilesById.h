@@ -5,7 +5,7 @@
 
 #include "ModioSubsystem.h"
 #include "Schemas/ModioResponse.h"
-#include "Net/OnlineBlueprintCallProxyBase.h"
+#include "BlueprintCallbackProxies/ModioCallbackProxyBase.h"
 #include "CallbackProxy_DownloadModfilesById.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
@@ -16,7 +16,7 @@ bool,
 mods_are_updated );
 
 UCLASS()
-class MODIO_API UCallbackProxy_DownloadModfilesById : public UOnlineBlueprintCallProxyBase
+class MODIO_API UCallbackProxy_DownloadModfilesById : public UModioCallbackProxyBase
 {
   GENERATED_UCLASS_BODY()
 
@@ -5,7 +5,7 @@
 
 #include "ModioSubsystem.h"
 #include "Schemas/ModioResponse.h"
-#include "Net/OnlineBlueprintCallProxyBase.h"
+#include "BlueprintCallbackProxies/ModioCallbackProxyBase.h"
 #include "CallbackProxy_GetAllMetadataKVP.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
@@ -16,7 +16,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
     MetadataKVP);
 
 UCLASS()
-class MODIO_API UCallbackProxy_GetAllMetadataKVP : public UOnlineBlueprintCallProxyBase
+class MODIO_API UCallbackProxy_GetAllMetadataKVP : public UModioCallbackProxyBase
 {
   GENERATED_UCLASS_BODY()
 
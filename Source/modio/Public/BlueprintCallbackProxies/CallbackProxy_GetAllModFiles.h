@@ -7,7 +7,7 @@
 #include "Customizables/ModioFilterCreator.h"
 #include "Schemas/ModioResponse.h"
 #include "Schemas/ModioModfile.h"
-#include "Net/OnlineBlueprintCallProxyBase.h"
+#include "BlueprintCallbackProxies/ModioCallbackProxyBase.h"
 #include "CallbackProxy_GetAllModFiles.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
@@ -18,7 +18,7 @@ const TArray<FModioModfile>&,
 Modfile);
 
 UCLASS()
-class MODIO_API UCallbackProxy_GetAllModfiles : public UOnlineBlueprintCallProxyBase
+class MODIO_API UCallbackProxy_GetAllModfiles : public UModioCallbackProxyBase
 {
   GENERATED_UCLASS_BODY()
 
@@ -6,7 +6,7 @@
 #include "ModioSubsystem.h"
 #include "Schemas/ModioResponse.h"
 #include "Schemas/ModioModTag.h"
-#include "Net/OnlineBlueprintCallProxyBase.h"
+#include "BlueprintCallbackProxies/ModioCallbackProxyBase.h"
 #include "CallbackProxy_GetAllModTags.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
@@ -17,7 +17,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
     ModTags);
 
 UCLASS()
-class MODIO_API UCallbackProxy_GetAllModTags : public UOnlineBlueprintCallProxyBase
+class MODIO_API UCallbackProxy_GetAllModTags : public UModioCallbackProxyBase
 {
   GENERATED_UCLASS_BODY()
 
@@ -7,7 +7,8 @@
 #include "Customizables/ModioFilterCreator.h"
 #include "Schemas/ModioResponse.h"
 #include "Schemas/ModioMod.h"
-#include "Net/OnlineBlueprintCallProxyBase.h"
+#include "BlueprintCallbackProxies/ModioCallbackProxyBase.h"
+#include "Enums/ModioRequestPriority.h"
 #include "CallbackProxy_GetAllMods.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
@@ -18,7 +19,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
     Mods);
 
 UCLASS()
-class MODIO_API UCallbackProxy_GetAllMods : public UOnlineBlueprintCallProxyBase
+class MODIO_API UCallbackProxy_GetAllMods : public UModioCallbackProxyBase
 {
   GENERATED_UCLASS_BODY()
 
@@ -26,6 +27,9 @@ class MODIO_API UCallbackProxy_GetAllMods : public UOnlineBlueprintCallProxyBase
   TArray<FString> ModTags;
   int32 Limit;
   int32 Offset;
+  FName QuerySlot;
+  int32 Fields;
+  TEnumAsByte<EModioRequestPriority> Priority;
 
   // The world context object in which this call is taking place
   UPROPERTY()
@@ -37,8 +41,14 @@ class MODIO_API UCallbackProxy_GetAllMods : public UOnlineBlueprintCallProxyBase
   UPROPERTY(BlueprintAssignable)
   FGetAllModsResult OnFailure;
 
-  UFUNCTION(BlueprintCallable, Category = "mod.io", meta = (BlueprintInternalUseOnly = "true", DefaultToSelf="WorldContext"))
-  static UCallbackProxy_GetAllMods *GetAllMods(UObject *WorldContext, FModioFilterCreator Filter, TArray<FString> ModTags, int32 Limit, int32 Offset);
+  /**
+   * When a QuerySlot is given, a previous search still in flight on the same slot is cancelled. Fields are the
+   * parts of the mods to convert, with no fields set the project default is used. A stale cached page fires
+   * OnSuccess right away, the refreshed page only reaches the subsystem's OnCachedModsRefreshed. The filter's
+   * cache max age of 0 always asks the backend. Priority is the class the request waits for a slot in
+   */
+  UFUNCTION(BlueprintCallable, Category = "mod.io", meta = (BlueprintInternalUseOnly = "true", DefaultToSelf="WorldContext", AdvancedDisplay = "Priority"))
+  static UCallbackProxy_GetAllMods *GetAllMods(UObject *WorldContext, FModioFilterCreator Filter, TArray<FString> ModTags, int32 Limit, int32 Offset, FName QuerySlot = NAME_None, UPARAM(meta = (Bitmask, BitmaskEnum = "EModioModField")) int32 Fields = 0, TEnumAsByte<EModioRequestPriority> Priority = EModioRequestPriority::NORMAL);
 
   virtual void Activate() override;
 
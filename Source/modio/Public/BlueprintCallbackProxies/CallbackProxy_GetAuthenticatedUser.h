@@ -5,7 +5,7 @@
 
 #include "Schemas/ModioResponse.h"
 #include "Schemas/ModioUser.h"
-#include "Net/OnlineBlueprintCallProxyBase.h"
+#include "BlueprintCallbackProxies/ModioCallbackProxyBase.h"
 #include "CallbackProxy_GetAuthenticatedUser.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
@@ -16,7 +16,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
     user);
 
 UCLASS()
-class MODIO_API UCallbackProxy_GetAuthenticatedUser : public UOnlineBlueprintCallProxyBase
+class MODIO_API UCallbackProxy_GetAuthenticatedUser : public UModioCallbackProxyBase
 {
   GENERATED_UCLASS_BODY()
 
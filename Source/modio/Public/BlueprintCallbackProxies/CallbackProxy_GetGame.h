@@ -6,7 +6,7 @@
 #include "ModioUE4Utility.h"
 #include "Schemas/ModioResponse.h"
 #include "Schemas/ModioGame.h"
-#include "Net/OnlineBlueprintCallProxyBase.h"
+#include "BlueprintCallbackProxies/ModioCallbackProxyBase.h"
 #include "CallbackProxy_GetGame.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
@@ -17,7 +17,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
   Game);
 
 UCLASS()
-class MODIO_API UCallbackProxy_GetGame : public UOnlineBlueprintCallProxyBase
+class MODIO_API UCallbackProxy_GetGame : public UModioCallbackProxyBase
 {
   GENERATED_UCLASS_BODY()
 
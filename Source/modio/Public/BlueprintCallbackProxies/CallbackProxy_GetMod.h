@@ -6,7 +6,8 @@
 #include "ModioUE4Utility.h"
 #include "Schemas/ModioResponse.h"
 #include "Schemas/ModioMod.h"
-#include "Net/OnlineBlueprintCallProxyBase.h"
+#include "BlueprintCallbackProxies/ModioCallbackProxyBase.h"
+#include "Enums/ModioRequestPriority.h"
 #include "CallbackProxy_GetMod.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
@@ -17,11 +18,13 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
     Mod);
 
 UCLASS()
-class MODIO_API UCallbackProxy_GetMod : public UOnlineBlueprintCallProxyBase
+class MODIO_API UCallbackProxy_GetMod : public UModioCallbackProxyBase
 {
   GENERATED_UCLASS_BODY()
 
   int32 ModId;
+  int32 Fields;
+  TEnumAsByte<EModioRequestPriority> Priority;
 
   // The world context object in which this call is taking place
   UPROPERTY()
@@ -33,8 +36,13 @@ class MODIO_API UCallbackProxy_GetMod : public UOnlineBlueprintCallProxyBase
   UPROPERTY(BlueprintAssignable)
   FGetModResult OnFailure;
 
-  UFUNCTION(BlueprintCallable, Category = "mod.io", meta = (BlueprintInternalUseOnly = "true", DefaultToSelf="WorldContext"))
-  static UCallbackProxy_GetMod *GetMod(UObject *WorldContext, int32 ModId);
+  /**
+   * Fields are the parts of the mods to convert, with no fields set the project default is used. A stale cached
+   * mod fires OnSuccess right away, the refreshed mod only reaches the subsystem's OnCachedModRefreshed. Priority is
+   * the class the request waits for a slot in
+   */
+  UFUNCTION(BlueprintCallable, Category = "mod.io", meta = (BlueprintInternalUseOnly = "true", DefaultToSelf="WorldContext", AdvancedDisplay = "Priority"))
+  static UCallbackProxy_GetMod *GetMod(UObject *WorldContext, int32 ModId, UPARAM(meta = (Bitmask, BitmaskEnum = "EModioModField")) int32 Fields = 0, TEnumAsByte<EModioRequestPriority> Priority = EModioRequestPriority::NORMAL);
 
   virtual void Activate() override;
 
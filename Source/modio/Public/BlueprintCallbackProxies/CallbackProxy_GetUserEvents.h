@@ -6,7 +6,7 @@
 #include "Schemas/ModioResponse.h"
 #include "Schemas/ModioUserEvent.h"
 #include "Enums/ModioModSortType.h"
-#include "Net/OnlineBlueprintCallProxyBase.h"
+#include "BlueprintCallbackProxies/ModioCallbackProxyBase.h"
 #include "CallbackProxy_GetUserEvents.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
@@ -17,7 +17,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
     UserEvents);
 
 UCLASS()
-class MODIO_API UCallbackProxy_GetUserEvents : public UOnlineBlueprintCallProxyBase
+class MODIO_API UCallbackProxy_GetUserEvents : public UModioCallbackProxyBase
 {
   GENERATED_UCLASS_BODY()
 
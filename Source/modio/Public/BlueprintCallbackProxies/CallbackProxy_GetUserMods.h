@@ -3,7 +3,8 @@
 
 #pragma once
 
-#include "Net/OnlineBlueprintCallProxyBase.h"
+#include "BlueprintCallbackProxies/ModioCallbackProxyBase.h"
+#include "Enums/ModioRequestPriority.h"
 #include "Customizables/ModioFilterCreator.h"
 #include "Schemas/ModioResponse.h"
 #include "Schemas/ModioMod.h"
@@ -17,7 +18,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
     Mods);
 
 UCLASS()
-class MODIO_API UCallbackProxy_GetUserMods : public UOnlineBlueprintCallProxyBase
+class MODIO_API UCallbackProxy_GetUserMods : public UModioCallbackProxyBase
 {
   GENERATED_UCLASS_BODY()
 
@@ -25,6 +26,8 @@ class MODIO_API UCallbackProxy_GetUserMods : public UOnlineBlueprintCallProxyBas
   TArray<FString> ModTags;
   int32 Limit;
   int32 Offset;
+  int32 Fields;
+  TEnumAsByte<EModioRequestPriority> Priority;
 
   // The world context object in which this call is taking place
   UPROPERTY()
@@ -36,8 +39,12 @@ class MODIO_API UCallbackProxy_GetUserMods : public UOnlineBlueprintCallProxyBas
   UPROPERTY(BlueprintAssignable)
   FGetUserModsResult OnFailure;
 
-  UFUNCTION(BlueprintCallable, Category = "mod.io", meta = (BlueprintInternalUseOnly = "true", DefaultToSelf="WorldContext"))
-  static UCallbackProxy_GetUserMods *GetUserMods(UObject *WorldContext, FModioFilterCreator FilterCreator, TArray<FString> ModTags, int32 Limit, int32 Offset);
+  /**
+   * Fields are the parts of the mods to convert, with no fields set the project default is used. Priority is the
+   * class the request waits for a slot in
+   */
+  UFUNCTION(BlueprintCallable, Category = "mod.io", meta = (BlueprintInternalUseOnly = "true", DefaultToSelf="WorldContext", AdvancedDisplay = "Priority"))
+  static UCallbackProxy_GetUserMods *GetUserMods(UObject *WorldContext, FModioFilterCreator FilterCreator, TArray<FString> ModTags, int32 Limit, int32 Offset, UPARAM(meta = (Bitmask, BitmaskEnum = "EModioModField")) int32 Fields = 0, TEnumAsByte<EModioRequestPriority> Priority = EModioRequestPriority::NORMAL);
 
   virtual void Activate() override;
 
@@ -6,7 +6,7 @@
 #include "Schemas/ModioResponse.h"
 #include "Schemas/ModioRating.h"
 #include "Enums/ModioModSortType.h"
-#include "Net/OnlineBlueprintCallProxyBase.h"
+#include "BlueprintCallbackProxies/ModioCallbackProxyBase.h"
 #include "CallbackProxy_GetUserRatings.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
@@ -17,7 +17,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
     Ratings);
 
 UCLASS()
-class MODIO_API UCallbackProxy_GetUserRatings : public UOnlineBlueprintCallProxyBase
+class MODIO_API UCallbackProxy_GetUserRatings : public UModioCallbackProxyBase
 {
   GENERATED_UCLASS_BODY()
 
@@ -5,7 +5,7 @@
 
 #include "ModioSubsystem.h"
 #include "Schemas/ModioResponse.h"
-#include "Net/OnlineBlueprintCallProxyBase.h"
+#include "BlueprintCallbackProxies/ModioCallbackProxyBase.h"
 #include "Int64.h"
 #include "CallbackProxy_OculusAuth.generated.h"
 
@@ -15,7 +15,7 @@ FModioResponse,
 response );
 
 UCLASS()
-class MODIO_API UCallbackProxy_OculusAuth : public UOnlineBlueprintCallProxyBase
+class MODIO_API UCallbackProxy_OculusAuth : public UModioCallbackProxyBase
 {
   GENERATED_UCLASS_BODY()
 
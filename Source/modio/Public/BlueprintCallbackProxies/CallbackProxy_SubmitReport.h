@@ -5,7 +5,7 @@
 
 #include "ModioSubsystem.h"
 #include "Schemas/ModioResponse.h"
-#include "Net/OnlineBlueprintCallProxyBase.h"
+#include "BlueprintCallbackProxies/ModioCallbackProxyBase.h"
 #include "Enums/ModioReportType.h"
 #include "Enums/ModioResourceType.h"
 #include "CallbackProxy_SubmitReport.generated.h"
@@ -16,7 +16,7 @@ FModioResponse,
 response );
 
 UCLASS()
-class MODIO_API UCallbackProxy_SubmitReport : public UOnlineBlueprintCallProxyBase
+class MODIO_API UCallbackProxy_SubmitReport : public UModioCallbackProxyBase
 {
   GENERATED_UCLASS_BODY()
 
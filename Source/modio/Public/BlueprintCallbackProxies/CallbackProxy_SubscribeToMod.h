@@ -5,7 +5,7 @@
 
 #include "Schemas/ModioResponse.h"
 #include "Schemas/ModioMod.h"
-#include "Net/OnlineBlueprintCallProxyBase.h"
+#include "BlueprintCallbackProxies/ModioCallbackProxyBase.h"
 #include "CallbackProxy_SubscribeToMod.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
@@ -16,7 +16,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
     Mod);
 
 UCLASS()
-class MODIO_API UCallbackProxy_SubscribeToMod : public UOnlineBlueprintCallProxyBase
+class MODIO_API UCallbackProxy_SubscribeToMod : public UModioCallbackProxyBase
 {
   GENERATED_UCLASS_BODY()
 
@@ -0,0 +1,35 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "AsyncRequest/ModioAsyncRequestHandle.h"
+#include "Net/OnlineBlueprintCallProxyBase.h"
+#include "ModioCallbackProxyBase.generated.h"
+
+/**
+ * Base for callback proxies that start a single async request, keeps track of the request so it can
+ * be cancelled
+ */
+UCLASS(Abstract)
+class MODIO_API UModioCallbackProxyBase : public UOnlineBlueprintCallProxyBase
+{
+  GENERATED_UCLASS_BODY()
+
+  /** Abandons the request, neither OnSuccess nor OnFailure will be called */
+  UFUNCTION(BlueprintCallable, Category = "mod.io")
+  void Cancel();
+
+  /** Handle of the request started by Activate, invalid before that */
+  const FModioAsyncRequestHandle& GetRequestHandle() const;
+
+  virtual void BeginDestroy() override;
+
+protected:
+  /** Call from Activate with the handle of the request that was started */
+  void TrackRequest( const TSharedPtr<struct FModioSubsystem, ESPMode::Fast> &Modio, const FModioAsyncRequestHandle &Handle );
+
+private:
+  TWeakPtr<struct FModioSubsystem, ESPMode::Fast> ModioSubsystem;
+  FModioAsyncRequestHandle RequestHandle;
+};
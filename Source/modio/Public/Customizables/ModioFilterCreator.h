@@ -19,4 +19,7 @@ struct FModioFilterCreator
   FString FullTextSearch;
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io")
   TArray <FModioFieldFilterCreator> FieldFilters;
+  /** How old a response the SDK may answer from it's cache, 0 always asks the backend */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io", meta = (ClampMin = 0))
+  int32 CacheMaxAgeSeconds = 300;
 };
\ No newline at end of file
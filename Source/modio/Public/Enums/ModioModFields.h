@@ -0,0 +1,48 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ModioModFields.generated.h"
+
+/**
+ * One part of a mod to convert from a response, Blueprint bitmasks of it set the bit of each value. UHT only
+ * takes uint8 Blueprint enums, so the mask itself is EModioModFields below
+ */
+UENUM( BlueprintType )
+enum class EModioModField : uint8
+{
+  Summary,
+  Description   UMETA( ToolTip = "Description and plain text description" ),
+  Urls          UMETA( ToolTip = "Homepage and profile urls" ),
+  Logo,
+  SubmittedBy,
+  Modfile,
+  Media,
+  Stats,
+  Tags,
+  Metadata      UMETA( ToolTip = "Metadata blob and metadata key value pairs" )
+};
+
+/**
+ * Parts of a mod to convert from a response. Ids, status, visibility, maturity, dates, name and name id are
+ * always converted, the fields left out of the mask stay empty. Bit N is EModioModField N, so a Blueprint
+ * bitmask of EModioModField casts straight to it
+ */
+enum class EModioModFields : int32
+{
+  None          = 0,
+  Summary       = 1 << (int32)EModioModField::Summary,
+  Description   = 1 << (int32)EModioModField::Description,
+  Urls          = 1 << (int32)EModioModField::Urls,
+  Logo          = 1 << (int32)EModioModField::Logo,
+  SubmittedBy   = 1 << (int32)EModioModField::SubmittedBy,
+  Modfile       = 1 << (int32)EModioModField::Modfile,
+  Media         = 1 << (int32)EModioModField::Media,
+  Stats         = 1 << (int32)EModioModField::Stats,
+  Tags          = 1 << (int32)EModioModField::Tags,
+  Metadata      = 1 << (int32)EModioModField::Metadata,
+  All           = ( 1 << 10 ) - 1
+};
+ENUM_CLASS_FLAGS( EModioModFields );
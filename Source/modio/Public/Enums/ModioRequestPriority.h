@@ -0,0 +1,16 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "ModioRequestPriority.generated.h"
+
+/** Class a request is admitted in, each class has it's own queue and limit of requests in flight */
+UENUM(BlueprintType)
+enum EModioRequestPriority
+{
+  INTERACTIVE     UMETA(DisplayName = "Interactive"),
+  NORMAL          UMETA(DisplayName = "Normal"),
+  BACKGROUND      UMETA(DisplayName = "Background"),
+  PRIORITY_MAX    UMETA(Hidden)
+};
@@ -0,0 +1,261 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Schemas/ModioMod.h"
+#include "Schemas/ModioModfile.h"
+#include "Schemas/ModioUser.h"
+#include "Schemas/ModioGameTagOption.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * Layout of the binary store. Every section is an array of fixed size records, strings are offsets into a
+ * single table of null terminated UTF-8 strings where offset 0 is the empty string. Everything after the
+ * header is covered by the checksum, bump Version whenever a record changes
+ */
+namespace ModioBinaryStore
+{
+  static const uint32 Magic = 0x53494F4D; // "MOIS"
+  static const uint32 Version = 1;
+
+  /** Range of records in another section */
+  struct FRange
+  {
+    uint32 First;
+    uint32 Num;
+  };
+
+  struct FUserRecord
+  {
+    int32 Id;
+    int32 DateOnline;
+    uint32 Username;
+    uint32 NameId;
+    uint32 Timezone;
+    uint32 Language;
+    uint32 ProfileUrl;
+    uint32 AvatarFilename;
+    uint32 AvatarOriginal;
+    uint32 AvatarThumb50x50;
+    uint32 AvatarThumb100x100;
+  };
+
+  struct FModfileRecord
+  {
+    int64 Filesize;
+    int32 Id;
+    int32 ModId;
+    int32 VirusStats;
+    int32 VirusPositive;
+    int32 DateAdded;
+    int32 DateScanned;
+    int32 DownloadDateExpires;
+    uint32 Filename;
+    uint32 Version;
+    uint32 VirustotalHash;
+    uint32 Changelog;
+    uint32 MetadataBlob;
+    uint32 Md5;
+    uint32 BinaryUrl;
+  };
+
+  struct FModRecord
+  {
+    int32 Id;
+    int32 GameId;
+    int32 Status;
+    int32 Visible;
+    int32 MaturityOption;
+    int32 DateAdded;
+    int32 DateUpdated;
+    int32 DateLive;
+    uint32 HomepageUrl;
+    uint32 Name;
+    uint32 NameId;
+    uint32 Summary;
+    uint32 Description;
+    uint32 DescriptionPlainText;
+    uint32 MetadataBlob;
+    uint32 ProfileUrl;
+    uint32 LogoFilename;
+    uint32 LogoOriginal;
+    uint32 LogoThumb320x180;
+    uint32 LogoThumb640x360;
+    uint32 LogoThumb1280x720;
+    FUserRecord SubmittedBy;
+    /** Index in the modfile section */
+    uint32 Modfile;
+    int32 PopularityRankPosition;
+    int32 PopularityRankTotalMods;
+    int32 DownloadsTotal;
+    int32 SubscribersTotal;
+    int32 RatingsTotal;
+    int32 RatingsPositive;
+    int32 RatingsNegative;
+    int32 RatingsPercentagePositive;
+    int32 StatsDateExpires;
+    float RatingsWeightedAggregate;
+    uint32 RatingsDisplayText;
+    /** In the string list section */
+    FRange Youtube;
+    FRange Sketchfab;
+    FRange Images;
+    FRange Tags;
+    FRange MetadataKVP;
+  };
+
+  struct FImageRecord
+  {
+    uint32 Filename;
+    uint32 Original;
+    uint32 Thumb320x180;
+  };
+
+  struct FTagRecord
+  {
+    int32 DateAdded;
+    uint32 Name;
+  };
+
+  struct FMetadataKVPRecord
+  {
+    uint32 Metakey;
+    uint32 Metavalue;
+  };
+
+  struct FTagOptionRecord
+  {
+    uint32 Name;
+    uint32 Type;
+    uint32 Hidden;
+    /** In the string list section */
+    FRange Tags;
+  };
+
+  /** Byte offset and record count of a section */
+  struct FSection
+  {
+    uint32 Offset;
+    uint32 Num;
+  };
+
+  enum class ESection : uint8
+  {
+    Mods,
+    Modfiles,
+    Images,
+    Tags,
+    MetadataKVP,
+    TagOptions,
+    StringLists,
+    User,
+    Strings,
+    Count
+  };
+
+  struct FHeader
+  {
+    uint32 Magic;
+    uint32 Version;
+    uint32 GameId;
+    /** CRC32 of everything after the header */
+    uint32 Crc;
+    uint32 FileSize;
+    /** Unix time the store was written */
+    int64 SavedAt;
+    FSection Sections[(int32)ESection::Count];
+  };
+}
+
+/** Builds a binary store, strings used more than once are only written once */
+class MODIO_API FModioBinaryStoreWriter
+{
+public:
+  FModioBinaryStoreWriter();
+
+  void AddMod( const FModioMod& Mod );
+
+  void AddTagOptions( const TArray<FModioGameTagOption>& TagOptions );
+
+  /** The logged in user, at most one is stored */
+  void SetUser( const FModioUser& User );
+
+  /**
+   * Writes a temporary file next to Filename and moves it over, so a crash while saving never leaves a half
+   * written store behind. Returns false if the file couldn't be written
+   */
+  bool Save( const FString& Filename, uint32 GameId ) const;
+
+private:
+  uint32 AddString( const FString& String );
+  ModioBinaryStore::FRange AddStrings( const TArray<FString>& Strings );
+  ModioBinaryStore::FUserRecord MakeUserRecord( const FModioUser& User );
+
+  TArray<ModioBinaryStore::FModRecord> Mods;
+  TArray<ModioBinaryStore::FModfileRecord> Modfiles;
+  TArray<ModioBinaryStore::FImageRecord> Images;
+  TArray<ModioBinaryStore::FTagRecord> Tags;
+  TArray<ModioBinaryStore::FMetadataKVPRecord> MetadataKVP;
+  TArray<ModioBinaryStore::FTagOptionRecord> TagOptions;
+  TArray<uint32> StringLists;
+  TArray<ModioBinaryStore::FUserRecord> Users;
+
+  TArray<ANSICHAR> Strings;
+  TMap<FString, uint32> StringOffsets;
+};
+
+/**
+ * Reads a binary store through a memory mapping, records are only converted when asked for. Falls back to
+ * reading the whole file where the platform can't map it. Open rejects stores of another version or game,
+ * truncated ones and ones failing their checksum, and every offset is bounds checked when read
+ */
+class MODIO_API FModioBinaryStoreReader
+{
+public:
+  ~FModioBinaryStoreReader();
+
+  /** Null if the store is missing or can't be used */
+  static TUniquePtr<FModioBinaryStoreReader> Open( const FString& Filename, uint32 GameId );
+
+  /** Unix time the store was written */
+  int64 GetSavedAt() const;
+
+  int32 NumMods() const;
+
+  /** Id of the mod at Index without converting the rest of it */
+  int32 GetModId( int32 Index ) const;
+
+  void ReadMod( int32 Index, FModioMod& OutMod ) const;
+
+  void ReadTagOptions( TArray<FModioGameTagOption>& OutTagOptions ) const;
+
+  /** Returns false if no user was logged in when the store was written */
+  bool ReadUser( FModioUser& OutUser ) const;
+
+private:
+  FModioBinaryStoreReader();
+
+  /** Checks the header, the checksum and that every section lies within the file */
+  bool Validate( uint32 GameId ) const;
+
+  template<typename RecordType>
+  const RecordType* GetSection( ModioBinaryStore::ESection Section ) const;
+  uint32 GetNum( ModioBinaryStore::ESection Section ) const;
+
+  FString GetString( uint32 Offset ) const;
+  void GetStrings( const ModioBinaryStore::FRange& Range, TArray<FString>& OutStrings ) const;
+  void ReadUserRecord( const ModioBinaryStore::FUserRecord& Record, FModioUser& OutUser ) const;
+  void ReadModfile( uint32 Index, FModioModfile& OutModfile ) const;
+
+  TUniquePtr<IMappedFileHandle> MappedHandle;
+  TUniquePtr<IMappedFileRegion> MappedRegion;
+  /** The file's contents when it couldn't be mapped */
+  TArray<uint8> Loaded;
+
+  const uint8* Data;
+  int64 Size;
+};
@@ -0,0 +1,56 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Customizables/ModioFilterCreator.h"
+
+typedef TSharedRef<const class FModioCompiledFilter, ESPMode::ThreadSafe> FModioCompiledFilterRef;
+
+/**
+ * A mod filter rendered once to the query string the SDK's FilterString calls take, so paging through a
+ * search only swaps limit and offset instead of building and freeing a filter creator per page. Field
+ * filters are sorted and deduplicated, filters asking the same have the same query and hash whatever order
+ * they were built in. In and not in values of a field are merged, for the other types the last value of a
+ * field wins like it does in the SDK. Immutable, can be shared between threads
+ */
+class MODIO_API FModioCompiledFilter
+{
+public:
+  /** Compiles the filter, ModTags are added as a tags in filter */
+  static FModioCompiledFilterRef Compile( const FModioFilterCreator& FilterCreator, const TArray<FString>& ModTags );
+
+  /** Query without limit and offset, equal for filters that ask the same */
+  const FString& GetQuery() const
+  {
+    return Query;
+  }
+
+  /** How old a response the SDK may answer from it's cache, not part of the query */
+  uint32 GetCacheMaxAgeSeconds() const
+  {
+    return CacheMaxAgeSeconds;
+  }
+
+  /** Hash of the UTF-8 query, stable between runs and platforms */
+  uint64 GetHash() const
+  {
+    return Hash;
+  }
+
+  /** Key of a page for coalescing and caching, filters with other cache max ages get other keys */
+  FString MakePageKey( int32 Limit, int32 Offset ) const;
+
+  /** Null terminated UTF-8 query of a page */
+  TArray<ANSICHAR> MakePageQuery( int32 Limit, int32 Offset ) const;
+
+private:
+  FModioCompiledFilter( TArray<ANSICHAR>&& InUtf8Query, uint32 InCacheMaxAgeSeconds );
+
+  /** Escaped UTF-8 query, not terminated */
+  TArray<ANSICHAR> Utf8Query;
+  FString Query;
+  uint64 Hash;
+  uint32 CacheMaxAgeSeconds;
+};
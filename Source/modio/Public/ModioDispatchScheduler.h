@@ -0,0 +1,54 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Templates/Function.h"
+
+/**
+ * Queue of work that has to run on the game thread, like calling the delegates of converted responses.
+ * Any thread can add work, the game thread runs it from Dispatch spending at most the budget per call,
+ * the rest is deferred to the next call. At least one task runs per call so the queue can't stall
+ */
+class MODIO_API FModioDispatchScheduler
+{
+public:
+  FModioDispatchScheduler();
+  FModioDispatchScheduler(const FModioDispatchScheduler& Other) = delete;
+  FModioDispatchScheduler& operator=(const FModioDispatchScheduler& Other) = delete;
+
+  /** Most time in microseconds a Dispatch call spends, 0 runs everything that is queued */
+  void SetBudget( int32 BudgetInMicroseconds );
+  int32 GetBudget() const;
+
+  /** True if a budget is set, in that case work should be queued even when on the game thread */
+  bool IsBudgeted() const;
+
+  /** Queues work for the game thread, thread safe */
+  void Enqueue( TFunction<void()> Task );
+
+  /** Runs queued work until the budget runs out, game thread only */
+  void Dispatch();
+
+  /** Runs all queued work no matter the budget, game thread only */
+  void DispatchAll();
+
+  /** Amount of tasks waiting to run */
+  int32 NumQueued() const;
+
+  /** Amount of tasks that had to wait for a later Dispatch call as the budget ran out, each counted once */
+  int32 GetNumDeferred() const;
+
+private:
+  void RunTasks( bool bUseBudget );
+
+  TQueue<TFunction<void()>, EQueueMode::Mpsc> Tasks;
+  FThreadSafeCounter NumTasks;
+  int32 BudgetInMicroseconds;
+  int32 NumDeferred;
+  /** Tasks at the front of the queue already counted in NumDeferred, so waiting more calls doesn't count them again */
+  int32 NumCountedDeferred;
+};
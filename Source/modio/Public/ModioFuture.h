@@ -0,0 +1,502 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Async.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Misc/ScopeLock.h"
+#include "Templates/Function.h"
+#include "Templates/IntegerSequence.h"
+#include "Schemas/ModioResponse.h"
+#include "Schemas/ModioGame.h"
+#include "Schemas/ModioMod.h"
+#include "Schemas/ModioModfile.h"
+#include "Schemas/ModioModDependency.h"
+#include "Schemas/ModioModTag.h"
+#include "Schemas/ModioMetadataKVP.h"
+#include "Schemas/ModioUser.h"
+#include "Schemas/ModioUserEvent.h"
+#include "Schemas/ModioRating.h"
+
+template<typename ValueType> class TModioFuture;
+template<typename ValueType> class TModioPromise;
+
+namespace ModioFuture
+{
+  /** Response code of futures whose request was cancelled or dropped before it was answered, the backend never sends it */
+  const int32 CancelledCode = -1;
+
+  inline bool IsCancelled( const FModioResponse &Response )
+  {
+    return Response.Code == CancelledCode;
+  }
+}
+
+/** Response of a call together with the value it returned */
+template<typename ValueType>
+struct TModioResult
+{
+  FModioResponse Response;
+  ValueType Value;
+
+  bool IsSuccess() const
+  {
+    return Response.Code >= 200 && Response.Code < 300;
+  }
+
+  bool IsCancelled() const
+  {
+    return ModioFuture::IsCancelled( Response );
+  }
+};
+
+/** Shared state of a promise and it's futures, the value is set once and is read only after that */
+template<typename ValueType>
+class TModioFutureState : public TSharedFromThis<TModioFutureState<ValueType>, ESPMode::ThreadSafe>
+{
+public:
+  typedef TFunction<void( const TSharedRef<TModioFutureState, ESPMode::ThreadSafe> &ReadyState )> FContinuation;
+
+  bool IsReady() const
+  {
+    FScopeLock Lock( &CriticalSection );
+    return Value.IsSet();
+  }
+
+  const ValueType& Get() const
+  {
+    check( IsReady() );
+    return Value.GetValue();
+  }
+
+  void SetValue( ValueType InValue )
+  {
+    verify( TrySetValue( MoveTemp( InValue ) ) );
+  }
+
+  /** Sets the value unless it's already set, returns false in that case */
+  bool TrySetValue( ValueType InValue )
+  {
+    TArray<FContinuation> ReadyContinuations;
+    {
+      FScopeLock Lock( &CriticalSection );
+      if( Value.IsSet() )
+      {
+        return false;
+      }
+      Value = MoveTemp( InValue );
+      ReadyContinuations = MoveTemp( Continuations );
+    }
+
+    for( FContinuation& Continuation : ReadyContinuations )
+    {
+      Continuation( this->AsShared() );
+    }
+    return true;
+  }
+
+  /** Runs Continuation when the value gets set, or right away if it's already set */
+  void AddContinuation( FContinuation Continuation )
+  {
+    {
+      FScopeLock Lock( &CriticalSection );
+      if( !Value.IsSet() )
+      {
+        Continuations.Add( MoveTemp( Continuation ) );
+        return;
+      }
+    }
+    Continuation( this->AsShared() );
+  }
+
+private:
+  mutable FCriticalSection CriticalSection;
+  TOptional<ValueType> Value;
+  TArray<FContinuation> Continuations;
+};
+
+namespace ModioFuture
+{
+  /** Runs Task on Thread, right away if we are already on the game thread and that is where it should run */
+  inline void RunOnThread( ENamedThreads::Type Thread, TFunction<void()> Task )
+  {
+    if( ENamedThreads::GetThreadIndex( Thread ) == ENamedThreads::GameThread && IsInGameThread() )
+    {
+      Task();
+    }
+    else
+    {
+      AsyncTask( Thread, MoveTemp( Task ) );
+    }
+  }
+
+  namespace Private
+  {
+    /** How the return value of a Then continuation ends up in the next future */
+    template<typename ResultType>
+    struct TContinuation
+    {
+      typedef ResultType ValueType;
+
+      template<typename FuncType, typename ArgType>
+      static void Run( const TModioPromise<ValueType> &Promise, FuncType &Func, const ArgType &Arg )
+      {
+        Promise.SetValue( Func( Arg ) );
+      }
+    };
+
+    /** Continuations returning nothing give a future of an empty tuple, so they can still be joined */
+    template<>
+    struct TContinuation<void>
+    {
+      typedef TTuple<> ValueType;
+
+      template<typename FuncType, typename ArgType>
+      static void Run( const TModioPromise<ValueType> &Promise, FuncType &Func, const ArgType &Arg )
+      {
+        Func( Arg );
+        Promise.SetValue( TTuple<>() );
+      }
+    };
+
+    /** Continuations returning a future are flattened, the next future is ready when the returned one is */
+    template<typename InnerType>
+    struct TContinuation<TModioFuture<InnerType>>
+    {
+      typedef InnerType ValueType;
+
+      template<typename FuncType, typename ArgType>
+      static void Run( const TModioPromise<ValueType> &Promise, FuncType &Func, const ArgType &Arg )
+      {
+        Func( Arg ).Forward( Promise );
+      }
+    };
+  }
+}
+
+/** Sets the value of it's futures, usually from a response delegate */
+template<typename ValueType>
+class TModioPromise
+{
+public:
+  TModioPromise() :
+    State( MakeShared<TModioFutureState<ValueType>, ESPMode::ThreadSafe>() )
+  {
+  }
+
+  /** Makes the futures ready, can only be called once */
+  void SetValue( ValueType Value ) const
+  {
+    State->SetValue( MoveTemp( Value ) );
+  }
+
+  /** Makes the futures ready unless they already are, returns false in that case */
+  bool TrySetValue( ValueType Value ) const
+  {
+    return State->TrySetValue( MoveTemp( Value ) );
+  }
+
+  TModioFuture<ValueType> GetFuture() const
+  {
+    return TModioFuture<ValueType>( State );
+  }
+
+private:
+  TSharedRef<TModioFutureState<ValueType>, ESPMode::ThreadSafe> State;
+};
+
+/**
+ * Value that will be available once a call finishes. Futures are cheap to copy and can be continued with
+ * Then or joined with ModioFuture::WhenAll and ModioFuture::WhenAny. A future of a cancelled request becomes
+ * ready with a ModioFuture::CancelledCode response once the request is dropped.
+ */
+template<typename ValueType>
+class TModioFuture
+{
+public:
+  /** Future that is ready with Value */
+  static TModioFuture MakeReady( ValueType Value )
+  {
+    TModioPromise<ValueType> Promise;
+    Promise.SetValue( MoveTemp( Value ) );
+    return Promise.GetFuture();
+  }
+
+  bool IsReady() const
+  {
+    return State->IsReady();
+  }
+
+  /** The value, only valid once the future is ready */
+  const ValueType& Get() const
+  {
+    return State->Get();
+  }
+
+  /**
+   * Calls Func with the value on Thread once the future is ready, and returns a future of what Func returns.
+   * If Func returns a future the returned future is ready when that one is
+   */
+  template<typename FuncType>
+  TModioFuture<typename ModioFuture::Private::TContinuation<decltype( DeclVal<FuncType&>()( DeclVal<const ValueType&>() ) )>::ValueType> Then( FuncType Func, ENamedThreads::Type Thread = ENamedThreads::GameThread ) const
+  {
+    typedef ModioFuture::Private::TContinuation<decltype( DeclVal<FuncType&>()( DeclVal<const ValueType&>() ) )> ContinuationType;
+
+    TModioPromise<typename ContinuationType::ValueType> Promise;
+    State->AddContinuation( [Promise, Func, Thread]( const TSharedRef<TModioFutureState<ValueType>, ESPMode::ThreadSafe> &ReadyState )
+    {
+      ModioFuture::RunOnThread( Thread, [Promise, Func, ReadyState]() mutable
+      {
+        ContinuationType::Run( Promise, Func, ReadyState->Get() );
+      });
+    });
+    return Promise.GetFuture();
+  }
+
+  /** Calls Func with the value on the thread that makes the future ready, keep it short */
+  void OnReady( TFunction<void( const ValueType &Value )> Func ) const
+  {
+    State->AddContinuation( [Func]( const TSharedRef<TModioFutureState<ValueType>, ESPMode::ThreadSafe> &ReadyState )
+    {
+      Func( ReadyState->Get() );
+    });
+  }
+
+  /** Sets the value of Promise once the future is ready */
+  void Forward( const TModioPromise<ValueType> &Promise ) const
+  {
+    OnReady( [Promise]( const ValueType &Value )
+    {
+      Promise.SetValue( Value );
+    });
+  }
+
+private:
+  friend class TModioPromise<ValueType>;
+
+  explicit TModioFuture( const TSharedRef<TModioFutureState<ValueType>, ESPMode::ThreadSafe> &InState ) :
+    State( InState )
+  {
+  }
+
+  TSharedRef<TModioFutureState<ValueType>, ESPMode::ThreadSafe> State;
+};
+
+namespace ModioFuture
+{
+  namespace Private
+  {
+    template<typename... ValueTypes>
+    struct TWhenAllState
+    {
+      TWhenAllState() :
+        Remaining( sizeof...( ValueTypes ) )
+      {
+      }
+
+      template<uint32... Indices>
+      void Finish( TIntegerSequence<uint32, Indices...> )
+      {
+        Promise.SetValue( TTuple<ValueTypes...>( Values.template Get<Indices>().GetValue()... ) );
+      }
+
+      /** Each slot is written by a single future, the counter tells when the last one arrived */
+      TTuple<TOptional<ValueTypes>...> Values;
+      FThreadSafeCounter Remaining;
+      TModioPromise<TTuple<ValueTypes...>> Promise;
+    };
+
+    template<typename... ValueTypes, uint32... Indices>
+    void AttachAll( const TSharedRef<TWhenAllState<ValueTypes...>, ESPMode::ThreadSafe> &AllState, TIntegerSequence<uint32, Indices...>, const TModioFuture<ValueTypes>&... Futures )
+    {
+      int32 Expand[] = { 0, ( Futures.OnReady( [AllState]( const ValueTypes &Value )
+      {
+        AllState->Values.template Get<Indices>() = Value;
+        if( AllState->Remaining.Decrement() == 0 )
+        {
+          AllState->Finish( TMakeIntegerSequence<uint32, sizeof...( ValueTypes )>() );
+        }
+      }), 0 )... };
+      (void)Expand;
+    }
+  }
+
+  /** Future that is ready with the values of all Futures once they all are ready */
+  template<typename... ValueTypes>
+  TModioFuture<TTuple<ValueTypes...>> WhenAll( const TModioFuture<ValueTypes>&... Futures )
+  {
+    static_assert( sizeof...( ValueTypes ) > 0, "WhenAll needs at least one future" );
+
+    TSharedRef<Private::TWhenAllState<ValueTypes...>, ESPMode::ThreadSafe> AllState = MakeShared<Private::TWhenAllState<ValueTypes...>, ESPMode::ThreadSafe>();
+    TModioFuture<TTuple<ValueTypes...>> Result = AllState->Promise.GetFuture();
+    Private::AttachAll( AllState, TMakeIntegerSequence<uint32, sizeof...( ValueTypes )>(), Futures... );
+    return Result;
+  }
+
+  /** Future that is ready with the values of all Futures in the same order, once they all are ready */
+  template<typename ValueType>
+  TModioFuture<TArray<ValueType>> WhenAll( const TArray<TModioFuture<ValueType>> &Futures )
+  {
+    struct FAllState
+    {
+      TArray<TOptional<ValueType>> Values;
+      FThreadSafeCounter Remaining;
+      TModioPromise<TArray<ValueType>> Promise;
+    };
+
+    if( Futures.Num() == 0 )
+    {
+      return TModioFuture<TArray<ValueType>>::MakeReady( TArray<ValueType>() );
+    }
+
+    TSharedRef<FAllState, ESPMode::ThreadSafe> AllState = MakeShared<FAllState, ESPMode::ThreadSafe>();
+    AllState->Values.SetNum( Futures.Num() );
+    AllState->Remaining.Set( Futures.Num() );
+    TModioFuture<TArray<ValueType>> Result = AllState->Promise.GetFuture();
+
+    for( int32 i = 0; i < Futures.Num(); i++ )
+    {
+      Futures[i].OnReady( [AllState, i]( const ValueType &Value )
+      {
+        AllState->Values[i] = Value;
+        if( AllState->Remaining.Decrement() == 0 )
+        {
+          TArray<ValueType> Values;
+          Values.Reserve( AllState->Values.Num() );
+          for( TOptional<ValueType>& Slot : AllState->Values )
+          {
+            Values.Add( MoveTemp( Slot.GetValue() ) );
+          }
+          AllState->Promise.SetValue( MoveTemp( Values ) );
+        }
+      });
+    }
+    return Result;
+  }
+
+  /** Future that is ready with the index and value of the first of Futures that is ready */
+  template<typename ValueType>
+  TModioFuture<TPair<int32, ValueType>> WhenAny( const TArray<TModioFuture<ValueType>> &Futures )
+  {
+    struct FAnyState
+    {
+      FThreadSafeBool bDone;
+      TModioPromise<TPair<int32, ValueType>> Promise;
+    };
+
+    check( Futures.Num() > 0 );
+
+    TSharedRef<FAnyState, ESPMode::ThreadSafe> AnyState = MakeShared<FAnyState, ESPMode::ThreadSafe>();
+    TModioFuture<TPair<int32, ValueType>> Result = AnyState->Promise.GetFuture();
+
+    for( int32 i = 0; i < Futures.Num(); i++ )
+    {
+      Futures[i].OnReady( [AnyState, i]( const ValueType &Value )
+      {
+        if( !AnyState->bDone.AtomicSet( true ) )
+        {
+          AnyState->Promise.SetValue( TPair<int32, ValueType>( i, Value ) );
+        }
+      });
+    }
+    return Result;
+  }
+
+  namespace Private
+  {
+    inline FModioResponse MakeCancelledResponse()
+    {
+      FModioResponse Response;
+      Response.Code = CancelledCode;
+      Response.ResultCount = 0;
+      Response.ResultLimit = 0;
+      Response.ResultOffset = 0;
+      Response.ResultTotal = 0;
+      Response.ResultCached = false;
+      Response.Error.Code = CancelledCode;
+      Response.Error.Message = TEXT( "The request was cancelled." );
+      return Response;
+    }
+
+    /** Value a future of the type becomes ready with when it's request is cancelled */
+    template<typename ValueType>
+    struct TCancelledValue;
+
+    template<>
+    struct TCancelledValue<FModioResponse>
+    {
+      static FModioResponse Make()
+      {
+        return MakeCancelledResponse();
+      }
+    };
+
+    template<typename ValueType>
+    struct TCancelledValue<TModioResult<ValueType>>
+    {
+      static TModioResult<ValueType> Make()
+      {
+        return TModioResult<ValueType>{ MakeCancelledResponse(), ValueType() };
+      }
+    };
+
+    /**
+     * Shared by the copies of a call's delegate. Cancelled and abandoned requests are destroyed without calling
+     * their delegate, the last copy going away then makes the future ready as cancelled
+     */
+    template<typename ValueType>
+    struct TDelegatePromise
+    {
+      explicit TDelegatePromise( const TModioPromise<ValueType> &InPromise ) :
+        Promise( InPromise )
+      {
+      }
+
+      ~TDelegatePromise()
+      {
+        if( !Promise.GetFuture().IsReady() )
+        {
+          Promise.TrySetValue( TCancelledValue<ValueType>::Make() );
+        }
+      }
+
+      TModioPromise<ValueType> Promise;
+    };
+  }
+
+  /** Delegate that sets Promise with the response it's called with, for calls that only return a response */
+  inline FModioGenericDelegate MakeDelegate( const TModioPromise<FModioResponse> &Promise )
+  {
+    TSharedRef<Private::TDelegatePromise<FModioResponse>, ESPMode::ThreadSafe> Shared = MakeShared<Private::TDelegatePromise<FModioResponse>, ESPMode::ThreadSafe>( Promise );
+    return FModioGenericDelegate::CreateLambda( [Shared]( FModioResponse Response )
+    {
+      Shared->Promise.SetValue( MoveTemp( Response ) );
+    });
+  }
+
+  /** Delegate that sets Promise with the response and value it's called with */
+  template<typename DelegateType, typename ValueType>
+  DelegateType MakeDelegate( const TModioPromise<TModioResult<ValueType>> &Promise )
+  {
+    TSharedRef<Private::TDelegatePromise<TModioResult<ValueType>>, ESPMode::ThreadSafe> Shared = MakeShared<Private::TDelegatePromise<TModioResult<ValueType>>, ESPMode::ThreadSafe>( Promise );
+    return DelegateType::CreateLambda( [Shared]( FModioResponse Response, const ValueType &Value )
+    {
+      Shared->Promise.SetValue( TModioResult<ValueType>{ MoveTemp( Response ), Value } );
+    });
+  }
+}
+
+typedef TModioFuture<FModioResponse> FModioResponseFuture;
+typedef TModioFuture<TModioResult<FModioGame>> FModioGameFuture;
+typedef TModioFuture<TModioResult<FModioMod>> FModioModFuture;
+typedef TModioFuture<TModioResult<TArray<FModioMod>>> FModioModArrayFuture;
+typedef TModioFuture<TModioResult<TArray<FModioModfile>>> FModioModfileArrayFuture;
+typedef TModioFuture<TModioResult<TArray<FModioModDependency>>> FModioModDependencyArrayFuture;
+typedef TModioFuture<TModioResult<TArray<FModioModTag>>> FModioModTagArrayFuture;
+typedef TModioFuture<TModioResult<TArray<FModioMetadataKVP>>> FModioMetadataKVPArrayFuture;
+typedef TModioFuture<TModioResult<FModioUser>> FModioUserFuture;
+typedef TModioFuture<TModioResult<TArray<FModioUserEvent>>> FModioUserEventArrayFuture;
+typedef TModioFuture<TModioResult<TArray<FModioRating>>> FModioRatingArrayFuture;
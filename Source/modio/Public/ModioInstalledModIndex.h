@@ -0,0 +1,112 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+struct ModioInstalledMod;
+
+/** What happened to an installed mod */
+enum class EModioInstalledModChange : uint8
+{
+  Installed,
+  /** Another modfile, date or path */
+  Updated,
+  Uninstalled
+};
+
+/** What is needed to list and load an installed mod, without converting the rest of it */
+struct FModioInstalledModSummary
+{
+  int32 ModId = 0;
+  int32 ModfileId = 0;
+  int32 DateUpdated = 0;
+  FString Path;
+  FString Name;
+  FString NameId;
+  FString Summary;
+  FString LogoThumb320x180;
+  FString Version;
+  int64 Filesize = 0;
+};
+
+/** Fills Out from the SDK's installed mod, returns false if it's the empty entry of a mod that isn't installed */
+MODIO_API bool InitializeInstalledModSummary( FModioInstalledModSummary& Out, const ModioInstalledMod& InstalledMod );
+
+/** Installed mods at one point in time, never changes once published so it can be kept and read from any thread */
+class MODIO_API FModioInstalledModSnapshot
+{
+public:
+  int32 Num() const
+  {
+    return Mods.Num();
+  }
+
+  /** Null if the mod wasn't installed */
+  const FModioInstalledModSummary* Find( int32 ModId ) const
+  {
+    const int32* Index = IndexByModId.Find( ModId );
+    return Index ? &Mods[*Index] : nullptr;
+  }
+
+  /** Ordered by mod id */
+  const TArray<FModioInstalledModSummary>& GetMods() const
+  {
+    return Mods;
+  }
+
+private:
+  friend class FModioInstalledModIndex;
+
+  TArray<FModioInstalledModSummary> Mods;
+  TMap<int32, int32> IndexByModId;
+};
+
+typedef TSharedRef<const FModioInstalledModSnapshot, ESPMode::ThreadSafe> FModioInstalledModSnapshotRef;
+
+DECLARE_DELEGATE_TwoParams( FModioInstalledModChangedDelegate, int32 /*ModId*/, EModioInstalledModChange /*Change*/ );
+DECLARE_MULTICAST_DELEGATE_TwoParams( FModioInstalledModChangedEvent, int32 /*ModId*/, EModioInstalledModChange /*Change*/ );
+
+/**
+ * The installed mods by id. Changes publish a new snapshot instead of touching the current one, so readers
+ * only pay for a shared pointer copy. Changes and listeners are game thread only, snapshots can be taken
+ * from any thread
+ */
+class MODIO_API FModioInstalledModIndex
+{
+public:
+  FModioInstalledModIndex();
+
+  FModioInstalledModSnapshotRef GetSnapshot() const;
+
+  /** Replaces every mod, notifying the ones that were installed, updated or uninstalled since */
+  void Reset( TArray<FModioInstalledModSummary>&& Mods );
+
+  /** Adds or replaces one mod, notifying only if it changed */
+  void Update( FModioInstalledModSummary&& Mod );
+
+  void Remove( int32 ModId );
+
+  /** Listens to the changes of one mod */
+  FDelegateHandle AddListener( int32 ModId, FModioInstalledModChangedDelegate Delegate );
+
+  /** Listens to the changes of every mod */
+  FDelegateHandle AddListener( FModioInstalledModChangedDelegate Delegate );
+
+  void RemoveListener( FDelegateHandle Handle );
+
+private:
+  /** Sorts the mods, rebuilds their lookup and makes them the current snapshot */
+  void Publish( TSharedRef<FModioInstalledModSnapshot, ESPMode::ThreadSafe> Snapshot );
+
+  void Notify( int32 ModId, EModioInstalledModChange Change );
+
+  /** Only guards swapping the snapshot pointer */
+  mutable FCriticalSection SnapshotCriticalSection;
+  FModioInstalledModSnapshotRef Snapshot;
+
+  TMap<int32, FModioInstalledModChangedEvent> ModListeners;
+  FModioInstalledModChangedEvent AnyModListeners;
+};
@@ -0,0 +1,47 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "c/ModioC.h"
+
+/**
+ * Deep copy of the mods of an SDK response, taken in the response while the SDK lock is held so they can be
+ * converted once it's released. The copies are plain ModioMods pointing into a few blocks the copy owns, so
+ * InitializeMod and ConvertToTArrayMods take them as they are
+ */
+class MODIO_API FModioModArrayCopy
+{
+public:
+  FModioModArrayCopy( const ModioMod* ModioMods, u32 ModioModsSize );
+  FModioModArrayCopy( const FModioModArrayCopy& Other ) = delete;
+  FModioModArrayCopy& operator=( const FModioModArrayCopy& Other ) = delete;
+
+  ModioMod* GetData()
+  {
+    return Mods.GetData();
+  }
+
+  u32 Num() const
+  {
+    return (u32)Mods.Num();
+  }
+
+private:
+  /** Points the strings and arrays of a mod copied member by member into our blocks */
+  void CopyMod( ModioMod& Mod );
+  void CopyString( char*& String );
+  void CopyStrings( char**& Strings, u32 Size );
+  template<typename ElementType>
+  void CopyArray( ElementType*& Array, u32 Size );
+
+  void* Allocate( SIZE_T Size, SIZE_T Alignment );
+
+  static const SIZE_T BlockSize = 16 * 1024;
+
+  TArray<ModioMod> Mods;
+  TArray<TUniquePtr<uint8[]>> Blocks;
+  uint8* BlockCursor;
+  uint8* BlockEnd;
+};
@@ -0,0 +1,132 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Schemas/ModioMod.h"
+#include "Enums/ModioModSortType.h"
+#include "ModioModTagIndex.h"
+#include "ModioModSearchIndex.h"
+#include "ModioModMetadataIndex.h"
+
+/** Constraints for FModioModCatalog::Filter, the defaults let every mod through */
+struct FModioModCatalogFilter
+{
+  /** Only mods of this game, 0 is any game */
+  int32 GameId = 0;
+  int32 MinDateAdded = MIN_int32;
+  int32 MaxDateAdded = MAX_int32;
+  int32 MinDateUpdated = MIN_int32;
+  int32 MaxDateUpdated = MAX_int32;
+  int32 MinDateLive = MIN_int32;
+  int32 MaxDateLive = MAX_int32;
+  int32 MinDownloads = 0;
+  int32 MinSubscribers = 0;
+  /** Minimum weighted rating aggregate, from 0 to 1 */
+  float MinRating = 0.0f;
+  /** Mods with any of these maturity flags are left out */
+  int32 ExcludedMaturityOptions = 0;
+  bool bVisibleOnly = false;
+  /** Tags the mods must, may or can't have */
+  FModioTagQuery Tags;
+};
+
+/**
+ * Local store of full mod records, with the fields used for sorting and filtering kept in their own
+ * contiguous arrays so a pass over thousands of mods only touches the memory it compares. Each mod keeps
+ * it's index until it's removed, sort and filter hand out indices to read the full record with GetMod.
+ * Not thread safe, the subsystem's catalog is used on the game thread
+ */
+class MODIO_API FModioModCatalog
+{
+public:
+  /** Adds the mod, or replaces the record with the same id */
+  void AddOrUpdate( const FModioMod& Mod );
+  void AddOrUpdate( TArrayView<const FModioMod> Mods );
+
+  /** Returns false if the mod wasn't in the catalog */
+  bool Remove( int32 ModId );
+
+  void Reset();
+
+  /** Amount of mods in the catalog */
+  int32 Num() const;
+
+  /** Index of the mod, INDEX_NONE if it's not in the catalog */
+  int32 FindIndex( int32 ModId ) const;
+
+  bool IsValidIndex( int32 Index ) const;
+
+  /** Full record of the mod at Index */
+  const FModioMod& GetMod( int32 Index ) const;
+
+  /** Indices of every mod in the catalog */
+  void GetAllIndices( TArray<int32>& OutIndices ) const;
+
+  /** Indices of the mods matching Filter, in index order */
+  void Filter( const FModioModCatalogFilter& Filter, TArray<int32>& OutIndices ) const;
+
+  /** Sorts the indices by the field, mods that compare equal are kept in index order */
+  void Sort( TArray<int32>& Indices, EModioModSortType SortType, bool bAscending ) const;
+
+  /** Indices of the mods best matching the typed Text, best first, at most MaxResults of them, 0 is no limit */
+  void Search( const FString& Text, int32 MaxResults, TArray<int32>& OutIndices ) const;
+
+  /** Indices of the mods having the metadata pair, in index order */
+  void FindByMetadata( const FString& Key, const FString& Value, TArray<int32>& OutIndices ) const;
+
+  /** Indices of the mods with a numeric value of the metadata key between Min and Max, lowest value first */
+  void FindByMetadataRange( const FString& Key, double Min, double Max, TArray<int32>& OutIndices ) const;
+
+  /** Bytes allocated by the search index */
+  SIZE_T GetSearchIndexSize() const;
+
+  /** Gives the tag options of the game ids up front, see FModioModTagIndex */
+  void RegisterTagOptions( const TArray<FModioGameTagOption>& TagOptions );
+
+  /**
+   * Marks the catalog as holding every mod of the game, so a filter it answers is the same the server would
+   * answer. It's cleared by Reset, set it after paging through all mods of the game
+   */
+  void SetComplete( bool bInComplete );
+  bool IsComplete() const;
+
+private:
+  /** Reuses a free slot or grows the arrays */
+  int32 AllocateSlot();
+
+  /** Copies the sortable fields of the mod to it's slot */
+  void WriteColumns( int32 Index, const FModioMod& Mod );
+
+  TArray<int32> Ids;
+  TArray<int32> GameIds;
+  TArray<int32> DatesAdded;
+  TArray<int32> DatesUpdated;
+  TArray<int32> DatesLive;
+  TArray<int32> Downloads;
+  TArray<int32> Subscribers;
+  TArray<int32> PopularityRanks;
+  TArray<float> Ratings;
+  TArray<int32> MaturityOptions;
+  TArray<uint8> Visible;
+  /** 1 for slots holding a mod, 0 for removed ones */
+  TArray<uint8> Live;
+
+  /** Full records, in the same slots as the columns */
+  TArray<FModioMod> Records;
+
+  /** Tags of the mods, by slot */
+  FModioModTagIndex TagIndex;
+
+  /** Words of the mods, by slot */
+  FModioModSearchIndex SearchIndex;
+
+  /** Metadata key value pairs of the mods, by slot */
+  FModioModMetadataIndex MetadataIndex;
+
+  TMap<int32, int32> IndexById;
+  TArray<int32> FreeSlots;
+
+  bool bComplete = false;
+};
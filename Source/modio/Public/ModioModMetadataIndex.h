@@ -0,0 +1,44 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Schemas/ModioMetadataKVP.h"
+
+/**
+ * Which catalog slots have which metadata key value pairs. Values are hashed per key for exact lookups, and
+ * the numeric ones are also kept sorted per key for range lookups. Keys and values are compared ignoring
+ * case. Not thread safe
+ */
+class MODIO_API FModioModMetadataIndex
+{
+public:
+  /** Replaces the pairs of the slot */
+  void SetSlotMetadata( int32 Slot, const TArray<FModioMetadataKVP>& MetadataKVP );
+
+  /** Removes every pair of the slot */
+  void ClearSlot( int32 Slot );
+
+  void Reset();
+
+  /** Slots having the pair, in no particular order */
+  void Find( const FString& Key, const FString& Value, TArray<int32>& OutSlots ) const;
+
+  /** Slots with a numeric value of the key between Min and Max, inclusive, lowest value first */
+  void FindInRange( const FString& Key, double Min, double Max, TArray<int32>& OutSlots ) const;
+
+private:
+  struct FKeyEntry
+  {
+    TMap<FString, TArray<int32>> SlotsByValue;
+    /** Numeric values of the key with their slot, sorted by value on the next range lookup */
+    mutable TArray<TPair<double, int32>> NumericValues;
+    mutable bool bNumericValuesDirty = false;
+  };
+
+  TMap<FString, FKeyEntry> Keys;
+
+  /** Pairs each slot has set, to clear them when the slot changes */
+  TArray<TArray<FModioMetadataKVP>> SlotMetadata;
+};
@@ -0,0 +1,68 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Schemas/ModioMod.h"
+
+/** A slot matching a search, higher scores rank first */
+struct FModioSearchHit
+{
+  int32 Slot;
+  int32 Score;
+};
+
+/**
+ * Inverted index from the words of a mod's name, name id, summary, tags and submitter to the catalog slots
+ * having them. Each query word matches every indexed word it's a prefix of, so it can run on every key press.
+ * A mod has to match all query words, and scores by the field each word was found in, whole words counting
+ * double. Not thread safe
+ */
+class MODIO_API FModioModSearchIndex
+{
+public:
+  /** Replaces the words of the slot with the ones of Mod */
+  void SetSlot( int32 Slot, const FModioMod& Mod );
+
+  /** Removes every word of the slot */
+  void ClearSlot( int32 Slot );
+
+  void Reset();
+
+  /** Best matches of Text, at most MaxResults of them, 0 is no limit */
+  void Search( const FString& Text, int32 MaxResults, TArray<FModioSearchHit>& OutHits ) const;
+
+  /** Bytes allocated by the index */
+  SIZE_T GetAllocatedSize() const;
+
+  /** Lower case words of Text, split on anything that isn't a letter or a digit */
+  static void Tokenize( const FString& Text, TArray<FString>& OutWords );
+
+private:
+  struct FPosting
+  {
+    int32 Slot;
+    /** Weight of the best field the word was found in */
+    int32 Weight;
+  };
+
+  void AddWords( int32 Slot, const FString& Text, int32 Weight );
+  int32 FindOrAddWordId( const FString& Word );
+
+  /** Sorts SortedWordIds if words were added since the last search */
+  void SortWords() const;
+
+  TArray<FString> Words;
+  TMap<FString, int32> IdsByWord;
+  /** Slots having each word */
+  TArray<TArray<FPosting>> Postings;
+  /** Word ids each slot has, to clear them when the slot changes */
+  TArray<TArray<int32>> SlotWordIds;
+
+  /** Word ids in word order, for finding the words starting with a prefix */
+  mutable TArray<int32> SortedWordIds;
+  mutable bool bSortedWordsDirty = false;
+};
+
+DECLARE_DELEGATE_ThreeParams( FModioModSearchDelegate, FModioResponse, const TArray<FModioMod> &, bool /*bFromServer*/ );
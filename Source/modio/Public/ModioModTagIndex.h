@@ -0,0 +1,78 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Schemas/ModioModTag.h"
+#include "Schemas/ModioGameTagOption.h"
+
+/** Tag constraints of a catalog query, empty lists don't constrain anything. Tags are case sensitive */
+struct FModioTagQuery
+{
+  /** Mods must have every one of these tags */
+  TArray<FString> AllOf;
+  /** Mods must have at least one of these tags */
+  TArray<FString> AnyOf;
+  /** Mods can't have any of these tags */
+  TArray<FString> NoneOf;
+
+  bool IsEmpty() const
+  {
+    return !AllOf.Num() && !AnyOf.Num() && !NoneOf.Num();
+  }
+};
+
+/**
+ * Which catalog slots have which tag. Every tag gets an id and a bitmap with a bit per slot, so a query is a
+ * handful of AND, OR and AND NOT passes over 64 slots per word, whatever the amount of tags mods have
+ */
+class MODIO_API FModioModTagIndex
+{
+public:
+  /** Gives the tags of the game ids in the order they are listed, call it before adding mods to keep ids stable */
+  void RegisterTagOptions( const TArray<FModioGameTagOption>& TagOptions );
+
+  /** Id of the tag, INDEX_NONE if no mod or tag option had it yet */
+  int32 FindTagId( const FString& Tag ) const;
+
+  /** Replaces the tags of the slot */
+  void SetSlotTags( int32 Slot, const TArray<FModioModTag>& Tags );
+
+  /** Removes every tag of the slot */
+  void ClearSlot( int32 Slot );
+
+  void Reset();
+
+  /** Sets a bit in OutWords for every slot below NumSlots matching Query */
+  void Evaluate( const FModioTagQuery& Query, int32 NumSlots, TArray<uint64>& OutWords ) const;
+
+private:
+  int32 FindOrAddTagId( const FString& Tag );
+
+  /** The backend tells tags apart by case, so the index does too */
+  struct FCaseSensitiveKeyFuncs : BaseKeyFuncs<TPair<FString, int32>, FString, false>
+  {
+    static const FString& GetSetKey( const TPair<FString, int32>& Element )
+    {
+      return Element.Key;
+    }
+
+    static bool Matches( const FString& A, const FString& B )
+    {
+      return A.Equals( B, ESearchCase::CaseSensitive );
+    }
+
+    static uint32 GetKeyHash( const FString& Key )
+    {
+      return FCrc::StrCrc32( *Key );
+    }
+  };
+
+  /** Bit per slot, only as long as the highest slot that had the tag */
+  TArray<TArray<uint64>> Bitmaps;
+  TMap<FString, int32, FDefaultSetAllocator, FCaseSensitiveKeyFuncs> IdsByTag;
+
+  /** Tag ids each slot has set, to clear them when the slot changes */
+  TArray<TArray<int32>> SlotTagIds;
+};
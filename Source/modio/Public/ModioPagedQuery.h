@@ -0,0 +1,226 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+#include "AsyncRequest/ModioAsyncRequestHandle.h"
+#include "Schemas/ModioResponse.h"
+#include "Schemas/ModioMod.h"
+#include "Schemas/ModioUserEvent.h"
+#include "Schemas/ModioRating.h"
+
+/**
+ * Cursor over a paginated listing. Each page is handed to the page delegate as soon as it arrives, and
+ * before that the following pages are requested so they are already on the way while the caller works
+ * on the current one. Up to MaxPagesInFlight pages are requested at the same time once the total is
+ * known from the first response. The complete delegate fires once with the last response when all
+ * pages arrived or when a page failed. Pages can arrive out of order when fetching in parallel, use
+ * ResultOffset on the response to place them.
+ *
+ * The query stops when Cancel is called or when the last reference to it is dropped, and the pages
+ * still in flight are cancelled so they don't get converted.
+ */
+template<typename ElementType, typename PageDelegateType>
+class TModioPagedQuery : public TSharedFromThis<TModioPagedQuery<ElementType, PageDelegateType>, ESPMode::Fast>
+{
+public:
+  /** Requests a page, returns an invalid handle if the page can't be requested */
+  typedef TFunction<FModioAsyncRequestHandle( int32 Limit, int32 Offset, PageDelegateType PageDelegate )> FIssuePageFunction;
+  /** Cancels a page request that is in flight */
+  typedef TFunction<void( const FModioAsyncRequestHandle &Handle )> FCancelPageFunction;
+
+  /** Largest page the backend returns */
+  static const int32 MaxPageSize = 100;
+
+  static TSharedRef<TModioPagedQuery, ESPMode::Fast> Create( FIssuePageFunction IssuePage, FCancelPageFunction CancelPage, int32 StartOffset, int32 PageSize, int32 MaxPagesInFlight, PageDelegateType PageDelegate, FModioGenericDelegate CompleteDelegate )
+  {
+    return MakeShareable( new TModioPagedQuery( MoveTemp( IssuePage ), MoveTemp( CancelPage ), StartOffset, PageSize, MaxPagesInFlight, PageDelegate, CompleteDelegate ) );
+  }
+
+  ~TModioPagedQuery()
+  {
+    Cancel();
+  }
+
+  /** Requests the first page, the rest is requested as the responses come in */
+  void Start()
+  {
+    if( bStarted )
+    {
+      return;
+    }
+    bStarted = true;
+    IssuePages();
+  }
+
+  /** Stops requesting pages, pages still in flight are cancelled and the complete delegate won't fire */
+  void Cancel()
+  {
+    bCancelled = true;
+    CancelInFlightPages();
+  }
+
+  bool IsCancelled() const
+  {
+    return bCancelled;
+  }
+
+  bool IsFinished() const
+  {
+    return bFinished;
+  }
+
+  /** Total amount of results reported by the backend, INDEX_NONE until the first page arrived */
+  int32 GetResultTotal() const
+  {
+    return ResultTotal;
+  }
+
+  /** Amount of results handed to the page delegate so far */
+  int32 GetNumReceived() const
+  {
+    return NumReceived;
+  }
+
+private:
+  TModioPagedQuery( FIssuePageFunction InIssuePage, FCancelPageFunction InCancelPage, int32 InStartOffset, int32 InPageSize, int32 InMaxPagesInFlight, PageDelegateType InPageDelegate, FModioGenericDelegate InCompleteDelegate ) :
+    IssuePage( MoveTemp( InIssuePage ) ),
+    CancelPage( MoveTemp( InCancelPage ) ),
+    PageDelegate( InPageDelegate ),
+    CompleteDelegate( InCompleteDelegate ),
+    PageSize( FMath::Clamp( InPageSize, 1, MaxPageSize ) ),
+    MaxPagesInFlight( FMath::Max( InMaxPagesInFlight, 1 ) ),
+    NextOffset( FMath::Max( InStartOffset, 0 ) ),
+    ResultTotal( INDEX_NONE ),
+    NumReceived( 0 ),
+    bStarted( false ),
+    bCancelled( false ),
+    bFinished( false )
+  {
+  }
+
+  void IssuePages()
+  {
+    while( !bCancelled && !bFinished && InFlightPages.Num() < MaxPagesInFlight )
+    {
+      if( ResultTotal == INDEX_NONE )
+      {
+        // Until the first page tells us the total we don't know if there is anything more to fetch
+        if( InFlightPages.Num() > 0 )
+        {
+          break;
+        }
+      }
+      else if( NextOffset >= ResultTotal )
+      {
+        break;
+      }
+
+      int32 Offset = NextOffset;
+      NextOffset += PageSize;
+
+      // Added before issuing, the page might be answered right away
+      InFlightPages.Add( TPair<int32, FModioAsyncRequestHandle>( Offset, FModioAsyncRequestHandle() ) );
+      FModioAsyncRequestHandle Handle = IssuePage( PageSize, Offset, PageDelegateType::CreateSP( this->AsShared(), &TModioPagedQuery::HandlePage, Offset ) );
+      if( !Handle.IsValid() )
+      {
+        Cancel();
+        break;
+      }
+
+      if( TPair<int32, FModioAsyncRequestHandle>* Page = FindInFlightPage( Offset ) )
+      {
+        Page->Value = Handle;
+      }
+    }
+  }
+
+  TPair<int32, FModioAsyncRequestHandle>* FindInFlightPage( int32 Offset )
+  {
+    return InFlightPages.FindByPredicate( [Offset]( const TPair<int32, FModioAsyncRequestHandle>& Page ) { return Page.Key == Offset; } );
+  }
+
+  void HandlePage( FModioResponse Response, const TArray<ElementType> &Page, int32 Offset )
+  {
+    if( bCancelled || bFinished )
+    {
+      return;
+    }
+    InFlightPages.RemoveAll( [Offset]( const TPair<int32, FModioAsyncRequestHandle>& InFlightPage ) { return InFlightPage.Key == Offset; } );
+
+    if( Response.Code < 200 || Response.Code >= 300 )
+    {
+      // The pages prefetched past this one would only come back after the query is done
+      bFinished = true;
+      CancelInFlightPages();
+      PageDelegate.ExecuteIfBound( Response, Page );
+      Finish( Response );
+      return;
+    }
+
+    ResultTotal = Response.ResultTotal;
+    if( Page.Num() < PageSize )
+    {
+      // A short page is the end of the listing, even if the total changed while we were paging
+      ResultTotal = FMath::Min( ResultTotal, Response.ResultOffset + Page.Num() );
+    }
+    NumReceived += Page.Num();
+
+    // Prefetch before handing out the page, so the round trip overlaps with the caller's work
+    IssuePages();
+
+    PageDelegate.ExecuteIfBound( Response, Page );
+
+    if( !bCancelled && !bFinished && InFlightPages.Num() == 0 && NextOffset >= ResultTotal )
+    {
+      Finish( Response );
+    }
+  }
+
+  void CancelInFlightPages()
+  {
+    TArray<TPair<int32, FModioAsyncRequestHandle>> PagesToCancel = MoveTemp( InFlightPages );
+    InFlightPages.Reset();
+    for( const TPair<int32, FModioAsyncRequestHandle>& Page : PagesToCancel )
+    {
+      if( Page.Value.IsValid() )
+      {
+        CancelPage( Page.Value );
+      }
+    }
+  }
+
+  void Finish( const FModioResponse &Response )
+  {
+    bFinished = true;
+    CompleteDelegate.ExecuteIfBound( Response );
+  }
+
+  FIssuePageFunction IssuePage;
+  FCancelPageFunction CancelPage;
+  PageDelegateType PageDelegate;
+  FModioGenericDelegate CompleteDelegate;
+
+  int32 PageSize;
+  int32 MaxPagesInFlight;
+  int32 NextOffset;
+  int32 ResultTotal;
+  int32 NumReceived;
+
+  uint8 bStarted : 1;
+  uint8 bCancelled : 1;
+  uint8 bFinished : 1;
+
+  /** Offsets and requests of the pages we are waiting for */
+  TArray<TPair<int32, FModioAsyncRequestHandle>> InFlightPages;
+};
+
+typedef TModioPagedQuery<FModioMod, FModioModArrayDelegate> FModioPagedModQuery;
+typedef TModioPagedQuery<FModioUserEvent, FModioUserEventArrayDelegate> FModioPagedUserEventQuery;
+typedef TModioPagedQuery<FModioRating, FModioRatingArrayDelegate> FModioPagedRatingQuery;
+
+typedef TSharedRef<FModioPagedModQuery, ESPMode::Fast> FModioPagedModQueryRef;
+typedef TSharedRef<FModioPagedUserEventQuery, ESPMode::Fast> FModioPagedUserEventQueryRef;
+typedef TSharedRef<FModioPagedRatingQuery, ESPMode::Fast> FModioPagedRatingQueryRef;
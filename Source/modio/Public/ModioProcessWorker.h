@@ -0,0 +1,35 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Templates/Function.h"
+
+/**
+ * Drives modioProcess on it's own thread, so network, json and zip work done by the SDK doesn't
+ * take frame time. Process runs modioProcess holding the SDK lock, as the SDK isn't thread safe,
+ * and converts the responses after releasing it
+ */
+class FModioProcessWorker : public FRunnable
+{
+public:
+  FModioProcessWorker( TFunction<void()> Process );
+  FModioProcessWorker(const FModioProcessWorker& Other) = delete;
+  FModioProcessWorker& operator=(const FModioProcessWorker& Other) = delete;
+  virtual ~FModioProcessWorker();
+
+  // FRunnable
+  virtual uint32 Run() override;
+  virtual void Stop() override;
+
+private:
+  /** How long to sleep between modioProcess calls */
+  static const float ProcessInterval;
+
+  TFunction<void()> Process;
+  FThreadSafeCounter StopRequested;
+  class FRunnableThread* Thread;
+};
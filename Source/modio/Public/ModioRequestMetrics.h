@@ -0,0 +1,108 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Timestamps of a single request, in FPlatformTime::Seconds, 0 until reached */
+struct FModioRequestTimings
+{
+  FModioRequestTimings() :
+    Endpoint( TEXT( "Unknown" ) ),
+    CreateTime( 0.0 ),
+    IssueTime( 0.0 ),
+    ResponseTime( 0.0 ),
+    ConvertedTime( 0.0 ),
+    ResponseCode( 0 ),
+    NumResults( 0 )
+  {
+  }
+
+  /** Subsystem call that created the request */
+  const TCHAR* Endpoint;
+  /** When the request was created */
+  double CreateTime;
+  /** When the request was sent to the SDK, after waiting for a slot or for it's batch */
+  double IssueTime;
+  /** When the SDK answered */
+  double ResponseTime;
+  /** When the response was converted and handed over for dispatch */
+  double ConvertedTime;
+  int32 ResponseCode;
+  /** Result count the backend reported */
+  int32 NumResults;
+};
+
+/** Percentiles of a measured time, in milliseconds */
+struct FModioLatencyPercentiles
+{
+  float P50 = 0.0f;
+  float P95 = 0.0f;
+  float P99 = 0.0f;
+  float Max = 0.0f;
+};
+
+/**
+ * Where the time of the requests to a single endpoint went. Wait is from creating the request until it was
+ * sent to the SDK, Network until the SDK answered, Conversion until the response was converted, Queue until
+ * it's delegates started running on the game thread and Dispatch is the time spent in the delegates
+ */
+struct FModioEndpointMetrics
+{
+  FName Endpoint;
+  int32 NumRequests = 0;
+  /** Requests answered with a code outside of the 2xx range */
+  int32 NumFailed = 0;
+  int64 NumResults = 0;
+  FModioLatencyPercentiles Wait;
+  FModioLatencyPercentiles Network;
+  FModioLatencyPercentiles Conversion;
+  FModioLatencyPercentiles Queue;
+  FModioLatencyPercentiles Dispatch;
+};
+
+/**
+ * Per endpoint histograms of finished requests. Times are put in buckets a quarter octave wide so recording
+ * is constant time and memory, percentiles are accurate to about 20%. Game thread only
+ */
+class MODIO_API FModioRequestMetrics
+{
+public:
+  /** Records a request that finished dispatching, DispatchStart and DispatchEnd surround the delegate calls */
+  void Record( const FModioRequestTimings &Timings, double DispatchStart, double DispatchEnd );
+
+  TArray<FModioEndpointMetrics> GetMetrics() const;
+
+  void Reset();
+
+private:
+  /** Quarter octaves from 1 microsecond up to about two minutes */
+  static const int32 NumBuckets = 108;
+
+  struct FHistogram
+  {
+    FHistogram();
+
+    void Add( double Seconds );
+    FModioLatencyPercentiles GetPercentiles() const;
+
+    int32 Buckets[NumBuckets];
+    int32 NumSamples;
+    double MaxSeconds;
+  };
+
+  struct FEndpoint
+  {
+    int32 NumRequests = 0;
+    int32 NumFailed = 0;
+    int64 NumResults = 0;
+    FHistogram Wait;
+    FHistogram Network;
+    FHistogram Conversion;
+    FHistogram Queue;
+    FHistogram Dispatch;
+  };
+
+  TMap<FName, FEndpoint> Endpoints;
+};
@@ -0,0 +1,213 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/List.h"
+#include "UObject/Class.h"
+#include "Schemas/ModioResponse.h"
+
+struct FModioMod;
+struct FModioGame;
+struct FModioModfile;
+struct FModioModTag;
+struct FModioModDependency;
+
+/** Counters of the response cache since startup */
+struct FModioResponseCacheStats
+{
+  int64 Hits = 0;
+  /** Hits on expired responses handed out while a fresh one is fetched, also counted in Hits */
+  int64 StaleHits = 0;
+  int64 Misses = 0;
+  /** Entries dropped to stay within the budget, expired entries aren't counted */
+  int64 Evictions = 0;
+  /** Estimated memory held by the entries */
+  int64 Bytes = 0;
+  int32 NumEntries = 0;
+};
+
+/** Estimated memory of a converted response, including what it allocated */
+MODIO_API SIZE_T ModioCacheSize( const FModioMod& Mod );
+MODIO_API SIZE_T ModioCacheSize( const FModioGame& Game );
+MODIO_API SIZE_T ModioCacheSize( const FModioModfile& Modfile );
+MODIO_API SIZE_T ModioCacheSize( const FModioModTag& ModTag );
+MODIO_API SIZE_T ModioCacheSize( const FModioModDependency& ModDependency );
+
+template<typename ElementType>
+SIZE_T ModioCacheSize( const TArray<ElementType>& Array )
+{
+  SIZE_T Size = sizeof( Array ) + Array.GetAllocatedSize();
+  for( const ElementType& Element : Array )
+  {
+    Size += ModioCacheSize( Element ) - sizeof( ElementType );
+  }
+  return Size;
+}
+
+/** Are two converted responses the same, compares every property */
+template<typename StructType>
+bool ModioIsSameValue( const StructType& A, const StructType& B )
+{
+  return StructType::StaticStruct()->CompareScriptStruct( &A, &B, PPF_None );
+}
+
+template<typename ElementType>
+bool ModioIsSameValue( const TArray<ElementType>& A, const TArray<ElementType>& B )
+{
+  if( A.Num() != B.Num() )
+  {
+    return false;
+  }
+  for( int32 i = 0; i < A.Num(); i++ )
+  {
+    if( !ModioIsSameValue( A[i], B[i] ) )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Converted responses of idempotent reads, keyed by the request's canonical key so identical queries hit the
+ * same entry however their filters were built. Entries live for the time to live of their endpoint and the
+ * least recently used ones are dropped once the estimated memory goes over the budget. Values are shared, a
+ * hit hands out the cached value without copying it. Endpoints without a time to live aren't cached, and
+ * nothing is cached while the budget is 0. Game thread only
+ */
+class MODIO_API FModioResponseCache
+{
+public:
+  FModioResponseCache();
+
+  /** Most estimated memory the entries can hold, 0 disables the cache and empties it */
+  void SetBudget( int64 Bytes );
+
+  /** How long responses of the endpoint stay valid, 0 stops caching it and drops it's entries */
+  void SetTimeToLive( FName Endpoint, double Seconds );
+
+  /**
+   * How long expired responses of the endpoint can still be handed out as stale while a fresh one is
+   * fetched, 0 drops them once they expire
+   */
+  void SetStaleTime( FName Endpoint, double Seconds );
+
+  /** Are responses of the endpoint cached */
+  bool IsEnabled( FName Endpoint ) const;
+
+  /**
+   * Cached value for the key, null on a miss. OutResponse is the cached response with ResultCached set. Stale
+   * values are only found when bOutStale is given, it tells if the value is stale
+   */
+  template<typename ValueType>
+  TSharedPtr<const ValueType> Find( FName Endpoint, const FString& Key, FModioResponse& OutResponse, bool* bOutStale = nullptr );
+
+  /**
+   * Shares Value and caches it if the endpoint is cached and the response was successful. Returns the shared
+   * value either way, so the caller can dispatch it without a copy
+   */
+  template<typename ValueType>
+  TSharedRef<const ValueType> Add( FName Endpoint, const FString& Key, const FModioResponse& Response, ValueType Value );
+
+  /** Drops the entry of the key, if there is one */
+  void Remove( const FString& Key );
+
+  /** Drops every entry whose key starts with Prefix */
+  void RemoveByPrefix( const FString& Prefix );
+
+  void Reset();
+
+  const FModioResponseCacheStats& GetStats() const
+  {
+    return Stats;
+  }
+
+private:
+  typedef TDoubleLinkedList<uint64> FLruList;
+
+  struct FEntry
+  {
+    /** Full key, two keys can hash the same */
+    FString Key;
+    FName Endpoint;
+    FModioResponse Response;
+    TSharedPtr<const void> Value;
+    /** Type the value was added as */
+    const void* TypeId;
+    double ExpireTime;
+    int64 Bytes;
+    /** Our node in Lru */
+    FLruList::TDoubleLinkedListNode* LruNode;
+  };
+
+  /** Unique per value type, so a value is never read back as another type */
+  template<typename ValueType>
+  static const void* GetTypeId()
+  {
+    static const uint8 Id = 0;
+    return &Id;
+  }
+
+  static uint64 HashKey( const FString& Key );
+
+  /**
+   * Live entry of the key, dropping it once it's past it's stale time. Expired entries are only found with
+   * bAllowStale. Counts the hit or miss and marks the entry used
+   */
+  const FEntry* FindEntry( FName Endpoint, const FString& Key, const void* TypeId, bool bAllowStale, bool& bOutStale );
+
+  void AddEntry( FName Endpoint, const FString& Key, const FModioResponse& Response, TSharedPtr<const void> Value, const void* TypeId, int64 ValueBytes );
+
+  void RemoveEntry( uint64 Hash );
+
+  /** Drops least recently used entries until we are within the budget */
+  void EvictOverBudget();
+
+  void UpdateStats();
+
+  TMap<uint64, FEntry> Entries;
+
+  /** Hashes of the entries, most recently used first */
+  FLruList Lru;
+
+  TMap<FName, double> TimesToLive;
+
+  TMap<FName, double> StaleTimes;
+
+  int64 Budget;
+
+  FModioResponseCacheStats Stats;
+};
+
+template<typename ValueType>
+TSharedPtr<const ValueType> FModioResponseCache::Find( FName Endpoint, const FString& Key, FModioResponse& OutResponse, bool* bOutStale )
+{
+  bool bStale = false;
+  const FEntry* Entry = FindEntry( Endpoint, Key, GetTypeId<ValueType>(), bOutStale != nullptr, bStale );
+  if( !Entry )
+  {
+    return nullptr;
+  }
+
+  if( bOutStale )
+  {
+    *bOutStale = bStale;
+  }
+
+  OutResponse = Entry->Response;
+  OutResponse.ResultCached = true;
+  return StaticCastSharedPtr<const ValueType>( Entry->Value );
+}
+
+template<typename ValueType>
+TSharedRef<const ValueType> FModioResponseCache::Add( FName Endpoint, const FString& Key, const FModioResponse& Response, ValueType Value )
+{
+  TSharedRef<const ValueType> Shared = MakeShared<ValueType>( MoveTemp( Value ) );
+  if( Key.Len() && IsEnabled( Endpoint ) && Response.Code >= 200 && Response.Code < 300 )
+  {
+    AddEntry( Endpoint, Key, Response, Shared, GetTypeId<ValueType>(), ModioCacheSize( *Shared ) );
+  }
+  return Shared;
+}
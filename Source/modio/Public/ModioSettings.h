@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "Enums/ModioModFields.h"
 #include "ModioSettings.generated.h"
 
 /**
@@ -58,4 +59,68 @@ public:
 
   UPROPERTY( EditAnywhere, config, Category = Custom )
   uint8 bEnablePolling:1;
+
+  /** Collect GetMod calls and send them as a single query for up to 100 mods */
+  UPROPERTY( EditAnywhere, config, Category = Custom )
+  uint8 bBatchGetModCalls:1;
+
+  /** How long GetMod calls are collected before being sent, 0 sends them the next frame */
+  UPROPERTY( EditAnywhere, config, Category = Custom, meta = ( EditCondition = "bBatchGetModCalls", UIMin = 0, ClampMin = 0, Units = "s" ) )
+  float GetModBatchWindow;
+
+  /** Run modioProcess on a worker thread, delegates are still called on the game thread */
+  UPROPERTY( EditAnywhere, config, Category = Custom )
+  uint8 bProcessInBackground:1;
+
+  /** Most time spent each frame on calling response delegates, the rest waits for the next frames. 0 is unlimited */
+  UPROPERTY( EditAnywhere, config, Category = Custom, meta = ( UIMin = 0, ClampMin = 0, Units = "us" ) )
+  int32 DispatchBudgetMicroseconds;
+
+  /** Most interactive requests in flight at the same time, 0 is unlimited */
+  UPROPERTY( EditAnywhere, config, Category = Custom, meta = ( UIMin = 0, ClampMin = 0 ) )
+  int32 InteractiveRequestLimit;
+
+  /** Most normal requests in flight at the same time, 0 is unlimited */
+  UPROPERTY( EditAnywhere, config, Category = Custom, meta = ( UIMin = 0, ClampMin = 0 ) )
+  int32 NormalRequestLimit;
+
+  /** Most background requests in flight at the same time, like downloads and syncing installed mods. 0 is unlimited */
+  UPROPERTY( EditAnywhere, config, Category = Custom, meta = ( UIMin = 0, ClampMin = 0 ) )
+  int32 BackgroundRequestLimit;
+
+  /** Parts of mods converted by mod queries that don't ask for specific fields, skipping unused fields saves time and memory */
+  UPROPERTY( EditAnywhere, config, Category = Custom, meta = ( Bitmask, BitmaskEnum = "EModioModField" ) )
+  int32 DefaultModFields;
+
+  /** Keep the mods received from queries, subscriptions and installs in the subsystem's mod catalog for local sorting and filtering */
+  UPROPERTY( EditAnywhere, config, Category = Custom )
+  uint8 bKeepModCatalog:1;
+
+  /** Save the mod catalog to a binary store on shutdown and fill it from the store on the next start */
+  UPROPERTY( EditAnywhere, config, Category = Custom, meta = ( EditCondition = "bKeepModCatalog" ) )
+  uint8 bStoreModCatalog:1;
+
+  /** How long SearchMods waits for typing to pause before asking the backend */
+  UPROPERTY( EditAnywhere, config, Category = Custom, meta = ( UIMin = 0, ClampMin = 0, Units = "s" ) )
+  float SearchDebounceSeconds;
+
+  /** Memory the response cache can use to answer repeated reads without asking the backend, 0 disables it */
+  UPROPERTY( EditAnywhere, config, Category = Custom, meta = ( UIMin = 0, ClampMin = 0, Units = "KB" ) )
+  int32 ResponseCacheBudgetKB;
+
+  /** How long cached GetMod and GetAllMods responses are used */
+  UPROPERTY( EditAnywhere, config, Category = Custom, meta = ( UIMin = 0, ClampMin = 0, Units = "s" ) )
+  float ModResponseTimeToLive;
+
+  /** How long after their time to live cached GetMod and GetAllMods responses are shown while fresh ones are fetched */
+  UPROPERTY( EditAnywhere, config, Category = Custom, meta = ( UIMin = 0, ClampMin = 0, Units = "s" ) )
+  float ModResponseStaleTime;
+
+  /** How long cached GetGame responses are used */
+  UPROPERTY( EditAnywhere, config, Category = Custom, meta = ( UIMin = 0, ClampMin = 0, Units = "s" ) )
+  float GameResponseTimeToLive;
+
+  /** How long cached tags, modfiles and dependencies of mods are used */
+  UPROPERTY( EditAnywhere, config, Category = Custom, meta = ( UIMin = 0, ClampMin = 0, Units = "s" ) )
+  float ModDetailsResponseTimeToLive;
 };
\ No newline at end of file
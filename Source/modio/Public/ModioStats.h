@@ -0,0 +1,27 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP( TEXT( "mod.io" ), STATGROUP_Modio, STATCAT_Advanced );
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN( TEXT( "Cancelled requests" ), STAT_ModioCancelledRequests, STATGROUP_Modio, MODIO_API );
+
+DECLARE_CYCLE_STAT_EXTERN( TEXT( "Dispatch" ), STAT_ModioDispatch, STATGROUP_Modio, MODIO_API );
+DECLARE_DWORD_COUNTER_STAT_EXTERN( TEXT( "Queued dispatches" ), STAT_ModioQueuedDispatches, STATGROUP_Modio, MODIO_API );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN( TEXT( "Deferred dispatches" ), STAT_ModioDeferredDispatches, STATGROUP_Modio, MODIO_API );
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN( TEXT( "Finished requests" ), STAT_ModioRequestsFinished, STATGROUP_Modio, MODIO_API );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN( TEXT( "Results received" ), STAT_ModioResultsReceived, STATGROUP_Modio, MODIO_API );
+DECLARE_FLOAT_COUNTER_STAT_EXTERN( TEXT( "Wait time (ms)" ), STAT_ModioWaitTime, STATGROUP_Modio, MODIO_API );
+DECLARE_FLOAT_COUNTER_STAT_EXTERN( TEXT( "Network time (ms)" ), STAT_ModioNetworkTime, STATGROUP_Modio, MODIO_API );
+DECLARE_FLOAT_COUNTER_STAT_EXTERN( TEXT( "Conversion time (ms)" ), STAT_ModioConversionTime, STATGROUP_Modio, MODIO_API );
+DECLARE_FLOAT_COUNTER_STAT_EXTERN( TEXT( "Queue time (ms)" ), STAT_ModioQueueTime, STATGROUP_Modio, MODIO_API );
+
+DECLARE_MEMORY_STAT_EXTERN( TEXT( "Search index memory" ), STAT_ModioSearchIndexMemory, STATGROUP_Modio, MODIO_API );
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN( TEXT( "Response cache hits" ), STAT_ModioResponseCacheHits, STATGROUP_Modio, MODIO_API );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN( TEXT( "Response cache misses" ), STAT_ModioResponseCacheMisses, STATGROUP_Modio, MODIO_API );
+DECLARE_MEMORY_STAT_EXTERN( TEXT( "Response cache memory" ), STAT_ModioResponseCacheMemory, STATGROUP_Modio, MODIO_API );
@@ -0,0 +1,16 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Converts the null terminated UTF-8 String from the SDK straight into Out, with a single allocation and no
+ * temporary buffer. ASCII runs are widened 16 bytes at a time where SSE2 or NEON is available, the rest is
+ * decoded with invalid sequences replaced by U+FFFD. Null is the empty string
+ */
+MODIO_API void ModioUtf8ToString( FString& Out, const char* String );
+
+/** Same as above for the first Length bytes of String */
+MODIO_API void ModioUtf8ToString( FString& Out, const char* String, int32 Length );
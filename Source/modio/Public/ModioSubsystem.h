@@ -19,6 +19,18 @@
 #include "Enums/ModioRatingType.h"
 #include "Enums/ModioReportType.h"
 #include "Enums/ModioResourceType.h"
+#include "Enums/ModioRequestPriority.h"
+#include "Enums/ModioModFields.h"
+#include "ModioPagedQuery.h"
+#include "ModioFuture.h"
+#include "ModioProcessWorker.h"
+#include "ModioDispatchScheduler.h"
+#include "ModioRequestMetrics.h"
+#include "ModioModCatalog.h"
+#include "ModioResponseCache.h"
+#include "ModioCompiledFilter.h"
+#include "ModioInstalledModIndex.h"
+#include "HAL/CriticalSection.h"
 #include "ModioPackage.h"
 #include "ModioPackage.h"
 #include "AsyncRequest/ModioAsyncRequest_AddMod.h"
@@ -61,6 +73,9 @@
 #include "AsyncRequest/ModioAsyncRequest_DeleteModSketchfabLinks.h"
 #include "AsyncRequest/ModioAsyncRequest_GetAllModfiles.h"
 #include "AsyncRequest/ModioAsyncRequest_GetGame.h"
+#include "AsyncRequest/ModioAsyncRequest_GetModBatch.h"
+#include "AsyncRequest/ModioAsyncRequestPool.h"
+#include "AsyncRequest/ModioAsyncRequestRegistry.h"
 #include "Int64.h"
 
 typedef TSharedPtr<struct FModioSubsystem, ESPMode::Fast> FModioSubsystemPtr;
@@ -80,31 +95,150 @@ public:
   
   // Process
   
-  /** Process callbacks in an asyncronous way */
+  /**
+   * Process callbacks in an asyncronous way. With background processing enabled this only delivers the
+   * responses the worker converted, for at most the callback budget
+   */
   void Process();
 
   /** Manually poll user and installed mods events */
   void PollEvents();
 
+  /**
+   * Abandons a request, it's response won't be converted and it's delegate won't be called. Returns false if
+   * the request already finished
+   */
+  bool CancelAsyncRequest(const FModioAsyncRequestHandle &Handle);
+  /**
+   * Puts the request in the named slot, cancelling the request that was there before. Use one slot per
+   * search box or list so only the latest query gets delivered
+   */
+  FModioAsyncRequestHandle AssignQuerySlot(FName QuerySlot, const FModioAsyncRequestHandle &Handle);
+  /** Amount of requests that have been cancelled since startup */
+  int32 GetNumCancelledRequests() const;
+  /** Where the time of the finished requests went, per endpoint. Use it to tell slow networks from slow callbacks */
+  TArray<FModioEndpointMetrics> GetRequestMetrics() const;
+  /** Forgets all recorded request metrics */
+  void ResetRequestMetrics();
+  /**
+   * Most requests of a priority class that are in flight at the same time, 0 is unlimited. The rest waits in
+   * the class queue, and background requests also wait while interactive ones are queued
+   */
+  void SetRequestLimit(TEnumAsByte<EModioRequestPriority> Priority, int32 Limit);
+  /** Amount of requests waiting for a free slot of their priority class */
+  int32 GetNumQueuedRequests(TEnumAsByte<EModioRequestPriority> Priority) const;
+  /**
+   * Keeps every mod received in full by GetAllMods, GetMod, GetUserSubscriptions, GetUserMods and
+   * GetAllInstalledMods in the mod catalog. Disabling it empties the catalog
+   */
+  void SetModCatalogEnabled(bool bEnabled);
+  /** Local catalog of the received mods, to sort and filter them without asking the backend. Game thread only */
+  const FModioModCatalog &GetModCatalog() const;
+  /**
+   * Tells the catalog it holds every mod of the game, call it after paging through GetAllMods. Queries are
+   * only answered locally while it's set. Game thread only
+   */
+  void SetModCatalogComplete(bool bComplete);
+  /**
+   * Saves the mod catalog, the game's tag options and the logged in user to a binary store on shutdown. While
+   * enabled an empty catalog is filled from the store, so a cold start has the mods without any parsing
+   */
+  void SetModCatalogStoreEnabled(bool bEnabled);
+  /** Writes the binary store of the catalog now, returns false if it couldn't be written. Game thread only */
+  bool SaveModCatalogStore();
+  /** User that was logged in when the store was written, false if there was none. Game thread only */
+  bool GetStoredUser(FModioUser &OutUser) const;
+  /**
+   * Matching mods of the catalog, sorted. Returns false without touching OutMods when the catalog isn't
+   * complete, ask the backend with GetAllMods then. Game thread only
+   */
+  bool QueryModCatalog(const FModioModCatalogFilter &Filter, EModioModSortType SortType, bool bAscending, TArray<FModioMod> &OutMods) const;
+  /**
+   * Ids of the catalog's mods having the metadata pair, for example "map_size" and "large". Covers what the
+   * catalog holds, installed mods included once GetAllInstalledMods was called. Game thread only
+   */
+  TArray<int32> GetModIdsByMetadata(const FString &Key, const FString &Value) const;
+  /** Ids of the catalog's mods with a numeric value of the metadata key between Min and Max, lowest value first. Game thread only */
+  TArray<int32> GetModIdsByMetadataRange(const FString &Key, double Min, double Max) const;
+  /**
+   * Search as you type. The delegate is called right away with the best matches of the catalog, then once
+   * typing pauses for the debounce time with the backend's full text search results. A new search replaces
+   * the pending one, so only the latest text reaches the backend. Game thread only
+   */
+  void SearchMods(const FString &Text, int32 Limit, FModioModSearchDelegate SearchDelegate);
+  /** How long SearchMods waits for typing to pause before asking the backend */
+  void SetSearchDebounce(float Seconds);
+  /**
+   * Most estimated memory in bytes of the response cache, 0 disables it. GetMod, GetAllMods, GetGame,
+   * GetAllModTags, GetAllModfiles and GetAllModDependencies answer identical calls from it, with ResultCached
+   * set, until the response is older than the endpoint's time to live. Writes and events of a mod drop what is
+   * cached about it, GetAllMods pages are only bound by their time to live
+   */
+  void SetResponseCacheBudget(int64 Bytes);
+  /** How long responses of an endpoint, for example "GetMod", are answered from the response cache. 0 doesn't cache it */
+  void SetResponseCacheTimeToLive(FName Endpoint, float Seconds);
+  /**
+   * How long after it's time to live a GetMod or GetAllMods response is still handed out, flagged with
+   * ResultCached, while a fresh one is fetched in the background past the SDK's cache. The delegate of the call
+   * is only called with the stale response, a fresh one that differs goes to OnCachedModRefreshed or
+   * OnCachedModsRefreshed. 0 doesn't hand out stale responses
+   */
+  void SetResponseCacheStaleTime(FName Endpoint, float Seconds);
+  /** Called on the game thread when a stale GetMod response was refreshed and the mod changed */
+  FModioModRefreshedEvent OnCachedModRefreshed;
+  /**
+   * Called on the game thread when a stale GetAllMods page was refreshed and it changed. PageKey is the compiled
+   * filter's MakePageKey for the page's limit and offset
+   */
+  FModioModPageRefreshedEvent OnCachedModsRefreshed;
+  /** Hits, misses and memory of the response cache. Game thread only */
+  const FModioResponseCacheStats &GetResponseCacheStats() const;
+  /** Drops every cached response */
+  void ClearResponseCache();
+
   // Config
 
+  /**
+   * Runs modioProcess on a worker thread. Responses are converted on the worker and their delegates are
+   * called from Process on the game thread
+   */
+  void SetBackgroundProcessing(bool bEnabled);
+  /** Is modioProcess running on the worker thread */
+  bool IsProcessingInBackground() const;
+  /**
+   * Most time in microseconds Process spends on calling response delegates each frame, the rest is
+   * deferred to the next frames. 0 calls every delegate as soon as it's response is converted
+   */
+  void SetDispatchBudget(int32 BudgetInMicroseconds);
+  /** Amount of converted responses waiting for their delegates to be called */
+  int32 GetNumQueuedDispatches() const;
+
   /** Change the the poll interval in wich mod updates will be processed */
   void SetModEventsPollInterval(int32 IntervalInSeconds);
   /** Change the the poll interval in wich user updates will be processed, such as mod installs and uninstalls */
   void SetUserEventsPollInterval(int32 IntervalInSeconds);
+  /**
+   * When enabled, GetMod calls made within the window are collected and sent as id-in GetAllMods queries,
+   * a window of 0 sends them on the next Process call
+   */
+  void SetGetModBatching(bool bEnabled, float WindowInSeconds);
+
+  /** Parts of mods converted by GetAllMods, GetMod, GetUserSubscriptions and GetUserMods called without fields */
+  void SetDefaultModFields(EModioModFields Fields);
+  EModioModFields GetDefaultModFields() const;
 
   // Auth
   
   /** Request an email from to the mod.io backend */
-  void EmailRequest(const FString &Email, FModioGenericDelegate EmailRequestDelegate);
+  FModioAsyncRequestHandle EmailRequest(const FString &Email, FModioGenericDelegate EmailRequestDelegate);
   /** Send your Security code to the backend */
-  void EmailExchange(const FString &SecurityCode, FModioGenericDelegate EmailExchangeDelegate);
+  FModioAsyncRequestHandle EmailExchange(const FString &SecurityCode, FModioGenericDelegate EmailExchangeDelegate);
   /** Log in to mod.io on behalf of a Steam Galaxy user */
-  void SteamAuth(const FString &Base64Ticket, FModioGenericDelegate SteamAuthDelegate);
+  FModioAsyncRequestHandle SteamAuth(const FString &Base64Ticket, FModioGenericDelegate SteamAuthDelegate);
   /** Log in to mod.io on behalf of a GOG Galaxy user */
-  void GalaxyAuth(const FString &Appdata, FModioGenericDelegate GalaxyAuthDelegate);
+  FModioAsyncRequestHandle GalaxyAuth(const FString &Appdata, FModioGenericDelegate GalaxyAuthDelegate);
   /** Log in to mod.io on behalf of a Oculus user */
-  void OculusAuth(const FString &Nonce, const FString &OculusUserId, const FString &AccessToken, const FString &Email, const FString &Device, int32 DateExpires, FModioGenericDelegate GalaxyAuthDelegate);
+  FModioAsyncRequestHandle OculusAuth(const FString &Nonce, const FString &OculusUserId, const FString &AccessToken, const FString &Email, const FString &Device, int32 DateExpires, FModioGenericDelegate GalaxyAuthDelegate);
   /** Logs out the current user from mod.io */  
   void Logout();
   /** Returns true if there is a user currently logged in */  
@@ -116,33 +250,106 @@ public:
 
   // Game functions
   /** Get the game information from id */
-  void GetGame(uint32 GameId, FModioGameDelegate GetGameDelegate);
+  FModioAsyncRequestHandle GetGame(uint32 GameId, FModioGameDelegate GetGameDelegate);
 
   // Mod creation and edition
   /** Creates a new mod profile on mod.io */
-  void AddMod(const FModioModCreator &ModCreator, FModioModDelegate AddModDelegate);
+  FModioAsyncRequestHandle AddMod(const FModioModCreator &ModCreator, FModioModDelegate AddModDelegate);
   /** Edits an already existing mod profile on mod.io */
-  void EditMod(uint32 ModId, const FModioModEditor &ModEditor, FModioModDelegate EditModDelegate);
+  FModioAsyncRequestHandle EditMod(uint32 ModId, const FModioModEditor &ModEditor, FModioModDelegate EditModDelegate);
 
   // Mod browsing
   /** Request mod information for a search */
-  void GetAllMods(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, FModioModArrayDelegate GetAllModsDelegate);
+  FModioAsyncRequestHandle GetAllMods(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, FModioModArrayDelegate GetAllModsDelegate);
+  /** GetAllMods converting only the Fields of each mod, the overload without Fields uses the default mod fields */
+  FModioAsyncRequestHandle GetAllMods(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, EModioModFields Fields, FModioModArrayDelegate GetAllModsDelegate);
+  /** Same as GetAllMods, but the mods are handed out as views that convert their fields when first read */
+  FModioAsyncRequestHandle GetAllModsView(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, FModioModViewArrayDelegate GetAllModsDelegate);
+  /** GetAllMods with a compiled filter, keep the filter around when asking for more than one page */
+  FModioAsyncRequestHandle GetAllMods(const FModioCompiledFilterRef &Filter, int32 Limit, int32 Offset, EModioModFields Fields, FModioModArrayDelegate GetAllModsDelegate);
+  /** GetAllModsView with a compiled filter */
+  FModioAsyncRequestHandle GetAllModsView(const FModioCompiledFilterRef &Filter, int32 Limit, int32 Offset, FModioModViewArrayDelegate GetAllModsDelegate);
   /** Request mod information for a single mod */
-  void GetMod(uint32 ModId, const FModioModDelegate ModDelegate);
+  FModioAsyncRequestHandle GetMod(uint32 ModId, const FModioModDelegate ModDelegate);
+  /** GetMod converting only the Fields of the mod */
+  FModioAsyncRequestHandle GetMod(uint32 ModId, EModioModFields Fields, const FModioModDelegate ModDelegate);
   
   // Get your own information
   /** Request the authenticated user information */
-  void GetAuthenticatedUser(FModioUserDelegate GetAuthenticatedUserDelegate);
+  FModioAsyncRequestHandle GetAuthenticatedUser(FModioUserDelegate GetAuthenticatedUserDelegate);
   /** Returns the mods the logged in user has subscribed */
-  void GetUserSubscriptions(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, FModioModArrayDelegate GetUserSubscriptionsDelegate);
+  FModioAsyncRequestHandle GetUserSubscriptions(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, FModioModArrayDelegate GetUserSubscriptionsDelegate);
+  /** GetUserSubscriptions converting only the Fields of each mod */
+  FModioAsyncRequestHandle GetUserSubscriptions(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, EModioModFields Fields, FModioModArrayDelegate GetUserSubscriptionsDelegate);
+  /** GetUserSubscriptions returning mod views */
+  FModioAsyncRequestHandle GetUserSubscriptionsView(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, FModioModViewArrayDelegate GetUserSubscriptionsDelegate);
+  /** GetUserSubscriptions with a compiled filter */
+  FModioAsyncRequestHandle GetUserSubscriptions(const FModioCompiledFilterRef &Filter, int32 Limit, int32 Offset, EModioModFields Fields, FModioModArrayDelegate GetUserSubscriptionsDelegate);
+  /** GetUserSubscriptionsView with a compiled filter */
+  FModioAsyncRequestHandle GetUserSubscriptionsView(const FModioCompiledFilterRef &Filter, int32 Limit, int32 Offset, FModioModViewArrayDelegate GetUserSubscriptionsDelegate);
   /** Returns the mods the authenticated user owns */
-  void GetUserMods(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, FModioModArrayDelegate GetUserModsDelegate);
+  FModioAsyncRequestHandle GetUserMods(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, FModioModArrayDelegate GetUserModsDelegate);
+  /** GetUserMods converting only the Fields of each mod */
+  FModioAsyncRequestHandle GetUserMods(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, EModioModFields Fields, FModioModArrayDelegate GetUserModsDelegate);
+  /** GetUserMods returning mod views */
+  FModioAsyncRequestHandle GetUserModsView(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, FModioModViewArrayDelegate GetUserModsDelegate);
+  /** GetUserMods with a compiled filter */
+  FModioAsyncRequestHandle GetUserMods(const FModioCompiledFilterRef &Filter, int32 Limit, int32 Offset, EModioModFields Fields, FModioModArrayDelegate GetUserModsDelegate);
+  /** GetUserModsView with a compiled filter */
+  FModioAsyncRequestHandle GetUserModsView(const FModioCompiledFilterRef &Filter, int32 Limit, int32 Offset, FModioModViewArrayDelegate GetUserModsDelegate);
   /** Returns the modfiles the authenticated user owns */
-  void GetUserModfiles(int32 Limit, int32 Offset, FModioModfileArrayDelegate GetUserModfilesDelegate);
+  FModioAsyncRequestHandle GetUserModfiles(int32 Limit, int32 Offset, FModioModfileArrayDelegate GetUserModfilesDelegate);
   /** Returns the events related to the authenticated user */
-  void GetUserEvents(int32 Limit, int32 Offset, FModioUserEventArrayDelegate GetUserEventsDelegate);
+  FModioAsyncRequestHandle GetUserEvents(int32 Limit, int32 Offset, FModioUserEventArrayDelegate GetUserEventsDelegate);
   /** Returns the ratings submited by the authenticated user */
-  void GetUserRatings(int32 Limit, int32 Offset, FModioRatingArrayDelegate GetUserRatingsDelegate);
+  FModioAsyncRequestHandle GetUserRatings(int32 Limit, int32 Offset, FModioRatingArrayDelegate GetUserRatingsDelegate);
+
+  // Paged queries
+  /**
+   * Fetches every mod matching the search, page by page. Keep the returned query alive until it completes,
+   * dropping it or calling Cancel stops the query
+   */
+  FModioPagedModQueryRef GetAllModsPaged(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 PageSize, int32 MaxPagesInFlight, FModioModArrayDelegate PageDelegate, FModioGenericDelegate CompleteDelegate);
+  /** Fetches all the mods the logged in user has subscribed, page by page */
+  FModioPagedModQueryRef GetUserSubscriptionsPaged(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 PageSize, int32 MaxPagesInFlight, FModioModArrayDelegate PageDelegate, FModioGenericDelegate CompleteDelegate);
+  /** Fetches all the mods the authenticated user owns, page by page */
+  FModioPagedModQueryRef GetUserModsPaged(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 PageSize, int32 MaxPagesInFlight, FModioModArrayDelegate PageDelegate, FModioGenericDelegate CompleteDelegate);
+  /** Fetches all the events related to the authenticated user, page by page */
+  FModioPagedUserEventQueryRef GetUserEventsPaged(int32 PageSize, int32 MaxPagesInFlight, FModioUserEventArrayDelegate PageDelegate, FModioGenericDelegate CompleteDelegate);
+  /** Fetches all the ratings submited by the authenticated user, page by page */
+  FModioPagedRatingQueryRef GetUserRatingsPaged(int32 PageSize, int32 MaxPagesInFlight, FModioRatingArrayDelegate PageDelegate, FModioGenericDelegate CompleteDelegate);
+
+  // Futures
+  /**
+   * Future versions of the reads, the call is made right away so independent calls run at the same time.
+   * Join them with ModioFuture::WhenAll and continue with Then. Other calls can return futures through
+   * ModioFuture::MakeDelegate
+   */
+  FModioGameFuture GetGameAsync(uint32 GameId);
+  /** Returns the mod information */
+  FModioModFuture GetModAsync(uint32 ModId);
+  /** Returns the mods matching the search */
+  FModioModArrayFuture GetAllModsAsync(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset);
+  /** Returns the logged in user */
+  FModioUserFuture GetAuthenticatedUserAsync();
+  /** Returns the mods the logged in user has subscribed */
+  FModioModArrayFuture GetUserSubscriptionsAsync(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset);
+  /** Returns the mods the authenticated user owns */
+  FModioModArrayFuture GetUserModsAsync(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset);
+  /** Returns the modfiles the authenticated user uploaded */
+  FModioModfileArrayFuture GetUserModfilesAsync(int32 Limit, int32 Offset);
+  /** Returns the events related to the authenticated user */
+  FModioUserEventArrayFuture GetUserEventsAsync(int32 Limit, int32 Offset);
+  /** Returns the ratings submited by the authenticated user */
+  FModioRatingArrayFuture GetUserRatingsAsync(int32 Limit, int32 Offset);
+  /** Returns the modfiles of a mod */
+  FModioModfileArrayFuture GetAllModfilesAsync(int32 ModId);
+  /** Returns the dependencies of a mod */
+  FModioModDependencyArrayFuture GetAllModDependenciesAsync(int32 ModId);
+  /** Returns the tags of a mod */
+  FModioModTagArrayFuture GetAllModTagsAsync(int32 ModId);
+  /** Returns the metadata key value pairs of a mod */
+  FModioMetadataKVPArrayFuture GetAllMetadataKVPAsync(int32 ModId);
 
   // Downloads and installs
   /** Downloads an specific mod */
@@ -163,6 +370,20 @@ public:
   TArray<FModioQueuedModDownload> GetModDownloadQueue();
   /** Installs the downloaded mods, this is called automatically on startup but can be triggered at any time */
   void InstallDownloadedMods();
+  /**
+   * Installed mods without converting them, looked up by id and shared instead of copied. Kept up to date by
+   * the downloads, installs and uninstalls going through the subsystem, and read again when the SDK's installed
+   * count stops matching it. Mods swapped behind the SDK's back without changing the count need RefreshInstalledMods
+   */
+  FModioInstalledModSnapshotRef GetInstalledModsSnapshot();
+  /** Reads every installed mod from the SDK again, notifying the ones that changed. Game thread only */
+  void RefreshInstalledMods();
+  /** Called on the game thread when the mod is installed, updated or uninstalled */
+  FDelegateHandle AddInstalledModListener(int32 ModId, FModioInstalledModChangedDelegate Delegate);
+  /** Called on the game thread when any mod is installed, updated or uninstalled */
+  FDelegateHandle AddInstalledModsListener(FModioInstalledModChangedDelegate Delegate);
+  /** Removes a listener added by either of the above */
+  void RemoveInstalledModListener(FDelegateHandle Handle);
   /** Adds a new modfile to the upload queue */
   void AddModfile(int32 ModId, FModioModfileCreator ModfileCreator);
   /** Returns an array containing the upload queue infromation */
@@ -178,21 +399,21 @@ public:
   /** Places the given mod at the top of the donload queue */
   void PrioritizeModDownload(int32 ModId);
   /** Downloads or updates a list of mods. */
-  void DownloadModfilesById(const TArray<int32> &ModIds, FModioBooleanDelegate DownloadModfilesByIdDelegate);
+  FModioAsyncRequestHandle DownloadModfilesById(const TArray<int32> &ModIds, FModioBooleanDelegate DownloadModfilesByIdDelegate);
   /** Get metadata from all modfies for a mod */
-  void GetAllModfiles( int32 ModId, FModioModfileArrayDelegate GetAllModfilesDelegate);
+  FModioAsyncRequestHandle GetAllModfiles( int32 ModId, FModioModfileArrayDelegate GetAllModfilesDelegate);
   /** Downloads or updates all mods the current user has subscribed */  
-  void DownloadSubscribedModfiles(bool UninstallUnsubscribed, FModioBooleanDelegate DownloadSubscribedModfilesDelegate);
+  FModioAsyncRequestHandle DownloadSubscribedModfiles(bool UninstallUnsubscribed, FModioBooleanDelegate DownloadSubscribedModfilesDelegate);
   /** Uninstalls a mod from local storage */  
   bool UninstallMod(int32 ModId);
   /** Uninstall all deleted or hidden mods */
-  void UninstallUnavailableMods(FModioGenericDelegate UninstallUnavailableModsDelegate);
+  FModioAsyncRequestHandle UninstallUnavailableMods(FModioGenericDelegate UninstallUnavailableModsDelegate);
 
   // Mod Subscription
   /** Subscribes to the corresponding mod */
-  void SubscribeToMod(int32 ModId, FModioModDelegate SubscribeToModDelegate);
+  FModioAsyncRequestHandle SubscribeToMod(int32 ModId, FModioModDelegate SubscribeToModDelegate);
   /** Unsubscribes from the corresponding mod */
-  void UnsubscribeFromMod(int32 ModId, FModioGenericDelegate UnsubscribeFromModDelegate);
+  FModioAsyncRequestHandle UnsubscribeFromMod(int32 ModId, FModioGenericDelegate UnsubscribeFromModDelegate);
   /** Returns true if the current user is subscribed to the given mod */
   bool IsCurrentUserSubscribed(int32 ModId);
   /** Get the list of mods that the current user is subscribed */
@@ -200,53 +421,53 @@ public:
 
   // Mod Rating
   /** Rate the corresponding mod */
-  void AddModRating(int32 ModId, bool IsRatingPositive, FModioGenericDelegate AddModRatingDelegate);
+  FModioAsyncRequestHandle AddModRating(int32 ModId, bool IsRatingPositive, FModioGenericDelegate AddModRatingDelegate);
   /** Get the current users rating corresponding to the given mod */
   TEnumAsByte<EModioRatingType> GetCurrentUserModRating(int32 ModId);
 
   // Mod Dependencies
   /** Request all the dependencies from a mod */
-  void GetAllModDependencies(int32 ModId, FModioModDependencyArrayDelegate GetAllModDependenciesDelegate);
+  FModioAsyncRequestHandle GetAllModDependencies(int32 ModId, FModioModDependencyArrayDelegate GetAllModDependenciesDelegate);
   /** Add the provided dependencies to a corresponding mod */
-  void AddModDependencies(int32 ModId, const TArray<int32> &Dependencies, FModioGenericDelegate AddModDependenciesDelegate);
+  FModioAsyncRequestHandle AddModDependencies(int32 ModId, const TArray<int32> &Dependencies, FModioGenericDelegate AddModDependenciesDelegate);
   /** Deletes all the provided dependencies from the corresponding mod */
-  void DeleteModDependencies(int32 ModId, const TArray<int32> &Dependencies, FModioGenericDelegate DeleteModDependenciesDelegate);
+  FModioAsyncRequestHandle DeleteModDependencies(int32 ModId, const TArray<int32> &Dependencies, FModioGenericDelegate DeleteModDependenciesDelegate);
 
   // Reports
   /** Submits a report on any resource to mod.io */
-  void SubmitReport(TEnumAsByte<EModioResourceType> Resource, int32 Id, TEnumAsByte<EModioReportType> Report, const FString &Name, const FString &Summary, FModioGenericDelegate SubmitReportDelegate);
+  FModioAsyncRequestHandle SubmitReport(TEnumAsByte<EModioResourceType> Resource, int32 Id, TEnumAsByte<EModioReportType> Report, const FString &Name, const FString &Summary, FModioGenericDelegate SubmitReportDelegate);
 
   // Mod Tags
   /** Request all the tags from a mod */
-  void GetAllModTags(int32 ModId, FModioModTagArrayDelegate GetAllModTagsDelegate);
+  FModioAsyncRequestHandle GetAllModTags(int32 ModId, FModioModTagArrayDelegate GetAllModTagsDelegate);
   /** Assign the provided tags to a corresponding mod */
-  void AddModTags(int32 ModId, const TArray<FString> &Tags, FModioGenericDelegate AddModTagsDelegate);
+  FModioAsyncRequestHandle AddModTags(int32 ModId, const TArray<FString> &Tags, FModioGenericDelegate AddModTagsDelegate);
   /** Deletes all the provided tags from the corresponding mod */
-  void DeleteModTags(int32 ModId, const TArray<FString> &Tags, FModioGenericDelegate DeleteModTagsDelegate);
+  FModioAsyncRequestHandle DeleteModTags(int32 ModId, const TArray<FString> &Tags, FModioGenericDelegate DeleteModTagsDelegate);
 
   // Mod MetadataKVP
   /** Request all the metadata kvp from a mod */
-  void GetAllMetadataKVP(int32 ModId, FModioMetadataKVPArrayDelegate GetAllMetadataKVPDelegate);
+  FModioAsyncRequestHandle GetAllMetadataKVP(int32 ModId, FModioMetadataKVPArrayDelegate GetAllMetadataKVPDelegate);
   /** Assign the provided metadata kvp to a corresponding mod */
-  void AddMetadataKVP(int32 ModId, const TMap<FString, FString> &MetadataKVP, FModioGenericDelegate AddMetadataKVPDelegate);
+  FModioAsyncRequestHandle AddMetadataKVP(int32 ModId, const TMap<FString, FString> &MetadataKVP, FModioGenericDelegate AddMetadataKVPDelegate);
   /** Deletes all the provided metadata kvp from the corresponding mod */
-  void DeleteMetadataKVP(int32 ModId, const TMap<FString, FString> &MetadataKVP, FModioGenericDelegate DeleteMetadataKVPDelegate);
+  FModioAsyncRequestHandle DeleteMetadataKVP(int32 ModId, const TMap<FString, FString> &MetadataKVP, FModioGenericDelegate DeleteMetadataKVPDelegate);
 
   // Media Methods
   /** Adds a new logo image to the corresponding mod */
-  void AddModLogo(int32 ModId, const FString &LogoPath, FModioGenericDelegate AddModLogoDelegate);
+  FModioAsyncRequestHandle AddModLogo(int32 ModId, const FString &LogoPath, FModioGenericDelegate AddModLogoDelegate);
   /** Add images to the corresponding mod */
-  void AddModImages(int32 ModId, const TArray<FString> &ImagePaths, FModioGenericDelegate AddModImagesDelegate);
+  FModioAsyncRequestHandle AddModImages(int32 ModId, const TArray<FString> &ImagePaths, FModioGenericDelegate AddModImagesDelegate);
   /** Add youtube links to the corresponding mod */
-  void AddModYoutubeLinks(int32 ModId, const TArray<FString> &YoutubeLinks, FModioGenericDelegate AddModYoutubeLinksDelegate);
+  FModioAsyncRequestHandle AddModYoutubeLinks(int32 ModId, const TArray<FString> &YoutubeLinks, FModioGenericDelegate AddModYoutubeLinksDelegate);
   /** Add sketchfab to the corresponding mod */
-  void AddModSketchfabLinks(int32 ModId, const TArray<FString> &SketchfabLinks, FModioGenericDelegate AddModSketchfabLinksDelegate);
+  FModioAsyncRequestHandle AddModSketchfabLinks(int32 ModId, const TArray<FString> &SketchfabLinks, FModioGenericDelegate AddModSketchfabLinksDelegate);
   /** Delete images from the corresponding mod */
-  void DeleteModImages(int32 ModId, const TArray<FString> &ImagePaths, FModioGenericDelegate AddModImagesDelegate);
+  FModioAsyncRequestHandle DeleteModImages(int32 ModId, const TArray<FString> &ImagePaths, FModioGenericDelegate AddModImagesDelegate);
   /** Delete youtube links from the corresponding mod */
-  void DeleteModYoutubeLinks(int32 ModId, const TArray<FString> &YoutubeLinks, FModioGenericDelegate AddModYoutubeLinksDelegate);
+  FModioAsyncRequestHandle DeleteModYoutubeLinks(int32 ModId, const TArray<FString> &YoutubeLinks, FModioGenericDelegate AddModYoutubeLinksDelegate);
   /** Delete sketchfab from the corresponding mod */
-  void DeleteModSketchfabLinks(int32 ModId, const TArray<FString> &SketchfabLinks, FModioGenericDelegate AddModSketchfabLinksDelegate);
+  FModioAsyncRequestHandle DeleteModSketchfabLinks(int32 ModId, const TArray<FString> &SketchfabLinks, FModioGenericDelegate AddModSketchfabLinksDelegate);
   
   /** Download and upload delegate listeners */
   static FModioListenerDelegate ModioOnModDownloadDelegate;
@@ -261,6 +482,49 @@ PACKAGE_SCOPE:
   /** Called by the async request when it's done */
   void AsyncRequestDone(struct FModioAsyncRequest *Request);
 
+  /** Returns the request in flight for the handle, nullptr if it already finished */
+  struct FModioAsyncRequest* FindAsyncRequest(const FModioAsyncRequestHandle &Handle) const;
+
+  /** Makes sure no further identical reads are attached to the request */
+  void StopCoalescing(struct FModioAsyncRequest *Request);
+
+  /**
+   * Runs Dispatch and finishes the request on the game thread, skipping Dispatch if the request was
+   * cancelled. Right away on the game thread, otherwise it's queued for Process
+   */
+  void DeliverResponse(struct FModioAsyncRequest *Request, TFunction<void()> Dispatch);
+
+  /** Runs Task on the game thread, right away if we already are on it */
+  void RunOnGameThread(TFunction<void()> Task);
+
+  /** Queues a conversion for after the current modioProcess pass, responses hold the SDK lock */
+  void QueueConversion(TFunction<void()> Convert);
+
+  /** Asks the single mod endpoint for a batched GetMod the batch didn't return, id-in queries skip hidden mods */
+  void IssueGetMod(class FModioAsyncRequest_GetMod *Request);
+
+  /** Called on the game thread with mods that were converted in full, adds them to the catalog if it's enabled */
+  void NotifyModsReceived(TArrayView<const FModioMod> Mods);
+
+  /** Called on the game thread with a received game, gives it's tag options to the catalog */
+  void NotifyGameReceived(const FModioGame &Game);
+
+  /** Called on the game thread with polled mod events, keeps the catalog up to date with them */
+  void NotifyModEventsReceived(const TArray<FModioModEvent> &ModEvents);
+
+  /** Called on the game thread after the SDK installed or updated the mod, reads only that mod again */
+  void NotifyModInstalled(int32 ModId);
+
+  /** Called on the game thread with mods the SDK uninstalled */
+  void NotifyModsUninstalled(const TArray<int32> &ModIds);
+
+  /**
+   * Shares a converted response so it can be dispatched without a copy, and caches it under the request's key
+   * when it's endpoint is cached. Game thread only
+   */
+  template<typename ValueType>
+  TSharedRef<const ValueType> CacheResponse(const struct FModioAsyncRequest *Request, const FModioResponse &Response, ValueType Value);
+
   /** Should only be create from our create function */
   FModioSubsystem();
 
@@ -272,27 +536,361 @@ PACKAGE_SCOPE:
 private:
   /** This should be the only way to create and queue async requests */
   template<typename RequestType, typename CallbackType, typename... Params>
-  friend RequestType* CreateAsyncRequest( FModioSubsystem* Subsystem, CallbackType CallbackDelegate, Params... Parameters );
+  friend RequestType* CreateAsyncRequest( FModioSubsystem* Subsystem, const TCHAR* Endpoint, CallbackType CallbackDelegate, Params... Parameters );
+
+  /**
+   * Creates and queues a idempotent read request. If an identical read is already in flight the new request
+   * is attached to it and bOutCoalesced is set, in that case no call to the backend should be made
+   */
+  template<typename RequestType, typename CallbackType>
+  RequestType* CreateCoalescedAsyncRequest( const TCHAR* Endpoint, const FString &CoalesceKey, CallbackType CallbackDelegate, bool &bOutCoalesced );
+
+  friend class FModioRequestPriorityScope;
+
+  /**
+   * Calls the backend for the request through Issue right away if a slot of it's priority class is free,
+   * otherwise queues it. Requests get DefaultPriority unless created in a FModioRequestPriorityScope. The slot
+   * is only given back once the request is done, so Issue has to make the SDK call that finishes it, a request
+   * with nothing to ask for should be finished without being issued
+   */
+  void IssueRequest(struct FModioAsyncRequest* Request, TFunction<void()> Issue, EModioRequestPriority DefaultPriority = EModioRequestPriority::NORMAL);
+
+  /** Issues queued requests while their classes have free slots, most urgent classes first */
+  void AdmitQueuedRequests();
+
+  /** Can a request of the class be issued now */
+  bool CanAdmitRequest(EModioRequestPriority Priority) const;
 
-  /** Queue up a new async request and take ownership of the memory */
-  void QueueAsyncTask( struct FModioAsyncRequest* Request );
+  /** Priority for a request created now */
+  EModioRequestPriority GetRequestPriority(EModioRequestPriority DefaultPriority) const;
+
+  /** Runs the dispatch of a request and finishes it, unless the request was cancelled meanwhile */
+  void RunRequestDispatch(const FModioAsyncRequestHandle &Handle, const TFunction<void()> &Dispatch);
+
+  /** Starts or stops the processing worker */
+  void StartProcessWorker();
+  void StopProcessWorker();
+
+  /** Cancel function for paged queries, doesn't keep the subsystem alive */
+  TFunction<void( const FModioAsyncRequestHandle &Handle )> MakePageCancelFunction();
+
+  /** Sends all GetMod calls waiting to be batched as id-in queries of at most GetModBatchLimit mods each */
+  void FlushGetModBatch();
+
+  /** Sends the pending search to the backend */
+  void FlushPendingSearch();
+
+  /**
+   * Answers the call with the cached response of the key on the next Process. The request made for it can be
+   * cancelled like any other. Returns false on a miss. Stale responses are only handed out when OutStaleValue
+   * is given, it's set to them so the caller can refresh them
+   */
+  template<typename RequestType, typename ValueType, typename DelegateType>
+  bool FindCachedResponse(const TCHAR* Endpoint, const FString &Key, const DelegateType &Delegate, FModioAsyncRequestHandle &OutHandle, TSharedPtr<const ValueType> *OutStaleValue = nullptr);
+
+  /** Fetches a stale cached mod again past the SDK's cache, for OnCachedModRefreshed */
+  void RefreshStaleMod(uint32 ModId, EModioModFields Fields, const FString &CoalesceKey, TSharedRef<const FModioMod> Stale);
+
+  /** Fetches a stale cached page again past the SDK's cache, for OnCachedModsRefreshed */
+  void RefreshStaleModPage(const FModioCompiledFilterRef &Filter, int32 Limit, int32 Offset, EModioModFields Fields, const FString &CoalesceKey, TSharedRef<const TArray<FModioMod>> Stale);
+
+  /** Issues a GetAllMods page that wasn't found in the cache */
+  FModioAsyncRequestHandle IssueGetAllMods(const FModioCompiledFilterRef &Filter, int32 Limit, int32 Offset, EModioModFields Fields, const FString &CoalesceKey, uint32 CacheMaxAgeSeconds, FModioModArrayDelegate GetAllModsDelegate);
+
+  /** Drops the cached responses holding the mod */
+  void InvalidateCachedResponses(int32 ModId);
+
+  /** Fills an empty catalog from the binary store, once per session */
+  void LoadModCatalogStore();
+
+  /** Reports the memory of the catalog's search index */
+  void UpdateModCatalogStats();
+
+  /** Runs modioProcess, then the conversions it's responses queued once the SDK lock is released */
+  void ProcessSdk();
+
+  /** Runs the queued conversions on the calling thread */
+  void RunQueuedConversions();
+
+  /** Queue up a new async request and take ownership of the memory, DestroyFunction is used to release it when done */
+  void QueueAsyncTask( struct FModioAsyncRequest* Request, void (*DestroyFunction)(struct FModioAsyncRequest*) );
 
   /** All running async requests */
-  TArray<TSharedPtr<struct FModioAsyncRequest>> AsyncRequests;
+  FModioAsyncRequestRegistry AsyncRequests;
+
+  /** Idempotent reads in flight that identical reads can attach to */
+  TMap<FString, FModioAsyncRequestHandle> InFlightReads;
+
+  /** Held around every call into the SDK, as modioProcess might be running on the worker */
+  FCriticalSection SdkCriticalSection;
+
+  /** Runs modioProcess when background processing is enabled */
+  TUniquePtr<FModioProcessWorker> ProcessWorker;
+
+  /** Conversions queued by responses, guarded by SdkCriticalSection */
+  TArray<TFunction<void()>> QueuedConversions;
+
+  /** Converted responses and listener calls waiting to run on the game thread */
+  FModioDispatchScheduler DispatchScheduler;
+
+  /** Timings of the finished requests */
+  FModioRequestMetrics RequestMetrics;
+
+  /** Mods received so far, when bKeepModCatalog is set */
+  FModioModCatalog ModCatalog;
+
+  /** Tag options of the game, written to the catalog store */
+  TArray<FModioGameTagOption> CatalogTagOptions;
+
+  /** Read from the catalog store */
+  TOptional<FModioUser> StoredUser;
+
+  /** Binary store of the catalog in the root directory */
+  FString ModCatalogStorePath;
+
+  /** Installed mods by id */
+  FModioInstalledModIndex InstalledModIndex;
+
+  /** Responses of idempotent reads, answers identical reads while they are fresh */
+  FModioResponseCache ResponseCache;
+
+  /** Request waiting for a free slot of it's priority class */
+  struct FQueuedRequest
+  {
+    FModioAsyncRequestHandle Request;
+    TFunction<void()> Issue;
+  };
+
+  /**
+   * Requests of a priority class waiting for a slot, oldest first. Admitting moves Head forward instead of
+   * shifting the array, the admitted entries are dropped in bulk once they are half of it
+   */
+  struct FRequestQueue
+  {
+    TArray<FQueuedRequest> Requests;
+    int32 Head = 0;
+
+    int32 Num() const
+    {
+      return Requests.Num() - Head;
+    }
+
+    void Add( FQueuedRequest&& Queued )
+    {
+      Requests.Add( MoveTemp( Queued ) );
+    }
+
+    FQueuedRequest Pop()
+    {
+      FQueuedRequest Queued = MoveTemp( Requests[Head++] );
+      if( Head == Requests.Num() )
+      {
+        Requests.Reset();
+        Head = 0;
+      }
+      else if( Head >= 32 && Head * 2 >= Requests.Num() )
+      {
+        Requests.RemoveAt( 0, Head, false );
+        Head = 0;
+      }
+      return Queued;
+    }
+
+    /** Returns false if the request isn't queued */
+    bool Remove( const FModioAsyncRequestHandle& Handle )
+    {
+      for( int32 i = Head; i < Requests.Num(); i++ )
+      {
+        if( Requests[i].Request == Handle )
+        {
+          Requests.RemoveAt( i );
+          return true;
+        }
+      }
+      return false;
+    }
+
+    void Reset()
+    {
+      Requests.Reset();
+      Head = 0;
+    }
+  };
+
+  /** Queued requests per priority class */
+  FRequestQueue QueuedRequests[EModioRequestPriority::PRIORITY_MAX];
+
+  /** Requests holding a slot per priority class */
+  int32 NumRequestsInFlight[EModioRequestPriority::PRIORITY_MAX];
+
+  /** Slots per priority class, 0 is unlimited */
+  int32 RequestLimits[EModioRequestPriority::PRIORITY_MAX];
+
+  /** Priority set by the innermost FModioRequestPriorityScope, PRIORITY_MAX when there is none */
+  EModioRequestPriority PriorityOverride;
+
+  /** Should modioProcess run on the worker */
+  uint8 bProcessInBackground : 1;
+
+  /** Set while issuing queued requests, as responses can come in while we do */
+  uint8 bAdmittingRequests : 1;
+
+  /** Latest request issued for each query slot, removed once that request is done */
+  TMap<FName, FModioAsyncRequestHandle> QuerySlots;
+
+  /** Amount of requests that have been cancelled */
+  int32 NumCancelledRequests;
+
+  /** GetMod requests waiting for the batch window to close */
+  TArray<FModioAsyncRequestHandle> PendingGetModBatch;
+
+  /** When the first request of the pending batch was made */
+  double PendingGetModBatchStartTime;
+
+  /** How long GetMod calls are collected before they are sent */
+  float GetModBatchWindow;
+
+  /** Latest search waiting for the debounce time to pass */
+  struct FPendingSearch
+  {
+    FString Text;
+    int32 Limit;
+    FModioModSearchDelegate Delegate;
+    double Time;
+  };
+  TOptional<FPendingSearch> PendingSearch;
+
+  /** Game the catalog store belongs to */
+  uint32 StoreGameId;
+
+  /** How long searches wait for typing to pause */
+  float SearchDebounce;
+
+  /** Parts of mods converted when the caller doesn't ask for specific fields */
+  EModioModFields DefaultModFields;
+
+  /** Should GetMod calls be batched */
+  uint8 bBatchGetModCalls : 1;
+
+  /** Are received mods kept in ModCatalog */
+  uint8 bKeepModCatalog : 1;
+
+  /** Is the catalog saved to and filled from it's binary store */
+  uint8 bStoreModCatalog : 1;
+
+  /** Was the catalog store read this session */
+  uint8 bModCatalogStoreLoaded : 1;
 
   /** Are we initialized */
   uint8 bInitialized : 1;
 };
 
+/**
+ * Gives the requests created while the scope is alive a priority, for example to let a mod page open while
+ * a background sync is running:
+ *   FModioRequestPriorityScope Interactive( Modio, EModioRequestPriority::INTERACTIVE );
+ *   Modio->GetMod( ModId, Delegate );
+ */
+class MODIO_API FModioRequestPriorityScope
+{
+public:
+  FModioRequestPriorityScope( FModioSubsystem* InModio, EModioRequestPriority Priority ) :
+    Modio( InModio ),
+    PreviousPriority( InModio->PriorityOverride )
+  {
+    Modio->PriorityOverride = Priority;
+  }
+
+  ~FModioRequestPriorityScope()
+  {
+    Modio->PriorityOverride = PreviousPriority;
+  }
+
+private:
+  FModioSubsystem* Modio;
+  EModioRequestPriority PreviousPriority;
+};
+
 /**
   * Create function for async requests, as they need to be queued immediately to ensure that they are queued
   * before the callback from mod.io API comes in
   */
 template<typename RequestType, typename CallbackType, typename... Params>
-RequestType* CreateAsyncRequest( FModioSubsystem* Subsystem, CallbackType CallbackDelegate, Params... Parameters)
+RequestType* CreateAsyncRequest( FModioSubsystem* Subsystem, const TCHAR* Endpoint, CallbackType CallbackDelegate, Params... Parameters)
 {
-  RequestType* Request = new RequestType( Subsystem, CallbackDelegate, Parameters... );
-  Subsystem->QueueAsyncTask( Request );
+  void* Memory = TModioAsyncRequestPool<RequestType>::Allocate();
+  RequestType* Request = new (Memory) RequestType( Subsystem, CallbackDelegate, Parameters... );
+  Request->Timings.Endpoint = Endpoint;
+  Request->Timings.CreateTime = FPlatformTime::Seconds();
+  Subsystem->QueueAsyncTask( Request, &TModioAsyncRequestPool<RequestType>::Destroy );
 
   return Request;
-}
\ No newline at end of file
+}
+
+template<typename RequestType, typename CallbackType>
+RequestType* FModioSubsystem::CreateCoalescedAsyncRequest( const TCHAR* Endpoint, const FString &CoalesceKey, CallbackType CallbackDelegate, bool &bOutCoalesced )
+{
+  RequestType* Request = CreateAsyncRequest<RequestType>( this, Endpoint, CallbackDelegate );
+
+  bOutCoalesced = false;
+  if( const FModioAsyncRequestHandle* LeaderHandle = InFlightReads.Find( CoalesceKey ) )
+  {
+    if( FModioAsyncRequest* Leader = AsyncRequests.Find( *LeaderHandle ) )
+    {
+      Leader->Followers.Add( Request->GetHandle() );
+      Request->LeaderHandle = *LeaderHandle;
+      bOutCoalesced = true;
+      return Request;
+    }
+  }
+
+  Request->CoalesceKey = CoalesceKey;
+  InFlightReads.Add( CoalesceKey, Request->GetHandle() );
+  return Request;
+}
+
+template<typename ValueType>
+TSharedRef<const ValueType> FModioSubsystem::CacheResponse( const struct FModioAsyncRequest *Request, const FModioResponse &Response, ValueType Value )
+{
+  check( IsInGameThread() );
+  return ResponseCache.Add<ValueType>( Request->Timings.Endpoint, Request->CoalesceKey, Response, MoveTemp( Value ) );
+}
+
+template<typename RequestType, typename ValueType, typename DelegateType>
+bool FModioSubsystem::FindCachedResponse( const TCHAR* Endpoint, const FString &Key, const DelegateType &Delegate, FModioAsyncRequestHandle &OutHandle, TSharedPtr<const ValueType> *OutStaleValue )
+{
+  if( !IsInGameThread() )
+  {
+    return false;
+  }
+
+  FModioResponse Response;
+  bool bStale = false;
+  TSharedPtr<const ValueType> Value = ResponseCache.Find<ValueType>( Endpoint, Key, Response, OutStaleValue ? &bStale : nullptr );
+  if( !Value.IsValid() )
+  {
+    return false;
+  }
+
+  if( bStale )
+  {
+    *OutStaleValue = Value;
+  }
+
+  // The request never calls the backend, it gives the call a handle and shows up in the metrics
+  RequestType* Request = CreateAsyncRequest<RequestType>( this, Endpoint, DelegateType() );
+  Request->Timings.ResponseTime = Request->Timings.CreateTime;
+  Request->Timings.ConvertedTime = Request->Timings.CreateTime;
+  Request->Timings.ResponseCode = Response.Code;
+  Request->Timings.NumResults = Response.ResultCount;
+  OutHandle = Request->GetHandle();
+
+  DispatchScheduler.Enqueue( [this, Handle = OutHandle, Delegate, Response, Value]()
+  {
+    RunRequestDispatch( Handle, [&]()
+    {
+      Delegate.ExecuteIfBound( Response, *Value );
+    });
+  });
+  return true;
+}
@@ -16,21 +16,87 @@
 #include "Customizables/ModioModEditor.h"
 #include "Customizables/ModioModfileCreator.h"
 #include "Customizables/ModioFilterCreator.h"
+#include "Async/ParallelFor.h"
 #include <string>
 
-extern TArray<FModioMod> ConvertToTArrayMods(ModioMod* ModioMods, u32 ModsSize);
-extern TArray<FModioModfile> ConvertToTArrayModfiles(ModioModfile* ModioModfiles, u32 ModfilesSize);
-extern TArray<FModioRating> ConvertToTArrayRatings(ModioRating* ModioRatings, u32 RatingsSize);
-extern TArray<FModioModDependency> ConvertToTArrayModDependencies(ModioDependency* ModioDependencies, u32 ModDependenciesSize);
-extern TArray<FModioModTag> ConvertToTArrayModTags(ModioTag* ModioTags, u32 ModTagsSize);
-extern TArray<FModioMetadataKVP> ConvertToTArrayMetadataKVP(ModioMetadataKVP* ModioMetadataKVP, u32 ModioMetadatasSize);
-extern TArray<FModioUserEvent> ConvertToTArrayUserEvents(ModioUserEvent* ModioUserEvents, u32 UserEventsSize);
-extern TArray<FModioModEvent> ConvertToTArrayModEvents(ModioModEvent* ModioModEvents, u32 ModEventsSize);
+/** Arrays of at least this many elements are converted on the task graph, in tasks of this many elements */
+static const int32 ModioParallelConversionThreshold = 64;
+static const int32 ModioParallelConversionBatchSize = 32;
+
+/**
+ * Converts an SDK array with Initialize( ElementType&, const SourceType& ), constructing the elements in
+ * place in a pre-sized array. Arrays of at least ParallelThreshold elements are converted in parallel, so
+ * Initialize must be safe to call from several threads at once
+ */
+template<typename ElementType, typename SourceType, typename InitializeType>
+TArray<ElementType> ConvertModioArray(const SourceType* Source, u32 Size, InitializeType Initialize, int32 ParallelThreshold = ModioParallelConversionThreshold)
+{
+  TArray<ElementType> Result;
+  Result.SetNum((int32)Size);
+
+  if ((int32)Size >= ParallelThreshold && FPlatformProcess::SupportsMultithreading())
+  {
+    int32 NumBatches = FMath::DivideAndRoundUp((int32)Size, ModioParallelConversionBatchSize);
+    ParallelFor(NumBatches, [&](int32 Batch)
+    {
+      int32 End = FMath::Min((Batch + 1) * ModioParallelConversionBatchSize, (int32)Size);
+      for (int32 i = Batch * ModioParallelConversionBatchSize; i < End; i++)
+      {
+        Initialize(Result[i], Source[i]);
+      }
+    });
+  }
+  else
+  {
+    for (int32 i = 0; i < (int32)Size; i++)
+    {
+      Initialize(Result[i], Source[i]);
+    }
+  }
+  return Result;
+}
+
+/**
+ * UTF-8 copies of strings for the SDK's char** parameters. The strings share a single buffer that is freed
+ * with the array
+ */
+class MODIO_API FModioUtf8StringArray
+{
+public:
+  explicit FModioUtf8StringArray(const TArray<FString> &Strings);
+  /** Pairs as "key:value", the way the SDK takes metadata */
+  explicit FModioUtf8StringArray(const TMap<FString, FString> &MetadataKVP);
+  /** The pointers point into our own buffer, a copy would point into ours */
+  FModioUtf8StringArray(const FModioUtf8StringArray &Other) = delete;
+  FModioUtf8StringArray& operator=(const FModioUtf8StringArray &Other) = delete;
+
+  char** GetData() { return Pointers.GetData(); }
+  u32 Num() const { return (u32)Pointers.Num(); }
+
+private:
+  void Add(const TCHAR* String);
+  /** Points Pointers into Buffer, once it won't grow anymore */
+  void Finish();
+
+  TArray<ANSICHAR> Buffer;
+  TArray<int32> Offsets;
+  TArray<char*> Pointers;
+};
+
+extern MODIO_API TArray<FModioMod> ConvertToTArrayMods(ModioMod* ModioMods, u32 ModsSize, EModioModFields Fields = EModioModFields::All);
+extern MODIO_API TArray<FModioModfile> ConvertToTArrayModfiles(ModioModfile* ModioModfiles, u32 ModfilesSize);
+extern MODIO_API TArray<FModioRating> ConvertToTArrayRatings(ModioRating* ModioRatings, u32 RatingsSize);
+extern MODIO_API TArray<FModioModDependency> ConvertToTArrayModDependencies(ModioDependency* ModioDependencies, u32 ModDependenciesSize);
+extern MODIO_API TArray<FModioModTag> ConvertToTArrayModTags(ModioTag* ModioTags, u32 ModTagsSize);
+extern MODIO_API TArray<FModioMetadataKVP> ConvertToTArrayMetadataKVP(ModioMetadataKVP* ModioMetadataKVP, u32 ModioMetadatasSize);
+extern MODIO_API TArray<FModioUserEvent> ConvertToTArrayUserEvents(ModioUserEvent* ModioUserEvents, u32 UserEventsSize);
+extern MODIO_API TArray<FModioModEvent> ConvertToTArrayModEvents(ModioModEvent* ModioModEvents, u32 ModEventsSize);
 extern TEnumAsByte<EModioModState> ConvertToModState(u32 ModioModState);
 extern TEnumAsByte<EModioRatingType> ConvertToModRatingType(u32 ModioModRating);
-extern void SetupModioFilterPagination(int32 Limit, int32 Offset, ModioFilterCreator& modio_filter_creator);
-extern void SetupModioModFilterCreator(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, ModioFilterCreator& modio_filter_creator);
-extern void SetupModioModCreator(FModioModCreator ModCreator, ModioModCreator& modio_mod_creator);
-extern void SetupModioModEditor(FModioModEditor ModEditor, ModioModEditor& modio_mod_editor);
-extern void SetupModioModfileCreator(FModioModfileCreator ModfileCreator, ModioModfileCreator& modio_modfile_creator);
+extern MODIO_API void SetupModioFilterPagination(int32 Limit, int32 Offset, ModioFilterCreator& modio_filter_creator);
+extern MODIO_API const char* GetModSortField(TEnumAsByte<EModioModSortType> ModSortType);
+extern MODIO_API void SetupModioModFilterCreator(const FModioFilterCreator &FilterCreator, const TArray<FString> &ModTags, int32 Limit, int32 Offset, ModioFilterCreator& modio_filter_creator);
+extern MODIO_API void SetupModioModCreator(FModioModCreator ModCreator, ModioModCreator& modio_mod_creator);
+extern MODIO_API void SetupModioModEditor(FModioModEditor ModEditor, ModioModEditor& modio_mod_editor);
+extern MODIO_API void SetupModioModfileCreator(FModioModfileCreator ModfileCreator, ModioModfileCreator& modio_modfile_creator);
 std::string toString(int32 number);
\ No newline at end of file
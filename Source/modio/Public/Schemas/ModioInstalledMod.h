@@ -19,4 +19,4 @@ struct FModioInstalledMod
   FModioMod Mod;
 };
 
-extern void InitializeInstalledMod(FModioInstalledMod &installed_mod, const ModioInstalledMod &modio_installed_mod);
\ No newline at end of file
+extern MODIO_API void InitializeInstalledMod(FModioInstalledMod &installed_mod, const ModioInstalledMod &modio_installed_mod);
\ No newline at end of file
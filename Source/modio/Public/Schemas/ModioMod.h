@@ -13,6 +13,7 @@
 #include "Schemas/ModioStats.h"
 #include "Schemas/ModioModTag.h"
 #include "Schemas/ModioMetadataKVP.h"
+#include "Enums/ModioModFields.h"
 #include "ModioMod.generated.h"
 
 USTRUCT(BlueprintType)
@@ -68,8 +69,11 @@ struct FModioMod
   TArray<FModioMetadataKVP> MetadataKVP;
 };
 
-extern void InitializeMod(FModioMod &mod, const ModioMod &modio_mod);
+/** Converts modio_mod, the fields left out of Fields are not touched */
+extern MODIO_API void InitializeMod(FModioMod &mod, const ModioMod &modio_mod, EModioModFields Fields = EModioModFields::All);
 
 DECLARE_DELEGATE_TwoParams( FModioModDelegate, FModioResponse, FModioMod );
 DECLARE_DELEGATE_TwoParams( FModioModArrayDelegate, FModioResponse, const TArray<FModioMod> & );
+DECLARE_MULTICAST_DELEGATE_TwoParams( FModioModRefreshedEvent, const FModioResponse &, const FModioMod & );
+DECLARE_MULTICAST_DELEGATE_ThreeParams( FModioModPageRefreshedEvent, const FString & /*PageKey*/, const FModioResponse &, const TArray<FModioMod> & );
 DECLARE_DELEGATE_TwoParams( FModioListenerDelegate, int32, int32 );
@@ -25,7 +25,7 @@ struct FModioModEvent
   int32 DateAdded;
 };
 
-extern void InitializeModEvent(FModioModEvent &event, const ModioModEvent &modio_event);
+extern MODIO_API void InitializeModEvent(FModioModEvent &event, const ModioModEvent &modio_event);
 
 DECLARE_DELEGATE_TwoParams( FModioModEventDelegate, FModioResponse, FModioModEvent );
 DECLARE_DELEGATE_TwoParams( FModioModEventArrayDelegate, FModioResponse, const TArray<FModioModEvent> & );
\ No newline at end of file
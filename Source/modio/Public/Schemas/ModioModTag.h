@@ -15,6 +15,7 @@ struct FModioModTag
 
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io")
   int32 DateAdded;
+  /** Case sensitive, the backend tells tags apart by case */
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "mod.io")
   FString Name;
 };
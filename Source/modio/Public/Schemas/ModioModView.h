@@ -0,0 +1,159 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "c/ModioC.h"
+#include "Schemas/ModioResponse.h"
+#include "Schemas/ModioMod.h"
+
+/** Text fields a mod view keeps, in the order they are stored */
+enum class EModioModViewString : uint8
+{
+  HomepageUrl,
+  Name,
+  NameId,
+  Summary,
+  Description,
+  DescriptionPlainText,
+  MetadataBlob,
+  ProfileUrl,
+  LogoFilename,
+  LogoOriginal,
+  LogoThumb320x180,
+  LogoThumb640x360,
+  LogoThumb1280x720,
+  SubmittedByUsername,
+  SubmittedByNameId,
+  SubmittedByProfileUrl,
+  RatingsDisplayText,
+  Count
+};
+
+/**
+ * A page of mods copied out of the SDK response as is. All the text of the page is kept as UTF-8 in a single
+ * buffer, and converted to FString per field the first time a view reads it. Views share the page, so it
+ * lives as long as any view into it. Reading is not thread safe, use the views of a page on one thread.
+ */
+class MODIO_API FModioModViewPage
+{
+public:
+  FModioModViewPage( const ModioMod* ModioMods, u32 ModioModsSize );
+  FModioModViewPage( const FModioModViewPage& Other ) = delete;
+
+  int32 Num() const
+  {
+    return Records.Num();
+  }
+
+private:
+  friend class FModioModView;
+
+  static const int32 NumStrings = (int32)EModioModViewString::Count;
+
+  struct FRecord
+  {
+    int32 Id;
+    int32 GameId;
+    int32 Status;
+    int32 Visible;
+    int32 MaturityOption;
+    int32 DateAdded;
+    int32 DateUpdated;
+    int32 DateLive;
+    int32 SubmittedById;
+    int32 PopularityRankPosition;
+    int32 PopularityRankTotalMods;
+    int32 DownloadsTotal;
+    int32 SubscribersTotal;
+    int32 RatingsTotal;
+    int32 RatingsPositive;
+    int32 RatingsNegative;
+    int32 RatingsPercentagePositive;
+    int32 StatsDateExpires;
+    float RatingsWeightedAggregate;
+    /** Offsets into Text */
+    int32 Strings[NumStrings];
+    /** Range of the mod's tags in Tags */
+    int32 FirstTag;
+    int32 NumTags;
+  };
+
+  /** Appends a null terminated copy of String to Text and returns where it starts */
+  int32 AddString( const char* String );
+
+  const FString& GetString( int32 RecordIndex, EModioModViewString Field ) const;
+
+  TArray<FRecord> Records;
+  TArray<ANSICHAR> Text;
+  struct FTagRecord
+  {
+    /** Offset of the name into Text */
+    int32 Name;
+    int32 DateAdded;
+  };
+
+  TArray<FTagRecord> Tags;
+
+  /** Fields converted so far, one slot per field of every record */
+  mutable TArray<TUniquePtr<FString>> Converted;
+};
+
+/**
+ * Lightweight read only mod, for lists that only show a few fields of each mod. Text fields are converted
+ * when first read. The view doesn't keep the modfile, media or metadata, use GetMod for those.
+ */
+class MODIO_API FModioModView
+{
+public:
+  FModioModView();
+  FModioModView( const TSharedRef<const FModioModViewPage, ESPMode::ThreadSafe>& Page, int32 Index );
+
+  /** Views of every mod in an SDK response, sharing one page */
+  static TArray<FModioModView> MakeViews( const ModioMod* ModioMods, u32 ModioModsSize );
+
+  bool IsValid() const
+  {
+    return Page.IsValid();
+  }
+
+  int32 GetId() const { return GetRecord().Id; }
+  int32 GetGameId() const { return GetRecord().GameId; }
+  int32 GetStatus() const { return GetRecord().Status; }
+  int32 GetVisible() const { return GetRecord().Visible; }
+  int32 GetMaturityOption() const { return GetRecord().MaturityOption; }
+  int32 GetDateAdded() const { return GetRecord().DateAdded; }
+  int32 GetDateUpdated() const { return GetRecord().DateUpdated; }
+  int32 GetDateLive() const { return GetRecord().DateLive; }
+  int32 GetSubmittedById() const { return GetRecord().SubmittedById; }
+
+  /** Any text field, converted on first access */
+  const FString& GetString( EModioModViewString Field ) const;
+
+  const FString& GetName() const { return GetString( EModioModViewString::Name ); }
+  const FString& GetNameId() const { return GetString( EModioModViewString::NameId ); }
+  const FString& GetSummary() const { return GetString( EModioModViewString::Summary ); }
+  const FString& GetDescription() const { return GetString( EModioModViewString::Description ); }
+  const FString& GetProfileUrl() const { return GetString( EModioModViewString::ProfileUrl ); }
+  const FString& GetLogoThumb320x180() const { return GetString( EModioModViewString::LogoThumb320x180 ); }
+  const FString& GetSubmittedByUsername() const { return GetString( EModioModViewString::SubmittedByUsername ); }
+
+  FModioStats GetStats() const;
+  FModioLogo GetLogo() const;
+
+  int32 GetNumTags() const;
+  FString GetTag( int32 TagIndex ) const;
+  int32 GetTagDateAdded( int32 TagIndex ) const;
+
+  /** Full conversion of what the view keeps, Modfile, Media and MetadataKVP are left empty */
+  void ToMod( FModioMod& Mod ) const;
+
+private:
+  const FModioModViewPage::FRecord& GetRecord() const;
+
+  TSharedPtr<const FModioModViewPage, ESPMode::ThreadSafe> Page;
+  int32 Index;
+};
+
+DECLARE_DELEGATE_TwoParams( FModioModViewArrayDelegate, FModioResponse, const TArray<FModioModView> & );
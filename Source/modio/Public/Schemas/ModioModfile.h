@@ -46,7 +46,7 @@ struct FModioModfile
   FModioDownload Download;
 };
 
-extern void InitializeModfile(FModioModfile &modfile, const ModioModfile &modio_modfile);
+extern MODIO_API void InitializeModfile(FModioModfile &modfile, const ModioModfile &modio_modfile);
 
 DECLARE_DELEGATE_TwoParams( FModioModfileDelegate, FModioResponse, FModioModfile );
 DECLARE_DELEGATE_TwoParams( FModioModfileArrayDelegate, FModioResponse, const TArray<FModioModfile> & );
\ No newline at end of file
@@ -24,4 +24,4 @@ struct FModioQueuedModDownload
   FModioMod mod;
 };
 
-extern void InitializeQueuedModDownload(FModioQueuedModDownload &queued_mod_download, const ModioQueuedModDownload &modio_queued_mod_download);
+extern MODIO_API void InitializeQueuedModDownload(FModioQueuedModDownload &queued_mod_download, const ModioQueuedModDownload &modio_queued_mod_download);
@@ -0,0 +1,451 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#include "ModioBenchmarkCommandlet.h"
+#include "ModioBenchmarkPayloads.h"
+#include "ModioCountingMalloc.h"
+#include "ModioUE4Utility.h"
+#include "ModioCompiledFilter.h"
+#include "ModioStringConversion.h"
+#include "ModioModArrayCopy.h"
+#include "ModioSubsystem.h"
+#include "AsyncRequest/ModioAsyncRequest.h"
+#include "AsyncRequest/ModioAsyncRequestPool.h"
+#include "AsyncRequest/ModioAsyncRequestRegistry.h"
+#include "Schemas/ModioModView.h"
+#include "Schemas/ModioInstalledMod.h"
+#include "Schemas/ModioQueuedModDownload.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+
+DEFINE_LOG_CATEGORY_STATIC( LogModioBenchmark, Log, All );
+
+namespace
+{
+  struct FBenchmarkResult
+  {
+    FString Name;
+    int32 NumElements = 0;
+    int32 Iterations = 0;
+    double NsPerElement = 0.0;
+    double AllocationsPerElement = 0.0;
+    double BytesPerElement = 0.0;
+    int64 PeakBytes = 0;
+  };
+
+  struct FBenchmarkSettings
+  {
+    int32 NumElements = 100;
+    int32 Iterations = 50;
+    FString Filter;
+  };
+
+  /**
+   * Runs Function once to warm up, then Iterations times while timing and counting allocations. Function
+   * handles Settings.NumElements elements per call, and frees what it made before returning so the peak is
+   * the peak of a single call
+   */
+  template<typename FunctionType>
+  void RunBenchmark( const FBenchmarkSettings& Settings, const TCHAR* Name, FunctionType Function, TArray<FBenchmarkResult>& OutResults )
+  {
+    if( !Settings.Filter.IsEmpty() && !FCString::Stristr( Name, *Settings.Filter ) )
+    {
+      return;
+    }
+
+    Function();
+
+    FBenchmarkResult& Result = OutResults.AddDefaulted_GetRef();
+    Result.Name = Name;
+    Result.NumElements = Settings.NumElements;
+    Result.Iterations = Settings.Iterations;
+
+    FModioCountingMalloc::FCounts Counts;
+    uint64 Cycles = 0;
+    {
+      FModioCountingMalloc::FScope CountingScope;
+      CountingScope.ResetPeak();
+
+      uint64 StartCycles = FPlatformTime::Cycles64();
+      for( int32 i = 0; i < Settings.Iterations; i++ )
+      {
+        Function();
+      }
+      Cycles = FPlatformTime::Cycles64() - StartCycles;
+      Counts = CountingScope.GetCounts();
+    }
+
+    double NumProcessed = (double)Settings.NumElements * Settings.Iterations;
+    Result.NsPerElement = FPlatformTime::ToSeconds64( Cycles ) * 1000000000.0 / NumProcessed;
+    Result.AllocationsPerElement = Counts.NumAllocations / NumProcessed;
+    Result.BytesPerElement = Counts.AllocatedBytes / NumProcessed;
+    Result.PeakBytes = Counts.PeakBytes;
+
+    UE_LOG( LogModioBenchmark, Display, TEXT( "%-48s %12.1f ns %10.2f allocs %12.1f bytes %12lld peak" ),
+      Name, Result.NsPerElement, Result.AllocationsPerElement, Result.BytesPerElement, Result.PeakBytes );
+  }
+
+  void RunModBenchmarks( const FBenchmarkSettings& Settings, FModioBenchmarkPayloads& Payloads, TArray<FBenchmarkResult>& OutResults )
+  {
+    TArray<ModioMod> Mods;
+    Payloads.MakeMods( Settings.NumElements, Mods );
+
+    RunBenchmark( Settings, TEXT( "Mods/InitializeMod" ), [&]()
+    {
+      TArray<FModioMod> Converted = ConvertModioArray<FModioMod>( Mods.GetData(), Mods.Num(), []( FModioMod& Mod, const ModioMod& modio_mod )
+      {
+        InitializeMod( Mod, modio_mod );
+      }, MAX_int32 );
+    }, OutResults );
+
+    RunBenchmark( Settings, TEXT( "Mods/ConvertToTArrayMods" ), [&]()
+    {
+      TArray<FModioMod> Converted = ConvertToTArrayMods( Mods.GetData(), Mods.Num() );
+    }, OutResults );
+
+    RunBenchmark( Settings, TEXT( "Mods/ConvertToTArrayMods Summary fields" ), [&]()
+    {
+      TArray<FModioMod> Converted = ConvertToTArrayMods( Mods.GetData(), Mods.Num(), EModioModFields::Summary | EModioModFields::Logo | EModioModFields::Stats );
+    }, OutResults );
+
+    // What a response spends holding the SDK lock before the conversion above runs outside of it
+    RunBenchmark( Settings, TEXT( "Mods/FModioModArrayCopy" ), [&]()
+    {
+      FModioModArrayCopy Copy( Mods.GetData(), Mods.Num() );
+    }, OutResults );
+
+    RunBenchmark( Settings, TEXT( "Mods/FModioModView::MakeViews" ), [&]()
+    {
+      TArray<FModioModView> Views = FModioModView::MakeViews( Mods.GetData(), Mods.Num() );
+    }, OutResults );
+
+    RunBenchmark( Settings, TEXT( "Mods/FModioModView name and logo" ), [&]()
+    {
+      TArray<FModioModView> Views = FModioModView::MakeViews( Mods.GetData(), Mods.Num() );
+      for( const FModioModView& View : Views )
+      {
+        View.GetName();
+        View.GetLogoThumb320x180();
+      }
+    }, OutResults );
+  }
+
+  void RunSchemaBenchmarks( const FBenchmarkSettings& Settings, FModioBenchmarkPayloads& Payloads, TArray<FBenchmarkResult>& OutResults )
+  {
+    TArray<ModioModfile> Modfiles;
+    Payloads.MakeModfiles( Settings.NumElements, Modfiles );
+    RunBenchmark( Settings, TEXT( "Modfiles/ConvertToTArrayModfiles" ), [&]()
+    {
+      TArray<FModioModfile> Converted = ConvertToTArrayModfiles( Modfiles.GetData(), Modfiles.Num() );
+    }, OutResults );
+
+    TArray<ModioModEvent> ModEvents;
+    Payloads.MakeModEvents( Settings.NumElements, ModEvents );
+    RunBenchmark( Settings, TEXT( "ModEvents/ConvertToTArrayModEvents" ), [&]()
+    {
+      TArray<FModioModEvent> Converted = ConvertToTArrayModEvents( ModEvents.GetData(), ModEvents.Num() );
+    }, OutResults );
+
+    TArray<ModioInstalledMod> InstalledMods;
+    Payloads.MakeInstalledMods( Settings.NumElements, InstalledMods );
+    RunBenchmark( Settings, TEXT( "InstalledMods/InitializeInstalledMod" ), [&]()
+    {
+      TArray<FModioInstalledMod> Converted = ConvertModioArray<FModioInstalledMod>( InstalledMods.GetData(), InstalledMods.Num(), &InitializeInstalledMod, MAX_int32 );
+    }, OutResults );
+
+    TArray<ModioQueuedModDownload> QueuedModDownloads;
+    Payloads.MakeQueuedModDownloads( Settings.NumElements, QueuedModDownloads );
+    RunBenchmark( Settings, TEXT( "QueuedModDownloads/InitializeQueuedModDownload" ), [&]()
+    {
+      TArray<FModioQueuedModDownload> Converted = ConvertModioArray<FModioQueuedModDownload>( QueuedModDownloads.GetData(), QueuedModDownloads.Num(), &InitializeQueuedModDownload, MAX_int32 );
+    }, OutResults );
+  }
+
+  void RunStringBenchmarks( const FBenchmarkSettings& Settings, FModioBenchmarkPayloads& Payloads, TArray<FBenchmarkResult>& OutResults )
+  {
+    TArray<const char*> Texts;
+    TArray<const char*> Urls;
+    for( int32 i = 0; i < Settings.NumElements; i++ )
+    {
+      Texts.Add( Payloads.MakeUtf8Text( 200 ) );
+      Urls.Add( Payloads.MakeUrl() );
+    }
+
+    RunBenchmark( Settings, TEXT( "Strings/UTF8_TO_TCHAR" ), [&]()
+    {
+      for( const char* Text : Texts )
+      {
+        FString String = UTF8_TO_TCHAR( Text );
+      }
+    }, OutResults );
+
+    RunBenchmark( Settings, TEXT( "Strings/ModioUtf8ToString" ), [&]()
+    {
+      for( const char* Text : Texts )
+      {
+        FString String;
+        ModioUtf8ToString( String, Text );
+      }
+    }, OutResults );
+
+    RunBenchmark( Settings, TEXT( "Strings/ModioUtf8ToString urls" ), [&]()
+    {
+      for( const char* Url : Urls )
+      {
+        FString String;
+        ModioUtf8ToString( String, Url );
+      }
+    }, OutResults );
+  }
+
+  void RunMarshallingBenchmarks( const FBenchmarkSettings& Settings, FModioBenchmarkPayloads& Payloads, TArray<FBenchmarkResult>& OutResults )
+  {
+    TArray<FString> Strings;
+    TMap<FString, FString> MetadataKVP;
+    for( int32 i = 0; i < Settings.NumElements; i++ )
+    {
+      Strings.Add( Payloads.MakeText( 16 ) );
+      MetadataKVP.Add( FString::Printf( TEXT( "key_%d" ), i ), Payloads.MakeText( 8 ) );
+    }
+
+    RunBenchmark( Settings, TEXT( "Marshalling/FModioUtf8StringArray" ), [&]()
+    {
+      FModioUtf8StringArray Array( Strings );
+    }, OutResults );
+
+    RunBenchmark( Settings, TEXT( "Marshalling/FModioUtf8StringArray metadata" ), [&]()
+    {
+      FModioUtf8StringArray Array( MetadataKVP );
+    }, OutResults );
+
+    // The creators are set up once per call in the subsystem, so each element is a whole creator
+    FModioFilterCreator FilterCreator;
+    FilterCreator.Sort.ModSortType = EModioModSortType::SORT_BY_POPULAR;
+    FilterCreator.Sort.Ascending = true;
+    FilterCreator.FullTextSearch = Payloads.MakeText( 16 );
+    TArray<FString> ModTags = { TEXT( "Maps" ), TEXT( "Multiplayer" ), TEXT( "Realistic" ) };
+    RunBenchmark( Settings, TEXT( "Creators/SetupModioModFilterCreator" ), [&]()
+    {
+      for( int32 i = 0; i < Settings.NumElements; i++ )
+      {
+        ModioFilterCreator modio_filter_creator;
+        modioInitFilter( &modio_filter_creator );
+        SetupModioModFilterCreator( FilterCreator, ModTags, 100, i * 100, modio_filter_creator );
+        modioFreeFilter( &modio_filter_creator );
+      }
+    }, OutResults );
+
+    // Paging a compiled filter, the filter is compiled once and each element is a page
+    FModioCompiledFilterRef CompiledFilter = FModioCompiledFilter::Compile( FilterCreator, ModTags );
+    RunBenchmark( Settings, TEXT( "Creators/FModioCompiledFilter pages" ), [&]()
+    {
+      for( int32 i = 0; i < Settings.NumElements; i++ )
+      {
+        TArray<ANSICHAR> PageQuery = CompiledFilter->MakePageQuery( 100, i * 100 );
+      }
+    }, OutResults );
+
+    FModioModCreator ModCreator;
+    ModCreator.Name = Payloads.MakeText( 24 );
+    ModCreator.NameId = Payloads.MakeText( 24 );
+    ModCreator.Summary = Payloads.MakeText( 200 );
+    ModCreator.Description = Payloads.MakeText( 2000 );
+    ModCreator.HomepageUrl = UTF8_TO_TCHAR( Payloads.MakeUrl() );
+    ModCreator.LogoPath = TEXT( "/home/player/logo.png" );
+    ModCreator.Tags = ModTags;
+    ModCreator.Visible = EModioBooleanCustomizableType::SET_TO_TRUE;
+    RunBenchmark( Settings, TEXT( "Creators/SetupModioModCreator" ), [&]()
+    {
+      for( int32 i = 0; i < Settings.NumElements; i++ )
+      {
+        ModioModCreator modio_mod_creator;
+        modioInitModCreator( &modio_mod_creator );
+        SetupModioModCreator( ModCreator, modio_mod_creator );
+        modioFreeModCreator( &modio_mod_creator );
+      }
+    }, OutResults );
+
+    FModioModEditor ModEditor;
+    ModEditor.Name = ModCreator.Name;
+    ModEditor.Summary = ModCreator.Summary;
+    ModEditor.Description = ModCreator.Description;
+    ModEditor.Visible = EModioBooleanCustomizableType::SET_TO_FALSE;
+    RunBenchmark( Settings, TEXT( "Creators/SetupModioModEditor" ), [&]()
+    {
+      for( int32 i = 0; i < Settings.NumElements; i++ )
+      {
+        ModioModEditor modio_mod_editor;
+        modioInitModEditor( &modio_mod_editor );
+        SetupModioModEditor( ModEditor, modio_mod_editor );
+        modioFreeModEditor( &modio_mod_editor );
+      }
+    }, OutResults );
+
+    // Without a path, setting it converts to the local code page which isn't what is measured here
+    FModioModfileCreator ModfileCreator;
+    ModfileCreator.Version = TEXT( "1.0.3" );
+    ModfileCreator.Changelog = Payloads.MakeText( 400 );
+    ModfileCreator.Active = EModioBooleanCustomizableType::SET_TO_TRUE;
+    RunBenchmark( Settings, TEXT( "Creators/SetupModioModfileCreator" ), [&]()
+    {
+      for( int32 i = 0; i < Settings.NumElements; i++ )
+      {
+        ModioModfileCreator modio_modfile_creator;
+        modioInitModfileCreator( &modio_modfile_creator );
+        SetupModioModfileCreator( ModfileCreator, modio_modfile_creator );
+        modioFreeModfileCreator( &modio_modfile_creator );
+      }
+    }, OutResults );
+  }
+
+  /** Never issued, holds a delegate like the real requests do */
+  struct FBenchmarkRequest : public FModioAsyncRequest
+  {
+    FBenchmarkRequest( FModioSubsystem* Modio ) :
+      FModioAsyncRequest( Modio )
+    {
+    }
+
+    FModioModDelegate ResponseDelegate;
+  };
+
+  FModioAsyncRequestHandle AddBenchmarkRequest( FModioAsyncRequestRegistry& Registry, FModioSubsystem* Modio )
+  {
+    void* Memory = TModioAsyncRequestPool<FBenchmarkRequest>::Allocate();
+    return Registry.Add( new (Memory) FBenchmarkRequest( Modio ), &TModioAsyncRequestPool<FBenchmarkRequest>::Destroy );
+  }
+
+  void RunRequestBenchmarks( const FBenchmarkSettings& Settings, TArray<FBenchmarkResult>& OutResults )
+  {
+    // Requests have to point at a subsystem, the module only makes one when the plugin is configured
+    FModioSubsystemPtr Modio = FModioSubsystem::Get( nullptr );
+    if( !Modio.IsValid() )
+    {
+      UE_LOG( LogModioBenchmark, Warning, TEXT( "No mod.io subsystem, skipping the request benchmarks" ) );
+      return;
+    }
+
+    // Each element finishes the oldest of the live requests, creates a new one and looks up another, so the
+    // amount in flight stays put. The cost per element should be the same however many are in flight
+    for( int32 NumLive : { 10, 100, 1000, 10000 } )
+    {
+      FModioAsyncRequestRegistry Registry;
+      TArray<FModioAsyncRequestHandle> Live;
+      for( int32 i = 0; i < NumLive; i++ )
+      {
+        Live.Add( AddBenchmarkRequest( Registry, Modio.Get() ) );
+      }
+
+      int32 Oldest = 0;
+      FString Name = FString::Printf( TEXT( "Requests/registry and pool %d in flight" ), NumLive );
+      RunBenchmark( Settings, *Name, [&]()
+      {
+        for( int32 i = 0; i < Settings.NumElements; i++ )
+        {
+          Registry.Remove( Live[Oldest] );
+          Live[Oldest] = AddBenchmarkRequest( Registry, Modio.Get() );
+          Registry.Find( Live[( Oldest * 7919 ) % NumLive] );
+          Oldest = ( Oldest + 1 ) % NumLive;
+        }
+      }, OutResults );
+    }
+  }
+
+  void WriteCsv( const FString& Path, const TArray<FBenchmarkResult>& Results )
+  {
+    FString Csv = TEXT( "Name,Elements,Iterations,NsPerElement,AllocationsPerElement,BytesPerElement,PeakBytes\n" );
+    for( const FBenchmarkResult& Result : Results )
+    {
+      Csv += FString::Printf( TEXT( "%s,%d,%d,%.2f,%.3f,%.1f,%lld\n" ), *Result.Name, Result.NumElements, Result.Iterations,
+        Result.NsPerElement, Result.AllocationsPerElement, Result.BytesPerElement, Result.PeakBytes );
+    }
+    if( !FFileHelper::SaveStringToFile( Csv, *Path ) )
+    {
+      UE_LOG( LogModioBenchmark, Error, TEXT( "Couldn't write results to %s" ), *Path );
+    }
+  }
+
+  /** Compares against a csv written by an earlier run, returns the amount of regressed benchmarks */
+  int32 CompareToBaseline( const FString& Path, float Tolerance, const TArray<FBenchmarkResult>& Results )
+  {
+    TArray<FString> Lines;
+    if( !FFileHelper::LoadFileToStringArray( Lines, *Path ) )
+    {
+      UE_LOG( LogModioBenchmark, Error, TEXT( "Couldn't read baseline %s" ), *Path );
+      return 1;
+    }
+
+    int32 NumRegressed = 0;
+    for( int32 i = 1; i < Lines.Num(); i++ )
+    {
+      TArray<FString> Columns;
+      if( Lines[i].ParseIntoArray( Columns, TEXT( "," ) ) < 6 )
+      {
+        continue;
+      }
+
+      const FBenchmarkResult* Result = Results.FindByPredicate( [&Columns]( const FBenchmarkResult& Result ) { return Result.Name == Columns[0]; } );
+      if( !Result )
+      {
+        continue;
+      }
+
+      double BaselineNs = FCString::Atod( *Columns[3] );
+      double BaselineAllocations = FCString::Atod( *Columns[4] );
+      // Allocation counts are exact, a small absolute slack covers the task graph's own allocations
+      if( Result->NsPerElement > BaselineNs * ( 1.0 + Tolerance ) || Result->AllocationsPerElement > BaselineAllocations + 0.05 )
+      {
+        UE_LOG( LogModioBenchmark, Error, TEXT( "%s regressed: %.1f ns and %.2f allocs per element, baseline %.1f ns and %.2f allocs" ),
+          *Result->Name, Result->NsPerElement, Result->AllocationsPerElement, BaselineNs, BaselineAllocations );
+        NumRegressed++;
+      }
+    }
+    return NumRegressed;
+  }
+}
+
+UModioBenchmarkCommandlet::UModioBenchmarkCommandlet()
+{
+  IsClient = false;
+  IsEditor = false;
+  IsServer = false;
+  LogToConsole = true;
+}
+
+int32 UModioBenchmarkCommandlet::Main( const FString& Params )
+{
+  FBenchmarkSettings Settings;
+  FParse::Value( *Params, TEXT( "elements=" ), Settings.NumElements );
+  FParse::Value( *Params, TEXT( "iterations=" ), Settings.Iterations );
+  FParse::Value( *Params, TEXT( "filter=" ), Settings.Filter );
+  Settings.NumElements = FMath::Max( Settings.NumElements, 1 );
+  Settings.Iterations = FMath::Max( Settings.Iterations, 1 );
+
+  float NonAsciiFraction = 0.05f;
+  FParse::Value( *Params, TEXT( "nonascii=" ), NonAsciiFraction );
+
+  UE_LOG( LogModioBenchmark, Display, TEXT( "%d elements, %d iterations, per element:" ), Settings.NumElements, Settings.Iterations );
+
+  FModioBenchmarkPayloads Payloads( 1234, NonAsciiFraction );
+  TArray<FBenchmarkResult> Results;
+  RunModBenchmarks( Settings, Payloads, Results );
+  RunSchemaBenchmarks( Settings, Payloads, Results );
+  RunStringBenchmarks( Settings, Payloads, Results );
+  RunMarshallingBenchmarks( Settings, Payloads, Results );
+  RunRequestBenchmarks( Settings, Results );
+
+  FString CsvPath;
+  if( FParse::Value( *Params, TEXT( "csv=" ), CsvPath ) )
+  {
+    WriteCsv( CsvPath, Results );
+  }
+
+  FString BaselinePath;
+  if( FParse::Value( *Params, TEXT( "baseline=" ), BaselinePath ) )
+  {
+    float Tolerance = 0.2f;
+    FParse::Value( *Params, TEXT( "tolerance=" ), Tolerance );
+    return CompareToBaseline( BaselinePath, Tolerance, Results ) ? 1 : 0;
+  }
+  return 0;
+}
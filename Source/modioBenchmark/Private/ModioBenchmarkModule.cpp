@@ -0,0 +1,6 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE( FDefaultModuleImpl, modioBenchmark )
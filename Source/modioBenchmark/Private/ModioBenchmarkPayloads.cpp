@@ -0,0 +1,282 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#include "ModioBenchmarkPayloads.h"
+
+static const char* AsciiWords[] =
+{
+  "the", "map", "pack", "weapon", "texture", "overhaul", "quest", "sound", "fix", "balance", "armor", "night",
+  "city", "forest", "vehicle", "skin", "campaign", "mission", "realistic", "lighting", "update", "classic",
+  "hardcore", "survival", "multiplayer", "compatible", "version", "adds", "new", "and", "with", "for"
+};
+
+/** UTF-8 of words in a few scripts, two to four bytes per character */
+static const char* NonAsciiWords[] =
+{
+  "gr\xC3\xB6\xC3\x9F" "e", "\xC3\xA9" "dition", "\xD0\x9A\xD0\xB0\xD1\x80\xD1\x82\xD0\xB0",
+  "\xE3\x83\xA2\xE3\x83\x83\xE3\x83\x89", "\xE5\x9C\xB0\xE5\x9B\xBE", "\xF0\x9F\x8E\xAE",
+  "\xCE\xBA\xCF\x8C\xCF\x83\xCE\xBC\xCE\xBF\xCF\x82", "ni\xC3\xB1" "o"
+};
+
+static const char* TagNames[] =
+{
+  "Maps", "Weapons", "Textures", "Audio", "Gameplay", "UI", "Characters", "Vehicles", "Easy", "Medium",
+  "Hard", "Singleplayer", "Multiplayer", "Co-op", "Realistic", "Arcade"
+};
+
+static const char* MetadataKeys[] =
+{
+  "map_size", "engine_version", "min_players", "max_players", "difficulty", "requires_dlc"
+};
+
+/** Random item of a fixed size array */
+template<typename Type, int32 Num>
+static const Type& PickOne( FRandomStream& Random, Type (&Items)[Num] )
+{
+  return Items[Random.RandRange( 0, Num - 1 )];
+}
+
+FModioBenchmarkPayloads::FModioBenchmarkPayloads( int32 Seed, float InNonAsciiFraction ) :
+  Random( Seed ),
+  NonAsciiFraction( InNonAsciiFraction ),
+  NextId( 1 )
+{
+}
+
+FModioBenchmarkPayloads::~FModioBenchmarkPayloads()
+{
+  for( void* Block : Blocks )
+  {
+    FMemory::Free( Block );
+  }
+}
+
+void FModioBenchmarkPayloads::MakeMods( int32 Num, TArray<ModioMod>& OutMods )
+{
+  OutMods.SetNumZeroed( Num );
+  for( ModioMod& Mod : OutMods )
+  {
+    FillMod( Mod );
+  }
+}
+
+void FModioBenchmarkPayloads::MakeModfiles( int32 Num, TArray<ModioModfile>& OutModfiles )
+{
+  OutModfiles.SetNumZeroed( Num );
+  for( ModioModfile& Modfile : OutModfiles )
+  {
+    FillModfile( Modfile, NextId++ );
+  }
+}
+
+void FModioBenchmarkPayloads::MakeModEvents( int32 Num, TArray<ModioModEvent>& OutModEvents )
+{
+  OutModEvents.SetNumZeroed( Num );
+  for( ModioModEvent& ModEvent : OutModEvents )
+  {
+    ModEvent.id = NextId++;
+    ModEvent.mod_id = Random.RandRange( 1, 100000 );
+    ModEvent.user_id = Random.RandRange( 1, 100000 );
+    ModEvent.event_type = Random.RandRange( MODIO_EVENT_MODFILE_CHANGED, MODIO_EVENT_MOD_EDITED );
+    ModEvent.date_added = 1500000000 + Random.RandRange( 0, 100000000 );
+  }
+}
+
+void FModioBenchmarkPayloads::MakeInstalledMods( int32 Num, TArray<ModioInstalledMod>& OutInstalledMods )
+{
+  OutInstalledMods.SetNumZeroed( Num );
+  for( ModioInstalledMod& InstalledMod : OutInstalledMods )
+  {
+    FillMod( InstalledMod.mod );
+    InstalledMod.mod_id = InstalledMod.mod.id;
+    InstalledMod.modfile_id = InstalledMod.mod.modfile.id;
+    InstalledMod.date_updated = InstalledMod.mod.date_updated;
+    FString Path = FString::Printf( TEXT( "/home/player/.local/share/game/modio/mods/%u/" ), InstalledMod.mod_id );
+    InstalledMod.path = AddString( TCHAR_TO_UTF8( *Path ), Path.Len() );
+  }
+}
+
+void FModioBenchmarkPayloads::MakeQueuedModDownloads( int32 Num, TArray<ModioQueuedModDownload>& OutQueuedModDownloads )
+{
+  OutQueuedModDownloads.SetNumZeroed( Num );
+  for( ModioQueuedModDownload& QueuedModDownload : OutQueuedModDownloads )
+  {
+    FillMod( QueuedModDownload.mod );
+    QueuedModDownload.mod_id = QueuedModDownload.mod.id;
+    QueuedModDownload.state = Random.RandRange( 0, 3 );
+    QueuedModDownload.total_size = QueuedModDownload.mod.modfile.filesize;
+    QueuedModDownload.current_progress = QueuedModDownload.total_size * Random.FRand();
+    QueuedModDownload.url = QueuedModDownload.mod.modfile.download.binary_url;
+    FString Path = FString::Printf( TEXT( "/home/player/.local/share/game/modio/tmp/%u_modfile.zip" ), QueuedModDownload.mod_id );
+    QueuedModDownload.path = AddString( TCHAR_TO_UTF8( *Path ), Path.Len() );
+  }
+}
+
+FString FModioBenchmarkPayloads::MakeText( int32 Length )
+{
+  return UTF8_TO_TCHAR( MakeUtf8Text( Length ) );
+}
+
+const char* FModioBenchmarkPayloads::MakeUtf8Text( int32 Length )
+{
+  TArray<ANSICHAR> Text;
+  Text.Reserve( Length + 16 );
+  while( Text.Num() < Length )
+  {
+    if( Text.Num() )
+    {
+      Text.Add( ' ' );
+    }
+    AppendWord( Text );
+  }
+  return AddString( Text.GetData(), Text.Num() );
+}
+
+const char* FModioBenchmarkPayloads::MakeUrl()
+{
+  // Few distinct hosts and paths, the way logo and avatar urls of the same users repeat in real responses
+  static const char* Kinds[] = { "logos", "avatars", "images", "modfiles" };
+  char Url[128];
+  int32 Length = FCStringAnsi::Sprintf( Url, "https://thumb.modcdn.io/mods/%s/%d/thumb_320x180.png",
+    PickOne( Random, Kinds ), Random.RandRange( 1, 200 ) );
+  return AddString( Url, Length );
+}
+
+void FModioBenchmarkPayloads::FillMod( ModioMod& Mod )
+{
+  Mod.id = NextId++;
+  Mod.game_id = 5;
+  Mod.status = 1;
+  Mod.visible = Random.RandRange( 0, 9 ) != 0;
+  Mod.maturity_option = Random.RandRange( 0, 15 );
+  Mod.date_added = 1500000000 + Random.RandRange( 0, 100000000 );
+  Mod.date_updated = Mod.date_added + Random.RandRange( 0, 10000000 );
+  Mod.date_live = Mod.date_added + Random.RandRange( 0, 1000 );
+
+  Mod.homepage_url = Random.RandRange( 0, 3 ) == 0 ? (char*)MakeUrl() : nullptr;
+  Mod.name = (char*)MakeUtf8Text( Random.RandRange( 10, 40 ) );
+  Mod.name_id = (char*)MakeUtf8Text( Random.RandRange( 10, 40 ) );
+  Mod.summary = (char*)MakeUtf8Text( Random.RandRange( 100, 250 ) );
+  Mod.description = (char*)MakeUtf8Text( Random.RandRange( 1000, 4000 ) );
+  Mod.description_plaintext = (char*)MakeUtf8Text( Random.RandRange( 800, 3000 ) );
+  Mod.metadata_blob = Random.RandRange( 0, 2 ) == 0 ? (char*)MakeUtf8Text( Random.RandRange( 20, 200 ) ) : nullptr;
+  Mod.profile_url = (char*)MakeUrl();
+
+  Mod.logo.filename = (char*)MakeUtf8Text( 16 );
+  Mod.logo.original = (char*)MakeUrl();
+  Mod.logo.thumb_320x180 = (char*)MakeUrl();
+  Mod.logo.thumb_640x360 = (char*)MakeUrl();
+  Mod.logo.thumb_1280x720 = (char*)MakeUrl();
+
+  FillUser( Mod.submitted_by );
+  FillModfile( Mod.modfile, Mod.id );
+
+  Mod.media.youtube_size = Random.RandRange( 0, 2 );
+  Mod.media.youtube_array = AddArray<char*>( Mod.media.youtube_size );
+  for( u32 i = 0; i < Mod.media.youtube_size; i++ )
+  {
+    Mod.media.youtube_array[i] = (char*)MakeUrl();
+  }
+  Mod.media.sketchfab_size = Random.RandRange( 0, 1 );
+  Mod.media.sketchfab_array = AddArray<char*>( Mod.media.sketchfab_size );
+  for( u32 i = 0; i < Mod.media.sketchfab_size; i++ )
+  {
+    Mod.media.sketchfab_array[i] = (char*)MakeUrl();
+  }
+  Mod.media.images_size = Random.RandRange( 0, 8 );
+  Mod.media.images_array = AddArray<ModioImage>( Mod.media.images_size );
+  for( u32 i = 0; i < Mod.media.images_size; i++ )
+  {
+    Mod.media.images_array[i].filename = (char*)MakeUtf8Text( 16 );
+    Mod.media.images_array[i].original = (char*)MakeUrl();
+    Mod.media.images_array[i].thumb_320x180 = (char*)MakeUrl();
+  }
+
+  Mod.stats.mod_id = Mod.id;
+  Mod.stats.popularity_rank_position = Random.RandRange( 1, 10000 );
+  Mod.stats.popularity_rank_total_mods = 10000;
+  Mod.stats.downloads_total = Random.RandRange( 0, 1000000 );
+  Mod.stats.subscribers_total = Random.RandRange( 0, 100000 );
+  Mod.stats.ratings_positive = Random.RandRange( 0, 5000 );
+  Mod.stats.ratings_negative = Random.RandRange( 0, 500 );
+  Mod.stats.ratings_total = Mod.stats.ratings_positive + Mod.stats.ratings_negative;
+  Mod.stats.ratings_percentage_positive = Mod.stats.ratings_total ? Mod.stats.ratings_positive * 100 / Mod.stats.ratings_total : 0;
+  Mod.stats.ratings_weighted_aggregate = Random.FRand();
+  Mod.stats.ratings_display_text = (char*)"Very Positive";
+  Mod.stats.date_expires = Mod.date_updated + 86400;
+
+  Mod.tags_array_size = Random.RandRange( 3, 8 );
+  Mod.tags_array = AddArray<ModioTag>( Mod.tags_array_size );
+  for( u32 i = 0; i < Mod.tags_array_size; i++ )
+  {
+    Mod.tags_array[i].date_added = Mod.date_added;
+    Mod.tags_array[i].name = (char*)PickOne( Random, TagNames );
+  }
+
+  Mod.metadata_kvp_array_size = Random.RandRange( 0, 6 );
+  Mod.metadata_kvp_array = AddArray<ModioMetadataKVP>( Mod.metadata_kvp_array_size );
+  for( u32 i = 0; i < Mod.metadata_kvp_array_size; i++ )
+  {
+    char Value[16];
+    int32 Length = FCStringAnsi::Sprintf( Value, "%d", Random.RandRange( 1, 64 ) );
+    Mod.metadata_kvp_array[i].metakey = (char*)MetadataKeys[i % ( sizeof( MetadataKeys ) / sizeof( MetadataKeys[0] ) )];
+    Mod.metadata_kvp_array[i].metavalue = AddString( Value, Length );
+  }
+}
+
+void FModioBenchmarkPayloads::FillModfile( ModioModfile& Modfile, u32 ModId )
+{
+  Modfile.id = NextId++;
+  Modfile.mod_id = ModId;
+  Modfile.virus_status = 1;
+  Modfile.virus_positive = 0;
+  Modfile.date_added = 1500000000 + Random.RandRange( 0, 100000000 );
+  Modfile.date_scanned = Modfile.date_added + 600;
+  Modfile.filesize = Random.RandRange( 100000, 500000000 );
+  Modfile.filename = (char*)MakeUtf8Text( 24 );
+  Modfile.version = (char*)"1.0.3";
+  Modfile.virustotal_hash = (char*)MakeUtf8Text( 64 );
+  Modfile.changelog = (char*)MakeUtf8Text( Random.RandRange( 0, 600 ) );
+  Modfile.metadata_blob = nullptr;
+  Modfile.filehash.md5 = (char*)MakeUtf8Text( 32 );
+  Modfile.download.binary_url = (char*)MakeUrl();
+  Modfile.download.date_expires = Modfile.date_added + 3600;
+}
+
+void FModioBenchmarkPayloads::FillUser( ModioUser& User )
+{
+  User.id = Random.RandRange( 1, 100000 );
+  User.date_online = 1500000000 + Random.RandRange( 0, 100000000 );
+  User.username = (char*)MakeUtf8Text( Random.RandRange( 4, 16 ) );
+  User.name_id = (char*)MakeUtf8Text( Random.RandRange( 4, 16 ) );
+  User.timezone = (char*)"Europe/Helsinki";
+  User.language = (char*)"en";
+  User.profile_url = (char*)MakeUrl();
+  User.avatar.filename = (char*)MakeUtf8Text( 16 );
+  User.avatar.original = (char*)MakeUrl();
+  User.avatar.thumb_50x50 = (char*)MakeUrl();
+  User.avatar.thumb_100x100 = (char*)MakeUrl();
+}
+
+char* FModioBenchmarkPayloads::AddString( const char* String, int32 Length )
+{
+  char* Copy = (char*)AddBlock( Length + 1 );
+  FMemory::Memcpy( Copy, String, Length );
+  Copy[Length] = '\0';
+  return Copy;
+}
+
+void* FModioBenchmarkPayloads::AddBlock( SIZE_T Size )
+{
+  void* Block = FMemory::MallocZeroed( Size );
+  Blocks.Add( Block );
+  return Block;
+}
+
+void FModioBenchmarkPayloads::AppendWord( TArray<ANSICHAR>& Text )
+{
+  const char* Word = Random.FRand() < NonAsciiFraction ?
+    PickOne( Random, NonAsciiWords ) :
+    PickOne( Random, AsciiWords );
+  Text.Append( Word, FCStringAnsi::Strlen( Word ) );
+}
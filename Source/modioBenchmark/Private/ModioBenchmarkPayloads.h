@@ -0,0 +1,64 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+#include "c/ModioC.h"
+
+/**
+ * Synthetic SDK structs shaped like real responses: mods with a few KB of description, a handful of tags,
+ * metadata and media, full modfiles and submitters. Everything they point to is owned by the payloads and
+ * freed with them. The same seed always gives the same payloads
+ */
+class FModioBenchmarkPayloads
+{
+public:
+  /** NonAsciiFraction of the generated words are non ASCII, to exercise the multibyte paths */
+  FModioBenchmarkPayloads( int32 Seed, float NonAsciiFraction );
+  ~FModioBenchmarkPayloads();
+
+  FModioBenchmarkPayloads( const FModioBenchmarkPayloads& Other ) = delete;
+  FModioBenchmarkPayloads& operator=( const FModioBenchmarkPayloads& Other ) = delete;
+
+  void MakeMods( int32 Num, TArray<ModioMod>& OutMods );
+  void MakeModfiles( int32 Num, TArray<ModioModfile>& OutModfiles );
+  void MakeModEvents( int32 Num, TArray<ModioModEvent>& OutModEvents );
+  void MakeInstalledMods( int32 Num, TArray<ModioInstalledMod>& OutInstalledMods );
+  void MakeQueuedModDownloads( int32 Num, TArray<ModioQueuedModDownload>& OutQueuedModDownloads );
+
+  /** Text of about Length bytes made of words */
+  FString MakeText( int32 Length );
+
+  /** Null terminated UTF-8 text of about Length bytes, owned by the payloads */
+  const char* MakeUtf8Text( int32 Length );
+
+  /** Url like strings, many of them repeating like avatar and logo urls do */
+  const char* MakeUrl();
+
+private:
+  void FillMod( ModioMod& Mod );
+  void FillModfile( ModioModfile& Modfile, u32 ModId );
+  void FillUser( ModioUser& User );
+
+  /** Copy of the string owned by the payloads */
+  char* AddString( const char* String, int32 Length );
+
+  /** Zeroed array owned by the payloads */
+  template<typename Type>
+  Type* AddArray( int32 Num )
+  {
+    return Num > 0 ? (Type*)AddBlock( Num * sizeof( Type ) ) : nullptr;
+  }
+
+  void* AddBlock( SIZE_T Size );
+
+  void AppendWord( TArray<ANSICHAR>& Text );
+
+  FRandomStream Random;
+  float NonAsciiFraction;
+  u32 NextId;
+
+  TArray<void*> Blocks;
+};
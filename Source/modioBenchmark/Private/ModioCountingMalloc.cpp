@@ -0,0 +1,135 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#include "ModioCountingMalloc.h"
+#include "HAL/PlatformAtomics.h"
+
+FModioCountingMalloc::FScope::FScope() :
+  PreviousMalloc( GMalloc )
+{
+  FModioCountingMalloc& Counting = Get();
+  check( GMalloc != &Counting );
+
+  Counting.Inner = GMalloc;
+  Counting.NumAllocations = 0;
+  Counting.AllocatedBytes = 0;
+  Counting.HeldBytes = 0;
+  Counting.PeakBytes = 0;
+  Counting.PeakBase = 0;
+  FPlatformMisc::MemoryBarrier();
+  GMalloc = &Counting;
+}
+
+FModioCountingMalloc::FScope::~FScope()
+{
+  // Blocks allocated meanwhile are freed straight by the wrapped allocator from now on, which is fine as it
+  // owns them
+  GMalloc = PreviousMalloc;
+  FPlatformMisc::MemoryBarrier();
+}
+
+FModioCountingMalloc::FCounts FModioCountingMalloc::FScope::GetCounts() const
+{
+  const FModioCountingMalloc& Counting = Get();
+
+  FCounts Counts;
+  Counts.NumAllocations = Counting.NumAllocations;
+  Counts.AllocatedBytes = Counting.AllocatedBytes;
+  Counts.PeakBytes = FMath::Max<int64>( Counting.PeakBytes - Counting.PeakBase, 0 );
+  return Counts;
+}
+
+void FModioCountingMalloc::FScope::ResetPeak()
+{
+  FModioCountingMalloc& Counting = Get();
+  Counting.PeakBase = Counting.HeldBytes;
+  Counting.PeakBytes = Counting.HeldBytes;
+}
+
+FModioCountingMalloc& FModioCountingMalloc::Get()
+{
+  static FModioCountingMalloc Counting;
+  return Counting;
+}
+
+void* FModioCountingMalloc::Malloc( SIZE_T Count, uint32 Alignment )
+{
+  void* Block = Inner->Malloc( Count, Alignment );
+  FPlatformAtomics::InterlockedIncrement( &NumAllocations );
+  FPlatformAtomics::InterlockedAdd( &AllocatedBytes, (int64)Count );
+  AddHeldBytes( (int64)GetBlockSize( Block ) );
+  return Block;
+}
+
+void* FModioCountingMalloc::Realloc( void* Original, SIZE_T Count, uint32 Alignment )
+{
+  int64 OldSize = Original ? (int64)GetBlockSize( Original ) : 0;
+  void* Block = Inner->Realloc( Original, Count, Alignment );
+  if( Count )
+  {
+    FPlatformAtomics::InterlockedIncrement( &NumAllocations );
+    FPlatformAtomics::InterlockedAdd( &AllocatedBytes, (int64)Count );
+  }
+  AddHeldBytes( ( Block ? (int64)GetBlockSize( Block ) : 0 ) - OldSize );
+  return Block;
+}
+
+void FModioCountingMalloc::Free( void* Original )
+{
+  if( Original )
+  {
+    AddHeldBytes( -(int64)GetBlockSize( Original ) );
+  }
+  Inner->Free( Original );
+}
+
+SIZE_T FModioCountingMalloc::QuantizeSize( SIZE_T Count, uint32 Alignment )
+{
+  return Inner->QuantizeSize( Count, Alignment );
+}
+
+bool FModioCountingMalloc::GetAllocationSize( void* Original, SIZE_T& SizeOut )
+{
+  return Inner->GetAllocationSize( Original, SizeOut );
+}
+
+void FModioCountingMalloc::SetupTLSCachesOnCurrentThread()
+{
+  Inner->SetupTLSCachesOnCurrentThread();
+}
+
+void FModioCountingMalloc::ClearAndDisableTLSCachesOnCurrentThread()
+{
+  Inner->ClearAndDisableTLSCachesOnCurrentThread();
+}
+
+bool FModioCountingMalloc::IsInternallyThreadSafe() const
+{
+  return Inner->IsInternallyThreadSafe();
+}
+
+const TCHAR* FModioCountingMalloc::GetDescriptiveName()
+{
+  return TEXT( "ModioCountingMalloc" );
+}
+
+SIZE_T FModioCountingMalloc::GetBlockSize( void* Block )
+{
+  SIZE_T Size = 0;
+  return Inner->GetAllocationSize( Block, Size ) ? Size : 0;
+}
+
+void FModioCountingMalloc::AddHeldBytes( int64 Bytes )
+{
+  int64 Held = FPlatformAtomics::InterlockedAdd( &HeldBytes, Bytes ) + Bytes;
+  int64 Peak = PeakBytes;
+  while( Held > Peak )
+  {
+    int64 Seen = FPlatformAtomics::InterlockedCompareExchange( &PeakBytes, Held, Peak );
+    if( Seen == Peak )
+    {
+      break;
+    }
+    Peak = Seen;
+  }
+}
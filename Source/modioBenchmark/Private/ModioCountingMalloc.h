@@ -0,0 +1,68 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/MemoryBase.h"
+
+/**
+ * Wraps GMalloc while a FScope is alive, counting the allocations made from any thread and the bytes they
+ * hold. Sizes come from the wrapped allocator, so an allocator that can't tell them only gets counted.
+ * Meant for the benchmark commandlet, where nothing else should be allocating much at the same time
+ */
+class FModioCountingMalloc : public FMalloc
+{
+public:
+  struct FCounts
+  {
+    int64 NumAllocations = 0;
+    int64 AllocatedBytes = 0;
+    /** Most bytes held at once since the counts were reset, over what was held then */
+    int64 PeakBytes = 0;
+  };
+
+  /** Installs the counting allocator and resets the counts, it's removed again when the scope ends */
+  class FScope
+  {
+  public:
+    FScope();
+    ~FScope();
+
+    FCounts GetCounts() const;
+
+    /** Restarts the peak from what is held right now */
+    void ResetPeak();
+
+  private:
+    FMalloc* PreviousMalloc;
+  };
+
+  virtual void* Malloc( SIZE_T Count, uint32 Alignment ) override;
+  virtual void* Realloc( void* Original, SIZE_T Count, uint32 Alignment ) override;
+  virtual void Free( void* Original ) override;
+  virtual SIZE_T QuantizeSize( SIZE_T Count, uint32 Alignment ) override;
+  virtual bool GetAllocationSize( void* Original, SIZE_T& SizeOut ) override;
+  virtual void SetupTLSCachesOnCurrentThread() override;
+  virtual void ClearAndDisableTLSCachesOnCurrentThread() override;
+  virtual bool IsInternallyThreadSafe() const override;
+  virtual const TCHAR* GetDescriptiveName() override;
+
+private:
+  FModioCountingMalloc() = default;
+
+  static FModioCountingMalloc& Get();
+
+  /** Size the wrapped allocator gives the block, 0 if it can't tell */
+  SIZE_T GetBlockSize( void* Block );
+
+  void AddHeldBytes( int64 Bytes );
+
+  FMalloc* Inner = nullptr;
+
+  volatile int64 NumAllocations = 0;
+  volatile int64 AllocatedBytes = 0;
+  volatile int64 HeldBytes = 0;
+  volatile int64 PeakBytes = 0;
+  volatile int64 PeakBase = 0;
+};
@@ -0,0 +1,26 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ModioBenchmarkCommandlet.generated.h"
+
+/**
+ * Measures the conversion and marshalling layer between the SDK and UE4 on synthetic payloads, and the
+ * bookkeeping of async requests, reporting time, allocations and peak memory per element. Runs headless:
+ *   UE4Editor-Cmd Game.uproject -run=ModioBenchmark [-elements=100] [-iterations=50] [-filter=Mods]
+ *     [-nonascii=0.05] [-csv=Results.csv] [-baseline=Baseline.csv] [-tolerance=0.2]
+ * With a baseline it returns 1 if a benchmark got slower or allocates more than the tolerance allows
+ */
+UCLASS()
+class UModioBenchmarkCommandlet : public UCommandlet
+{
+  GENERATED_BODY()
+
+public:
+  UModioBenchmarkCommandlet();
+
+  virtual int32 Main( const FString& Params ) override;
+};
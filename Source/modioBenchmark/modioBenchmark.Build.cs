@@ -0,0 +1,32 @@
+// Copyright 2020 modio. All Rights Reserved.
+// Released under MIT.
+
+using UnrealBuildTool;
+
+public class modioBenchmark : ModuleRules
+{
+	public modioBenchmark(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+#if UE_4_24_OR_LATER
+		DefaultBuildSettings = BuildSettingsVersion.V2;
+#endif
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"Engine",
+			}
+			);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"modio"
+			}
+			);
+	}
+}